@@ -32,6 +32,7 @@ list (APPEND MAIN_SOURCE_FILES
       opm/common/OpmLog/StreamLog.cpp
       opm/common/OpmLog/TimerLog.cpp
       opm/common/utility/ActiveGridCells.cpp
+      opm/common/utility/ConcurrentTasks.cpp
       opm/common/utility/DemangledType.cpp
       opm/common/utility/FileSystem.cpp
       opm/common/utility/MemPacker.cpp
@@ -116,6 +117,7 @@ if(ENABLE_ECL_INPUT)
     opm/input/eclipse/Deck/DeckSection.cpp
     opm/input/eclipse/Deck/ImportContainer.cpp
     opm/input/eclipse/Deck/UDAValue.cpp
+    opm/input/eclipse/Deck/ValueStatusRuns.cpp
     opm/input/eclipse/EclipseState/checkDeck.cpp
     opm/input/eclipse/EclipseState/Co2StoreConfig.cpp
     opm/input/eclipse/EclipseState/EclipseConfig.cpp
@@ -204,6 +206,7 @@ if(ENABLE_ECL_INPUT)
     opm/input/eclipse/Parser/ErrorGuard.cpp
     opm/input/eclipse/Parser/InputErrorAction.cpp
     opm/input/eclipse/Parser/ParseContext.cpp
+    opm/input/eclipse/Parser/BuiltinKeywordTable.cpp
     opm/input/eclipse/Parser/Parser.cpp
     opm/input/eclipse/Parser/ParserEnums.cpp
     opm/input/eclipse/Parser/ParserItem.cpp
@@ -423,6 +426,7 @@ if(ENABLE_ECL_OUTPUT)
           opm/io/eclipse/rst/state.cpp
           opm/io/eclipse/rst/well.cpp
           opm/output/data/Aquifer.cpp
+          opm/output/data/FlatWells.cpp
           opm/output/data/InterRegFlowMap.cpp
           opm/output/data/Solution.cpp
           opm/output/eclipse/ActiveIndexByColumns.cpp
@@ -537,6 +541,7 @@ if(ENABLE_ECL_INPUT)
     tests/material/test_eclblackoilfluidsystemnonstatic.cpp
     tests/material/test_eclblackoilpvt.cpp
     tests/material/test_eclmateriallawmanager.cpp
+    tests/material/test_eclthermallawmanager.cpp
     tests/parser/ACTIONX.cpp
     tests/parser/ADDREGTests.cpp
     tests/parser/AquiferTests.cpp
@@ -815,6 +820,10 @@ if(ENABLE_ECL_INPUT)
     examples/make_ext_smry.cpp
     examples/co2brinepvt.cpp
     examples/hysteresis.cpp
+    examples/compositional_benchmark.cpp
+    examples/co2solubility_benchmark.cpp
+    examples/interpolation_benchmark.cpp
+    examples/ml_model_convert.cpp
   )
 endif()
 
@@ -831,6 +840,7 @@ if(ENABLE_ECL_INPUT)
     examples/make_esmry.cpp
     examples/co2brinepvt.cpp
     examples/hysteresis.cpp
+    examples/ml_model_convert.cpp
   )
 endif()
 
@@ -852,6 +862,7 @@ list( APPEND PUBLIC_HEADER_FILES
       opm/common/OpmLog/StreamLog.hpp
       opm/common/OpmLog/TimerLog.hpp
       opm/common/utility/ActiveGridCells.hpp
+      opm/common/utility/ConcurrentTasks.hpp
       opm/common/utility/ConstexprAssert.hpp
       opm/common/utility/CSRGraphFromCoordinates.hpp
       opm/common/utility/CSRGraphFromCoordinates_impl.hpp
@@ -869,12 +880,14 @@ list( APPEND PUBLIC_HEADER_FILES
       opm/common/utility/numeric/buildUniformMonotoneTable.hpp
       opm/common/utility/numeric/linearInterpolation.hpp
       opm/common/utility/numeric/MonotCubicInterpolator.hpp
+      opm/common/utility/numeric/findSegments.hpp
       opm/common/utility/numeric/NonuniformTableLinear.hpp
       opm/common/utility/numeric/RootFinders.hpp
       opm/common/utility/numeric/SparseVector.hpp
       opm/common/utility/numeric/UniformTableLinear.hpp
       opm/common/utility/numeric/VectorOps.hpp
       opm/common/utility/OpmInputError.hpp
+      opm/common/utility/RelaxedCounter.hpp
       opm/common/utility/parameters/ParameterGroup.hpp
       opm/common/utility/parameters/ParameterGroup_impl.hpp
       opm/common/utility/parameters/Parameter.hpp
@@ -901,6 +914,7 @@ list( APPEND PUBLIC_HEADER_FILES
       opm/material/components/Dnapl.hpp
       opm/material/components/NullComponent.hpp
       opm/material/components/H2O.hpp
+      opm/material/components/H2OTable.hpp
       opm/material/components/TabulatedComponent.hpp
       opm/material/components/Xylene.hpp
       opm/material/components/SimpleH2O.hpp
@@ -948,6 +962,7 @@ list( APPEND PUBLIC_HEADER_FILES
       opm/material/binarycoefficients/H2O_CO2.hpp
       opm/material/binarycoefficients/Air_Xylene.hpp
       opm/material/binarycoefficients/Brine_CO2.hpp
+      opm/material/binarycoefficients/Brine_CO2SolubilityTable.hpp
       opm/material/binarycoefficients/Brine_H2.hpp
       opm/material/binarycoefficients/HenryIapws.hpp
       opm/material/Constants.hpp
@@ -1045,6 +1060,7 @@ list( APPEND PUBLIC_HEADER_FILES
       opm/material/checkFluidSystem.hpp
       opm/material/viscositymodels/LBC.hpp
       opm/material/viscositymodels/LBCco2rich.hpp
+      opm/material/viscositymodels/LBCComponentParams.hpp
       opm/material/common/Valgrind.hpp
       opm/material/common/EnsureFinalized.hpp
       opm/material/common/quad.hpp
@@ -1055,6 +1071,7 @@ list( APPEND PUBLIC_HEADER_FILES
       opm/material/common/TridiagonalMatrix.hpp
       opm/material/common/ResetLocale.hpp
       opm/material/common/HasMemberGeneratorMacros.hpp
+      opm/material/common/TableCellMask.hpp
       opm/material/common/UniformTabulated2DFunction.hpp
       opm/material/common/FastSmallVector.hpp
       opm/material/common/ConditionalStorage.hpp
@@ -1078,6 +1095,7 @@ list( APPEND PUBLIC_HEADER_FILES
       opm/material/densead/EvaluationSpecializations.hpp
       opm/material/densead/Evaluation10.hpp
       opm/material/densead/Evaluation6.hpp
+      opm/material/densead/SimdStorage.hpp
       opm/material/eos/PengRobinson.hpp
       opm/material/eos/PengRobinsonParams.hpp
       opm/material/eos/PengRobinsonParamsMixture.hpp
@@ -1190,6 +1208,7 @@ if(ENABLE_ECL_INPUT)
        opm/input/eclipse/Units/Dimension.hpp
        opm/input/eclipse/Parser/ErrorGuard.hpp
        opm/input/eclipse/Parser/ParserItem.hpp
+       opm/input/eclipse/Parser/BuiltinKeywordTable.hpp
        opm/input/eclipse/Parser/Parser.hpp
        opm/input/eclipse/Parser/ParserRecord.hpp
        opm/input/eclipse/Parser/ParserKeyword.hpp
@@ -1469,6 +1488,7 @@ if(ENABLE_ECL_INPUT)
        opm/input/eclipse/Deck/ImportContainer.hpp
        opm/input/eclipse/Deck/UDAValue.hpp
        opm/input/eclipse/Deck/value_status.hpp
+       opm/input/eclipse/Deck/ValueStatusRuns.hpp
        opm/input/eclipse/Python/Python.hpp)
 endif()
 if(ENABLE_ECL_OUTPUT)
@@ -1502,6 +1522,7 @@ if(ENABLE_ECL_OUTPUT)
         opm/io/eclipse/rst/well.hpp
         opm/output/data/Aquifer.hpp
         opm/output/data/Cells.hpp
+        opm/output/data/FlatWells.hpp
         opm/output/data/GuideRateValue.hpp
         opm/output/data/Groups.hpp
         opm/output/data/InterRegFlow.hpp
@@ -8,9 +8,11 @@ set(genkw_SOURCES opm/json/JsonObject.cpp
                   opm/input/eclipse/Deck/DeckRecord.cpp
                   opm/input/eclipse/Deck/DeckOutput.cpp
                   opm/input/eclipse/Deck/UDAValue.cpp
+                  opm/input/eclipse/Deck/ValueStatusRuns.cpp
                   opm/input/eclipse/Generator/KeywordGenerator.cpp
                   opm/input/eclipse/Generator/KeywordLoader.cpp
                   opm/input/eclipse/Schedule/UDQ/UDQEnums.cpp
+                  opm/input/eclipse/Parser/BuiltinKeywordTable.cpp
                   opm/input/eclipse/Parser/createDefaultKeywordList.cpp
                   opm/input/eclipse/Parser/ErrorGuard.cpp
                   opm/input/eclipse/Parser/ParseContext.cpp
@@ -13,6 +13,11 @@
 # script, you need a python 2 installation where the Jinja2 module is
 # available.
 #
+# The specializations optionally store the value and derivatives padded
+# to whole SIMD registers (see SimdStorage.hpp), in which case the
+# arithmetic operators process all lanes at once instead of the unrolled
+# statements.
+#
 import os
 import sys
 import jinja2
@@ -88,6 +93,9 @@ specializationTemplate = \
 #include <stdexcept>
 
 #include <opm/common/utility/gpuDecorators.hpp>
+{% if numDerivs > 0 %}\
+#include <opm/material/densead/SimdStorage.hpp>
+{% endif %}\
 
 namespace Opm {
 namespace DenseAd {
@@ -268,7 +276,7 @@ public:
     }
 {% else %}\
     template <class RhsValueType>
-    OPM_HOST_DEVICE Evaluation(const RhsValueType& c, int varPos)
+    OPM_HOST_DEVICE Evaluation(const RhsValueType& c, int varPos) : data_{}
     {
         // The variable position must be in represented by the given variable descriptor
         assert(0 <= varPos && varPos < size());
@@ -446,9 +454,15 @@ public:
         for (int i = dstart_(); i < dend_(); ++i)
             data_[i] = other.data_[i];
 {% else %}\
+        if constexpr (Storage_::enabled) {
+            for (int i = dstart_(); i < Storage_::size; ++i)
+                data_[i] = other.data_[i];
+        }
+        else {
 {%   for i in range(1, numDerivs+1) %}\
-        data_[{{i}}] = other.data_[{{i}}];
+            data_[{{i}}] = other.data_[{{i}}];
 {%   endfor %}\
+        }
 {% endif %}\
     }
 
@@ -462,9 +476,17 @@ public:
         for (int i = 0; i < length_(); ++i)
             data_[i] += other.data_[i];
 {% else %}\
+        if constexpr (Storage_::enabled) {
+            decltype(data_) result;
+            for (int i = 0; i < Storage_::size; ++i)
+                result[i] = data_[i] + other.data_[i];
+            data_ = result;
+        }
+        else {
 {%   for i in range(0, numDerivs+1) %}\
-        data_[{{i}}] += other.data_[{{i}}];
+            data_[{{i}}] += other.data_[{{i}}];
 {%   endfor %}\
+        }
 {% endif %}\
 
         return *this;
@@ -489,9 +511,17 @@ public:
         for (int i = 0; i < length_(); ++i)
             data_[i] -= other.data_[i];
 {% else %}\
+        if constexpr (Storage_::enabled) {
+            decltype(data_) result;
+            for (int i = 0; i < Storage_::size; ++i)
+                result[i] = data_[i] - other.data_[i];
+            data_ = result;
+        }
+        else {
 {%   for i in range(0, numDerivs+1) %}\
-        data_[{{i}}] -= other.data_[{{i}}];
+            data_[{{i}}] -= other.data_[{{i}}];
 {%   endfor %}\
+        }
 {% endif %}\
 
         return *this;
@@ -517,6 +547,19 @@ public:
         const ValueType u = this->value();
         const ValueType v = other.value();
 
+{% if numDerivs > 0 %}\
+        if constexpr (Storage_::enabled) {
+            // all lanes at once, where the value lane only gets u*v. The
+            // result is written at the end, as other may be this object.
+            decltype(data_) result;
+            for (int i = 0; i < Storage_::size; ++i)
+                result[i] = data_[i] * v + other.data_[i] * (i == valuepos_() ? 0.0 : u);
+            data_ = result;
+
+            return *this;
+        }
+
+{% endif %}\
         // value
         data_[valuepos_()] *= v ;
 
@@ -541,9 +584,15 @@ public:
         for (int i = 0; i < length_(); ++i)
             data_[i] *= other;
 {% else %}\
+        if constexpr (Storage_::enabled) {
+            for (int i = 0; i < Storage_::size; ++i)
+                data_[i] *= other;
+        }
+        else {
 {%   for i in range(0, numDerivs+1) %}\
-        data_[{{i}}] *= other;
+            data_[{{i}}] *= other;
 {%   endfor %}\
+        }
 {% endif %}\
 
         return *this;
@@ -556,6 +605,22 @@ public:
 
         // values are divided, derivatives follow the rule for division, i.e., (u/v)' = (v'u -
         // u'v)/v^2.
+{% if numDerivs > 0 %}\
+        if constexpr (Storage_::enabled) {
+            // (u/v)' = (u' - (u/v)v')/v for all lanes at once, with a single
+            // division, where the value lane gets u/v.
+            // The result is written at the end, as other may be this object.
+            const ValueType q = data_[valuepos_()] / other.value();
+            const ValueType vInv = 1.0 / other.value();
+            decltype(data_) result;
+            for (int i = 0; i < Storage_::size; ++i)
+                result[i] = (i == valuepos_()) ? q : (data_[i] - q * other.data_[i]) * vInv;
+            data_ = result;
+
+            return *this;
+        }
+
+{% endif %}\
         ValueType& u = data_[valuepos_()];
         const ValueType& v = other.value();
 {% if numDerivs <= 0 %}\
@@ -585,9 +650,15 @@ public:
         for (int i = 0; i < length_(); ++i)
             data_[i] *= tmp;
 {% else %}\
+        if constexpr (Storage_::enabled) {
+            for (int i = 0; i < Storage_::size; ++i)
+                data_[i] *= tmp;
+        }
+        else {
 {%   for i in range(0, numDerivs+1) %}\
-        data_[{{i}}] *= tmp;
+            data_[{{i}}] *= tmp;
 {%   endfor %}\
+        }
 {% endif %}\
 
         return *this;
@@ -653,9 +724,15 @@ public:
         for (int i = 0; i < length_(); ++i)
             result.data_[i] = - data_[i];
 {% else %}\
+        if constexpr (Storage_::enabled) {
+            for (int i = 0; i < Storage_::size; ++i)
+                result.data_[i] = - data_[i];
+        }
+        else {
 {%   for i in range(0, numDerivs+1) %}\
-        result.data_[{{i}}] = - data_[{{i}}];
+            result.data_[{{i}}] = - data_[{{i}}];
 {%   endfor %}\
+        }
 {% endif %}\
 
         return result;
@@ -819,7 +896,9 @@ private:
 {% elif numDerivs == 0 %}\
     std::array<ValueT, numDerivs + 1> data_;
 {% else %}\
-    std::array<ValueT, {{numDerivs + 1}}> data_;
+    using Storage_ = SimdStorage<ValueT, {{numDerivs + 1}}>;
+
+    alignas(Storage_::alignment) std::array<ValueT, Storage_::size> data_;
 {% endif %}\
 };
 
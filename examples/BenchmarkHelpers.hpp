@@ -0,0 +1,109 @@
+// -*- mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-
+// vi: set et ts=4 sw=4 sts=4:
+/*
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 2 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+
+  Consult the COPYING file in the top-level source directory of this
+  module for the precise wording of the license and the list of
+  copyright holders.
+*/
+
+/*!
+ * \file
+ *
+ * \brief Timing and command line handling shared by the benchmark examples,
+ * which take the size of a sweep and the number of sweeps as arguments
+ */
+#ifndef OPM_EXAMPLES_BENCHMARK_HELPERS_HPP
+#define OPM_EXAMPLES_BENCHMARK_HELPERS_HPP
+
+#include <chrono>
+#include <cstddef>
+#include <iostream>
+#include <string>
+
+namespace Opm::Benchmark {
+
+/// Run time, in seconds, of calling \p f \p repeats times.
+template <class Function>
+double timeRepeated(const int repeats, Function&& f)
+{
+    const auto start = std::chrono::steady_clock::now();
+    for (int rep = 0; rep < repeats; ++rep) {
+        f();
+    }
+    const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    return elapsed.count();
+}
+
+/// Command line of the form "<program> <size> [repeats]".
+class CommandLine
+{
+public:
+    CommandLine(const int argc, char** argv)
+        : argc_(argc)
+        , argv_(argv)
+    {
+        for (int i = 1; i < argc; ++i) {
+            const std::string tmp = argv[i];
+            help_ = help_ || (tmp  == "--h") || (tmp  == "--help");
+        }
+    }
+
+    bool help() const
+    { return help_; }
+
+    /// Whether the size argument is given.
+    bool hasSize() const
+    { return argc_ > 1; }
+
+    /// The size argument, as given.
+    std::string sizeArgument() const
+    { return argv_[1]; }
+
+    /// The size argument as a count.
+    std::size_t size(const std::size_t defaultSize) const
+    { return hasSize() ? std::stoul(argv_[1]) : defaultSize; }
+
+    /// Number of sweeps.
+    int repeats(const int defaultRepeats = 10) const
+    { return (argc_ > 2) ? std::stoi(argv_[2]) : defaultRepeats; }
+
+    /// Prints the usage, where \p sizeName is the name and \p sizeDescription
+    /// the description of the size argument, and a sweep runs over all
+    /// \p sweep.
+    static void printUsage(const std::string& program,
+                           const std::string& sizeName,
+                           const std::string& sizeDescription,
+                           const bool sizeRequired = false,
+                           const std::string& sweep = "cells")
+    {
+        const auto synopsis = sizeRequired ? "<" + sizeName + ">" : "[" + sizeName + "]";
+        std::cout << "USAGE:" << std::endl;
+        std::cout << program << " " << synopsis << " [repeats]" << std::endl;
+        std::cout << sizeName << ": " << sizeDescription << std::endl;
+        std::cout << "repeats: number of sweeps over all " << sweep << " (default = 10)" << std::endl;
+    }
+
+private:
+    int argc_;
+    char** argv_;
+    bool help_{false};
+};
+
+} // namespace Opm::Benchmark
+
+#endif // OPM_EXAMPLES_BENCHMARK_HELPERS_HPP
@@ -0,0 +1,162 @@
+// -*- mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-
+// vi: set et ts=4 sw=4 sts=4:
+/*
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 2 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+
+  Consult the COPYING file in the top-level source directory of this
+  module for the precise wording of the license and the list of
+  copyright holders.
+*/
+
+/*!
+ * \file
+ *
+ * \brief A small application comparing the solubility model of the CO2-brine
+ * PVT classes to its tabulated counterpart, in run time and in deviation
+ *
+ */
+#include "config.h"
+
+#include <examples/BenchmarkHelpers.hpp>
+
+#include <opm/material/densead/Evaluation.hpp>
+#include <opm/material/densead/Math.hpp>
+#include <opm/material/fluidsystems/blackoilpvt/BrineCo2Pvt.hpp>
+#include <opm/material/fluidsystems/blackoilpvt/Co2GasPvt.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace {
+
+using BrinePvt = Opm::BrineCo2Pvt<double>;
+using GasPvt = Opm::Co2GasPvt<double>;
+
+struct State
+{
+    double temperature;
+    double pressure;
+};
+
+// Rs and Rvw of all cells; returns ns/cell.
+template <class Evaluation>
+double benchmark(const BrinePvt& brine, const GasPvt& gas, const double salinity,
+                 const std::vector<State>& cells, const int repeats,
+                 std::vector<double>& rs, std::vector<double>& rvw)
+{
+    rs.resize(cells.size());
+    rvw.resize(cells.size());
+
+    const double elapsed = Opm::Benchmark::timeRepeated(repeats, [&]()
+    {
+        for (std::size_t cellIdx = 0; cellIdx < cells.size(); ++cellIdx) {
+            Evaluation T = cells[cellIdx].temperature;
+            Evaluation p = cells[cellIdx].pressure;
+            if constexpr (!std::is_same_v<Evaluation, double>) {
+                p.setDerivative(0, 1.0);
+            }
+            rs[cellIdx] = Opm::getValue(brine.rsSat(0, T, p, Evaluation(salinity)));
+            rvw[cellIdx] = Opm::getValue(gas.saturatedWaterVaporizationFactor(0, T, p));
+        }
+    });
+
+    return 1.0e9 * elapsed / (static_cast<double>(cells.size()) * repeats);
+}
+
+double maxRelativeDeviation(const std::vector<double>& a, const std::vector<double>& b)
+{
+    double result = 0.0;
+    for (std::size_t i = 0; i < a.size(); ++i) {
+        result = std::max(result, std::abs(a[i] - b[i]) / std::max(std::abs(a[i]), 1.0e-30));
+    }
+    return result;
+}
+
+void run(const int activityModel, const double salinity,
+         const std::vector<State>& cells, const int repeats)
+{
+    const std::vector<double> salinities = {salinity};
+
+    BrinePvt brine(salinities, activityModel);
+    GasPvt gas(salinities, activityModel);
+
+    BrinePvt brineTabulated(salinities, activityModel);
+    GasPvt gasTabulated(salinities, activityModel);
+    const double build = Opm::Benchmark::timeRepeated(1, [&]()
+    {
+        brineTabulated.setTabulatedSolubility(true);
+        gasTabulated.setTabulatedSolubility(true);
+    });
+
+    std::vector<double> rs, rvw, rsTabulated, rvwTabulated;
+    const double exact = benchmark<double>(brine, gas, salinity, cells, repeats, rs, rvw);
+    const double tabulated = benchmark<double>(brineTabulated, gasTabulated, salinity, cells, repeats,
+                                               rsTabulated, rvwTabulated);
+
+    using Evaluation = Opm::DenseAd::Evaluation<double, 3>;
+    const double exactAd = benchmark<Evaluation>(brine, gas, salinity, cells, repeats, rs, rvw);
+    const double tabulatedAd = benchmark<Evaluation>(brineTabulated, gasTabulated, salinity, cells, repeats,
+                                                     rsTabulated, rvwTabulated);
+
+    std::cout << "activity model " << activityModel << ", salinity " << salinity
+              << std::fixed << std::setprecision(1)
+              << "\n  double: exact " << std::setw(8) << exact << " ns/cell, tabulated "
+              << std::setw(8) << tabulated << " ns/cell"
+              << "\n  AD(3):  exact " << std::setw(8) << exactAd << " ns/cell, tabulated "
+              << std::setw(8) << tabulatedAd << " ns/cell"
+              << "\n  table build " << std::setprecision(3) << build << " s"
+              << std::scientific << std::setprecision(2)
+              << ", max relative deviation Rs " << maxRelativeDeviation(rs, rsTabulated)
+              << ", Rvw " << maxRelativeDeviation(rvw, rvwTabulated)
+              << std::defaultfloat << std::endl;
+}
+
+} // Anonymous namespace
+
+int main(int argc, char **argv)
+{
+    const Opm::Benchmark::CommandLine commandLine(argc, argv);
+    if (commandLine.help()) {
+        commandLine.printUsage("co2solubility_benchmark", "cells",
+                               "number of cells per sweep (default = 10000)");
+        return EXIT_SUCCESS;
+    }
+
+    const std::size_t numCells = commandLine.size(10000);
+    const int repeats = commandLine.repeats();
+
+    // Typical storage conditions: 300 to 400 K and 50 to 400 bar.
+    std::vector<State> cells(numCells);
+    for (std::size_t cellIdx = 0; cellIdx < numCells; ++cellIdx) {
+        cells[cellIdx].temperature = 300.0 + 100.0*static_cast<double>(cellIdx % 37) / 37;
+        cells[cellIdx].pressure = 50.0e5 + 350.0e5*static_cast<double>(cellIdx % 101) / 101;
+    }
+
+    std::cout << "Cells: " << numCells << ", repeats: " << repeats << std::endl;
+    for (const int activityModel : {1, 2, 3}) {
+        for (const double salinity : {0.0, 0.1}) {
+            run(activityModel, salinity, cells, repeats);
+        }
+    }
+
+    return EXIT_SUCCESS;
+}
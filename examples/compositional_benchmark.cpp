@@ -0,0 +1,186 @@
+// -*- mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-
+// vi: set et ts=4 sw=4 sts=4:
+/*
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 2 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+
+  Consult the COPYING file in the top-level source directory of this
+  module for the precise wording of the license and the list of
+  copyright holders.
+*/
+
+/*!
+ * \file
+ *
+ * \brief A small application timing the cubic equation of state and LBC
+ * viscosity evaluations of the generic compositional fluid system for
+ * three, six and nine component fluids
+ *
+ */
+#include "config.h"
+
+#include <examples/BenchmarkHelpers.hpp>
+
+#include <opm/material/Constants.hpp>
+#include <opm/material/densead/Evaluation.hpp>
+#include <opm/material/densead/Math.hpp>
+#include <opm/material/fluidstates/CompositionalFluidState.hpp>
+#include <opm/material/fluidsystems/GenericOilGasWaterFluidSystem.hpp>
+
+#include <opm/input/eclipse/EclipseState/Compositional/CompositionalConfig.hpp>
+
+#include <array>
+#include <cmath>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace {
+
+using EOSType = Opm::CompositionalConfig::EOSType;
+
+// Name, molar mass [kg/mol], critical temperature [K], critical pressure
+// [Pa], critical volume [m3/kmol] and acentric factor of the components of
+// the benchmark fluids.  The first NumComp entries make up a fluid.
+struct ComponentData
+{
+    const char* name;
+    double molarMass;
+    double criticalTemperature;
+    double criticalPressure;
+    double criticalVolume;
+    double acentricFactor;
+};
+
+constexpr std::array<ComponentData, 9> components {{
+    {"C1",  0.01604, 190.56, 45.99e5, 0.0986, 0.011},
+    {"CO2", 0.04401, 304.13, 73.77e5, 0.0940, 0.225},
+    {"C10", 0.14229, 617.70, 21.10e5, 0.6000, 0.490},
+    {"C2",  0.03007, 305.32, 48.72e5, 0.1455, 0.099},
+    {"C3",  0.04410, 369.83, 42.48e5, 0.2000, 0.152},
+    {"N2",  0.02801, 126.20, 33.98e5, 0.0895, 0.039},
+    {"NC4", 0.05812, 425.12, 37.96e5, 0.2550, 0.200},
+    {"NC5", 0.07215, 469.70, 33.70e5, 0.3130, 0.252},
+    {"C6",  0.08618, 507.60, 30.25e5, 0.3710, 0.301},
+}};
+
+template <class FluidSystem>
+void initFluidSystem()
+{
+    using CompParm = typename FluidSystem::ComponentParam;
+
+    FluidSystem::init();
+    for (int compIdx = 0; compIdx < FluidSystem::numComponents; ++compIdx) {
+        const auto& c = components[compIdx];
+        FluidSystem::addComponent(CompParm {c.name, c.molarMass, c.criticalTemperature,
+                                            c.criticalPressure, c.criticalVolume, c.acentricFactor});
+    }
+}
+
+template <class FluidSystem, class Evaluation>
+double benchmark(const std::size_t numCells, const int repeats)
+{
+    using FluidState = Opm::CompositionalFluidState<Evaluation, FluidSystem>;
+    using ParameterCache = typename FluidSystem::template ParameterCache<Evaluation>;
+    constexpr int numComponents = FluidSystem::numComponents;
+    constexpr double R = Opm::Constants<double>::R;
+
+    std::vector<FluidState> cells(numCells);
+    for (std::size_t cellIdx = 0; cellIdx < numCells; ++cellIdx) {
+        auto& fs = cells[cellIdx];
+        const Evaluation p = 50.0e5 + 150.0e5*static_cast<double>(cellIdx % 101) / 101;
+        const Evaluation T = 300.0 + 80.0*static_cast<double>(cellIdx % 37) / 37;
+
+        std::array<double, numComponents> z{};
+        double sum = 0.0;
+        for (int compIdx = 0; compIdx < numComponents; ++compIdx) {
+            z[compIdx] = 1.0 + static_cast<double>((cellIdx + 7*compIdx) % 13);
+            sum += z[compIdx];
+        }
+
+        for (int phaseIdx : {FluidSystem::oilPhaseIdx, FluidSystem::gasPhaseIdx}) {
+            fs.setPressure(phaseIdx, p);
+            for (int compIdx = 0; compIdx < numComponents; ++compIdx) {
+                fs.setMoleFraction(phaseIdx, compIdx, Evaluation{z[compIdx] / sum});
+            }
+        }
+        fs.setTemperature(T);
+    }
+
+    Evaluation checksum = 0.0;
+    const double elapsed = Opm::Benchmark::timeRepeated(repeats, [&]()
+    {
+        for (auto& fs : cells) {
+            ParameterCache paramCache(EOSType::PR);
+            for (int phaseIdx : {FluidSystem::oilPhaseIdx, FluidSystem::gasPhaseIdx}) {
+                paramCache.updatePhase(fs, phaseIdx);
+
+                const Evaluation Z = fs.pressure(phaseIdx) * paramCache.molarVolume(phaseIdx)
+                    / (R * fs.temperature(phaseIdx));
+                fs.setCompressFactor(phaseIdx, Z);
+
+                checksum += FluidSystem::viscosity(fs, paramCache, phaseIdx);
+                for (int compIdx = 0; compIdx < numComponents; ++compIdx) {
+                    checksum += FluidSystem::fugacityCoefficient(fs, paramCache, phaseIdx, compIdx);
+                }
+            }
+        }
+    });
+
+    if (!std::isfinite(Opm::getValue(checksum))) {
+        std::cerr << "Non-finite result for " << numComponents << " components" << std::endl;
+    }
+
+    return 1.0e9 * elapsed / (static_cast<double>(numCells) * repeats);
+}
+
+template <int NumComp>
+void run(const std::size_t numCells, const int repeats)
+{
+    using FluidSystem = Opm::GenericOilGasWaterFluidSystem<double, NumComp, /*enableWater=*/false>;
+    initFluidSystem<FluidSystem>();
+
+    const double scalar = benchmark<FluidSystem, double>(numCells, repeats);
+    const double ad = benchmark<FluidSystem, Opm::DenseAd::Evaluation<double, NumComp + 1>>(numCells, repeats);
+
+    std::cout << std::setw(2) << NumComp << " components"
+              << std::fixed << std::setprecision(1)
+              << "  double: " << std::setw(9) << scalar << " ns/cell"
+              << "  AD(" << NumComp + 1 << "): " << std::setw(9) << ad << " ns/cell" << std::endl;
+}
+
+} // Anonymous namespace
+
+int main(int argc, char **argv)
+{
+    const Opm::Benchmark::CommandLine commandLine(argc, argv);
+    if (commandLine.help()) {
+        commandLine.printUsage("compositional_benchmark", "cells",
+                               "number of cells per sweep (default = 10000)");
+        return EXIT_SUCCESS;
+    }
+
+    const std::size_t numCells = commandLine.size(10000);
+    const int repeats = commandLine.repeats();
+
+    std::cout << "Cells: " << numCells << ", repeats: " << repeats << std::endl;
+    run<3>(numCells, repeats);
+    run<6>(numCells, repeats);
+    run<9>(numCells, repeats);
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,173 @@
+// -*- mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-
+// vi: set et ts=4 sw=4 sts=4:
+/*
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 2 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+
+  Consult the COPYING file in the top-level source directory of this
+  module for the precise wording of the license and the list of
+  copyright holders.
+*/
+
+/*!
+ * \file
+ *
+ * \brief A small application comparing the run time of the point-wise and
+ * the batched evaluation of Spline and MonotCubicInterpolator, for sorted
+ * and unsorted positions
+ *
+ */
+#include "config.h"
+
+#include <examples/BenchmarkHelpers.hpp>
+
+#include <opm/common/utility/numeric/MonotCubicInterpolator.hpp>
+#include <opm/material/common/Spline.hpp>
+#include <opm/material/densead/Evaluation.hpp>
+#include <opm/material/densead/Math.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace {
+
+// A saturation function like curve with the given number of samples
+void makeCurve(const std::size_t numSamples, std::vector<double>& x, std::vector<double>& y)
+{
+    x.resize(numSamples);
+    y.resize(numSamples);
+    for (std::size_t i = 0; i < numSamples; ++i) {
+        x[i] = static_cast<double>(i) / (numSamples - 1);
+        y[i] = x[i]*x[i]*(3.0 - 2.0*x[i]);
+    }
+}
+
+// Returns ns/point of the point-wise and the batched evaluation.
+template <class Evaluation>
+std::pair<double, double> benchmarkSpline(const Opm::Spline<double>& spline,
+                                          const std::vector<double>& positions,
+                                          const int repeats)
+{
+    std::vector<Evaluation> x(positions.size());
+    for (std::size_t i = 0; i < positions.size(); ++i) {
+        x[i] = positions[i];
+        if constexpr (!std::is_same_v<Evaluation, double>) {
+            x[i].setDerivative(0, 1.0);
+        }
+    }
+    std::vector<Evaluation> y(x.size());
+    std::vector<Evaluation> dydx(x.size());
+
+    const double pointwise = Opm::Benchmark::timeRepeated(repeats, [&]()
+    {
+        for (std::size_t i = 0; i < x.size(); ++i) {
+            y[i] = spline.eval(x[i]);
+            dydx[i] = spline.evalDerivative(x[i]);
+        }
+    });
+    const double batched = Opm::Benchmark::timeRepeated(repeats, [&]()
+    {
+        spline.evalWithDerivativeArray(x.size(), x, y, dydx);
+    });
+
+    const double scale = 1.0e9 / (static_cast<double>(x.size()) * repeats);
+    return {pointwise*scale, batched*scale};
+}
+
+std::pair<double, double> benchmarkMonotCubic(const Opm::MonotCubicInterpolator& interp,
+                                              const std::vector<double>& x,
+                                              const int repeats)
+{
+    std::vector<double> f(x.size());
+
+    const double pointwise = Opm::Benchmark::timeRepeated(repeats, [&]()
+    {
+        for (std::size_t i = 0; i < x.size(); ++i) {
+            f[i] = interp.evaluate(x[i]);
+        }
+    });
+    const double batched = Opm::Benchmark::timeRepeated(repeats, [&]()
+    {
+        interp.evaluate(x, f);
+    });
+
+    const double scale = 1.0e9 / (static_cast<double>(x.size()) * repeats);
+    return {pointwise*scale, batched*scale};
+}
+
+void printResult(const std::string& name, const std::pair<double, double>& result)
+{
+    std::cout << "  " << std::left << std::setw(22) << name << std::right
+              << std::fixed << std::setprecision(1)
+              << " point-wise " << std::setw(7) << result.first << " ns/point"
+              << ", batched " << std::setw(7) << result.second << " ns/point"
+              << std::defaultfloat << std::endl;
+}
+
+void run(const std::size_t numSamples, const std::vector<double>& unsorted, const int repeats)
+{
+    std::vector<double> x;
+    std::vector<double> y;
+    makeCurve(numSamples, x, y);
+
+    std::vector<double> sorted = unsorted;
+    std::sort(sorted.begin(), sorted.end());
+
+    const Opm::Spline<double> spline(x, y, /*type=*/Opm::Spline<double>::Monotonic);
+    const Opm::MonotCubicInterpolator interp(x, y);
+
+    using Evaluation = Opm::DenseAd::Evaluation<double, 3>;
+    std::cout << numSamples << " samples" << std::endl;
+    printResult("Spline, unsorted", benchmarkSpline<double>(spline, unsorted, repeats));
+    printResult("Spline, sorted", benchmarkSpline<double>(spline, sorted, repeats));
+    printResult("Spline AD(3), unsorted", benchmarkSpline<Evaluation>(spline, unsorted, repeats));
+    printResult("Spline AD(3), sorted", benchmarkSpline<Evaluation>(spline, sorted, repeats));
+    printResult("MonotCubic, unsorted", benchmarkMonotCubic(interp, unsorted, repeats));
+    printResult("MonotCubic, sorted", benchmarkMonotCubic(interp, sorted, repeats));
+}
+
+} // Anonymous namespace
+
+int main(int argc, char **argv)
+{
+    const Opm::Benchmark::CommandLine commandLine(argc, argv);
+    if (commandLine.help()) {
+        commandLine.printUsage("interpolation_benchmark", "points",
+                               "number of positions per sweep (default = 100000)",
+                               false, "positions");
+        return EXIT_SUCCESS;
+    }
+
+    const std::size_t numPoints = commandLine.size(100000);
+    const int repeats = commandLine.repeats();
+
+    // Positions in a pseudo-random order, as the saturations of the cells
+    std::vector<double> positions(numPoints);
+    for (std::size_t i = 0; i < numPoints; ++i) {
+        positions[i] = static_cast<double>((i*7919) % numPoints) / numPoints;
+    }
+
+    std::cout << "Points: " << numPoints << ", repeats: " << repeats << std::endl;
+    for (const std::size_t numSamples : {10, 40, 200}) {
+        run(numSamples, positions, repeats);
+    }
+
+    return EXIT_SUCCESS;
+}
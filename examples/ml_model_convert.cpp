@@ -0,0 +1,76 @@
+// -*- mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-
+// vi: set et ts=4 sw=4 sts=4:
+/*
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 2 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+
+  Consult the COPYING file in the top-level source directory of this
+  module for the precise wording of the license and the list of
+  copyright holders.
+*/
+
+/*!
+ * \file
+ *
+ * \brief Converts a neural network model generated by Kerasify to the
+ * binary model format, which NNModel::loadModel() maps into memory
+ *
+ */
+#include "config.h"
+
+#include <opm/ml/ml_model.hpp>
+
+#include <chrono>
+#include <cstdlib>
+#include <exception>
+#include <iostream>
+#include <string>
+
+int main(int argc, char **argv)
+{
+    bool help = (argc != 3);
+    for (int i = 1; i < argc; ++i) {
+        std::string tmp = argv[i];
+        help = help || (tmp  == "--h") || (tmp  == "--help");
+    }
+
+    if (help) {
+        std::cout << "USAGE:" << std::endl;
+        std::cout << "ml_model_convert <input> <output>" << std::endl;
+        std::cout << "input: model file generated by Kerasify, or a binary model" << std::endl;
+        std::cout << "output: binary model file to write" << std::endl;
+        return (argc == 2) ? EXIT_SUCCESS : EXIT_FAILURE;
+    }
+
+    try {
+        Opm::ML::NNModel<double> model;
+        model.loadModel(argv[1]);
+        model.saveModel(argv[2]);
+
+        // Report the load time of the converted model
+        const auto start = std::chrono::steady_clock::now();
+        Opm::ML::NNModel<double> converted;
+        converted.loadModel(argv[2]);
+        const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+        std::cout << "Wrote " << argv[2] << ", loaded in "
+                  << 1.0e6 * elapsed.count() << " us" << std::endl;
+    }
+    catch (const std::exception& e) {
+        std::cerr << e.what() << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,725 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/*!
+ * \file
+ *
+ * \brief End-to-end benchmark of the output stages driven by msim.
+ *
+ * Generates a synthetic model of configurable size--cells, wells,
+ * groups, segments, UDQs and ACTIONX blocks--runs it through msim and
+ * reports the time spent in each output stage at each report step as
+ * JSON.
+ */
+
+#include <opm/msim/msim.hpp>
+
+#include <opm/output/data/Groups.hpp>
+#include <opm/output/data/Solution.hpp>
+#include <opm/output/data/Wells.hpp>
+#include <opm/output/eclipse/AggregateAquiferData.hpp>
+#include <opm/output/eclipse/Inplace.hpp>
+#include <opm/output/eclipse/RestartIO.hpp>
+#include <opm/output/eclipse/RestartValue.hpp>
+#include <opm/output/eclipse/Summary.hpp>
+#include <opm/output/eclipse/WriteRFT.hpp>
+
+#include <opm/io/eclipse/OutputStream.hpp>
+
+#include <opm/input/eclipse/Deck/Deck.hpp>
+#include <opm/input/eclipse/EclipseState/EclipseState.hpp>
+#include <opm/input/eclipse/EclipseState/Grid/RegionSetMatcher.hpp>
+#include <opm/input/eclipse/EclipseState/IOConfig/IOConfig.hpp>
+#include <opm/input/eclipse/EclipseState/SummaryConfig/SummaryConfig.hpp>
+#include <opm/input/eclipse/Parser/ErrorGuard.hpp>
+#include <opm/input/eclipse/Parser/ParseContext.hpp>
+#include <opm/input/eclipse/Parser/Parser.hpp>
+#include <opm/input/eclipse/Schedule/Schedule.hpp>
+#include <opm/input/eclipse/Schedule/SummaryState.hpp>
+#include <opm/input/eclipse/Schedule/UDQ/UDQConfig.hpp>
+#include <opm/input/eclipse/Schedule/UDQ/UDQParams.hpp>
+#include <opm/input/eclipse/Schedule/UDQ/UDQState.hpp>
+#include <opm/input/eclipse/Schedule/Well/WellMatcher.hpp>
+#include <opm/input/eclipse/Schedule/Well/WellTestState.hpp>
+#include <opm/input/eclipse/Units/UnitSystem.hpp>
+
+#include <opm/common/OpmLog/OpmLog.hpp>
+#include <opm/common/utility/TimeService.hpp>
+
+#include <fmt/format.h>
+#include <fmt/ranges.h>
+
+#include <getopt.h>
+
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <numeric>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace {
+
+struct ModelSize
+{
+    std::size_t cells{100'000};
+    std::size_t wells{100};
+    std::size_t groups{10};
+    std::size_t segments{0};
+    std::size_t udqs{10};
+    std::size_t actions{10};
+    std::size_t steps{10};
+};
+
+struct GridDims
+{
+    std::size_t nx{1};
+    std::size_t ny{1};
+    std::size_t nz{1};
+
+    std::size_t columns() const { return nx * ny; }
+    std::size_t cells() const { return nx * ny * nz; }
+};
+
+// Layer thickness and depth of top layer in generated model.  METRIC units.
+constexpr double layerThickness = 10.0;
+constexpr double topDepth = 2500.0;
+
+GridDims gridDims(const std::size_t cells)
+{
+    auto dims = GridDims{};
+
+    dims.nz = std::min(cells, std::size_t{10});
+    const auto columns = (cells + dims.nz - 1) / dims.nz;
+
+    dims.nx = static_cast<std::size_t>(std::ceil(std::sqrt(static_cast<double>(columns))));
+    dims.ny = (columns + dims.nx - 1) / dims.nx;
+
+    return dims;
+}
+
+// Every fourth well is a water injector, all others are producers.
+bool isInjector(const std::size_t well)
+{
+    return (well % 4) == 3;
+}
+
+std::string wellName(const std::size_t well)
+{
+    return fmt::format("{}{:04d}", isInjector(well) ? 'I' : 'P', well + 1);
+}
+
+std::string groupName(const std::size_t group)
+{
+    return fmt::format("G{:03d}", group + 1);
+}
+
+std::string udqName(const std::size_t udq)
+{
+    return fmt::format("{}U{:04d}", (udq % 2 == 0) ? 'W' : 'F', udq + 1);
+}
+
+bool multiSegment(const ModelSize& size)
+{
+    return size.segments >= 2;
+}
+
+std::size_t numProducers(const ModelSize& size)
+{
+    return size.wells - size.wells / 4;
+}
+
+std::string runspecSection(const ModelSize& size, const GridDims& dims)
+{
+    const auto wellsPerGroup = (size.wells + size.groups - 1) / size.groups;
+
+    auto runspec = fmt::format(R"(RUNSPEC
+
+TITLE
+  'Synthetic output benchmark' /
+
+DIMENS
+  {} {} {} /
+
+OIL
+WATER
+GAS
+METRIC
+
+UNIFOUT
+
+TABDIMS
+/
+
+EQLDIMS
+  1 /
+
+WELLDIMS
+  {} {} {} {} /
+
+UDQDIMS
+  50 25 0 {} 0 0 0 {} 0 0 /
+
+ACTDIMS
+  {} 10 80 3 /
+
+START
+  1 'JAN' 2020 /
+)", dims.nx, dims.ny, dims.nz,
+    size.wells, dims.nz, size.groups, wellsPerGroup,
+    size.udqs, size.udqs, std::max(size.actions, std::size_t{1}));
+
+    if (multiSegment(size)) {
+        runspec += fmt::format(R"(
+WSEGDIMS
+  {} {} 1 /
+)", numProducers(size), size.segments);
+    }
+
+    return runspec;
+}
+
+std::string gridSection(const GridDims& dims)
+{
+    return fmt::format(R"(
+GRID
+
+DXV
+  {}*100 /
+
+DYV
+  {}*100 /
+
+DZV
+  {}*{} /
+
+TOPS
+  {}*{} /
+
+PORO
+  {}*0.25 /
+
+PERMX
+  {}*100 /
+
+COPY
+  'PERMX' 'PERMY' /
+  'PERMX' 'PERMZ' /
+/
+)", dims.nx, dims.ny, dims.nz, layerThickness,
+    dims.columns(), topDepth, dims.cells(), dims.cells());
+}
+
+std::string propsAndSolutionSections()
+{
+    return R"(
+PROPS
+
+SWOF
+  0 0 1 0
+  1 1 0 0 /
+
+SGOF
+  0 0 1 0
+  1 1 0 0 /
+
+PVTW
+  100 1.0 1.0E-5 0.2 0.0 /
+
+PVDO
+    1.01325  1.0    1.0
+  800.0      0.9999 1.0001 /
+
+PVDG
+    1.01325  1.0    0.01
+  800.0      0.01   0.02 /
+
+SOLUTION
+
+EQUIL
+  2525.0 270 2700 0.0 2525.0 0.0 /
+)";
+}
+
+std::string summarySection(const ModelSize& size)
+{
+    auto summary = std::string { R"(
+SUMMARY
+
+FOPR
+FOPT
+FWPR
+FGPR
+FWIR
+
+GOPR
+/
+GWPR
+/
+
+WOPR
+/
+WWPR
+/
+WGPR
+/
+WWIR
+/
+WBHP
+/
+)" };
+
+    if (multiSegment(size)) {
+        summary += "\nSOFR\n/\nSPR\n/\n";
+    }
+
+    for (auto udq = 0*size.udqs; udq < size.udqs; ++udq) {
+        summary += (udq % 2 == 0)
+            ? fmt::format("\n{}\n/\n", udqName(udq))
+            : fmt::format("\n{}\n", udqName(udq));
+    }
+
+    return summary;
+}
+
+std::string wellSegments(const ModelSize& size, const GridDims& dims,
+                         const std::string& well,
+                         const std::size_t i, const std::size_t j)
+{
+    const auto segmentLength = dims.nz * layerThickness / (size.segments - 1);
+
+    auto msw = fmt::format(R"(
+WELSEGS
+  '{}' {} 0.0 1.0E-5 'INC' 'HFA' 'HO' /
+  2 {} 1 1 {} {} 0.1 1.0E-5 /
+/
+
+COMPSEGS
+  '{}' /
+)", well, topDepth, size.segments, segmentLength, segmentLength, well);
+
+    for (auto k = 0*dims.nz; k < dims.nz; ++k) {
+        msw += fmt::format("  {} {} {} 1 {} {} /\n", i, j, k + 1,
+                           k * layerThickness, (k + 1) * layerThickness);
+    }
+
+    return msw + "/\n";
+}
+
+std::string scheduleSection(const ModelSize& size, const GridDims& dims)
+{
+    auto schedule = std::string { "\nSCHEDULE\n\nRPTRST\n  'BASIC=2' /\n\nGRUPTREE\n" };
+    for (auto group = 0*size.groups; group < size.groups; ++group) {
+        schedule += fmt::format("  '{}' 'FIELD' /\n", groupName(group));
+    }
+    schedule += "/\n";
+
+    // Spread the wells evenly over the grid columns.
+    auto location = [&size, &dims](const std::size_t well)
+    {
+        const auto column = (well * dims.columns()) / size.wells;
+        return std::pair { column % dims.nx + 1, column / dims.nx + 1 };
+    };
+
+    schedule += "\nWELSPECS\n";
+    for (auto well = 0*size.wells; well < size.wells; ++well) {
+        const auto [i, j] = location(well);
+        schedule += fmt::format("  '{}' '{}' {} {} 1* '{}' /\n",
+                                wellName(well), groupName(well % size.groups),
+                                i, j, isInjector(well) ? "WATER" : "OIL");
+    }
+    schedule += "/\n\nCOMPDAT\n";
+    for (auto well = 0*size.wells; well < size.wells; ++well) {
+        const auto [i, j] = location(well);
+        schedule += fmt::format("  '{}' {} {} 1 {} 'OPEN' 1* 1* 0.2 /\n",
+                                wellName(well), i, j, dims.nz);
+    }
+    schedule += "/\n";
+
+    if (multiSegment(size)) {
+        for (auto well = 0*size.wells; well < size.wells; ++well) {
+            if (! isInjector(well)) {
+                const auto [i, j] = location(well);
+                schedule += wellSegments(size, dims, wellName(well), i, j);
+            }
+        }
+    }
+
+    schedule += "\nWCONPROD\n  'P*' 'OPEN' 'ORAT' 1000 /\n/\n";
+    if (size.wells > 3) {
+        schedule += "\nWCONINJE\n  'I*' 'WATER' 'OPEN' 'RATE' 1000 1* 400 /\n/\n";
+    }
+
+    schedule += "\nWRFTPLT\n  '*' 'REPT' /\n/\n";
+
+    if (size.udqs > 0) {
+        schedule += "\nUDQ\n";
+        for (auto udq = 0*size.udqs; udq < size.udqs; ++udq) {
+            schedule += (udq % 2 == 0)
+                ? fmt::format("  DEFINE {} WOPR 'P*' * {} + WWPR 'P*' /\n", udqName(udq), udq + 1)
+                : fmt::format("  DEFINE {} SUM(WOPR 'P*') + {} * FWPR /\n", udqName(udq), udq + 1);
+        }
+        schedule += "/\n";
+    }
+
+    // The conditions are never satisfied, so every block is evaluated at
+    // every report step without changing the schedule.
+    for (auto action = 0*size.actions; action < size.actions; ++action) {
+        schedule += fmt::format(R"(
+ACTIONX
+  'A{:04d}' 100000 /
+  WOPR 'P*' > 1.0E20 /
+/
+WELOPEN
+  '{}' 'OPEN' /
+/
+ENDACTIO
+)", action + 1, wellName(0));
+    }
+
+    return schedule + fmt::format("\nTSTEP\n  {}*30 /\n", size.steps);
+}
+
+std::string syntheticDeck(const ModelSize& size, const GridDims& dims)
+{
+    return runspecSection(size, dims)
+        + gridSection(dims)
+        + propsAndSolutionSections()
+        + summarySection(size)
+        + scheduleSection(size, dims);
+}
+
+// -----------------------------------------------------------------------
+// Synthetic simulator results
+
+double oilRate(const Opm::EclipseState& es, const Opm::Schedule&, const Opm::SummaryState&,
+               const Opm::data::Solution&, std::size_t, double seconds_elapsed)
+{
+    return -es.getUnits().to_si(Opm::UnitSystem::measure::rate, 100.0 + seconds_elapsed / 86400.0);
+}
+
+double waterRate(const Opm::EclipseState& es, const Opm::Schedule&, const Opm::SummaryState&,
+                 const Opm::data::Solution&, std::size_t, double seconds_elapsed)
+{
+    return -es.getUnits().to_si(Opm::UnitSystem::measure::rate, seconds_elapsed / 86400.0);
+}
+
+double gasRate(const Opm::EclipseState& es, const Opm::Schedule&, const Opm::SummaryState&,
+               const Opm::data::Solution&, std::size_t, double)
+{
+    return -es.getUnits().to_si(Opm::UnitSystem::measure::gas_surface_rate, 1000.0);
+}
+
+double injectionRate(const Opm::EclipseState& es, const Opm::Schedule&, const Opm::SummaryState&,
+                     const Opm::data::Solution&, std::size_t, double)
+{
+    return es.getUnits().to_si(Opm::UnitSystem::measure::rate, 500.0);
+}
+
+void fillSolution(Opm::data::Solution& sol, const std::string& name,
+                  const Opm::UnitSystem::measure m, const std::size_t numCells,
+                  const double value)
+{
+    if (! sol.has(name)) {
+        sol.insert(name, m, std::vector<double>(numCells),
+                   Opm::data::TargetType::RESTART_SOLUTION);
+    }
+
+    auto& data = sol.data<double>(name);
+    std::fill(data.begin(), data.end(), value);
+}
+
+void solution(const Opm::EclipseState& es, const Opm::Schedule&, Opm::data::Solution& sol,
+              std::size_t, double seconds_elapsed)
+{
+    const auto numCells = es.getInputGrid().getNumActive();
+    const auto& units = es.getUnits();
+
+    fillSolution(sol, "PRESSURE", Opm::UnitSystem::measure::pressure, numCells,
+                 units.to_si(Opm::UnitSystem::measure::pressure, 250.0 - seconds_elapsed / 86400.0 / 100.0));
+    fillSolution(sol, "SWAT", Opm::UnitSystem::measure::identity, numCells, 0.2);
+    fillSolution(sol, "SGAS", Opm::UnitSystem::measure::identity, numCells, 0.1);
+}
+
+// -----------------------------------------------------------------------
+// Stage timing
+
+enum Stage : std::size_t {
+    SummaryEval, UDQEval, SummaryWrite, RestartSave, RFTWrite, ActionXEval, NumStages,
+};
+
+constexpr std::array<const char*, NumStages> stageNames {
+    "summary_eval", "udq_eval", "summary_write", "restart_save", "rft_write", "actionx_eval",
+};
+
+class StageTimes
+{
+public:
+    template <class Function>
+    void time(const Stage stage, Function&& f)
+    {
+        const auto start = std::chrono::steady_clock::now();
+        f();
+        const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+        this->times_[stage].back() += elapsed.count();
+    }
+
+    void beginStep()
+    {
+        for (auto& stage : this->times_) {
+            stage.push_back(0.0);
+        }
+    }
+
+    std::string json(const ModelSize& size, const GridDims& dims) const
+    {
+        auto out = fmt::format(R"({{
+  "model": {{
+    "cells": {}, "nx": {}, "ny": {}, "nz": {},
+    "wells": {}, "groups": {}, "segments": {}, "udqs": {}, "actions": {},
+    "report_steps": {}
+  }},
+  "stages": {{
+)", dims.cells(), dims.nx, dims.ny, dims.nz,
+    size.wells, size.groups, multiSegment(size) ? size.segments : 0,
+    size.udqs, size.actions, size.steps);
+
+        for (auto stage = 0*this->times_.size(); stage < this->times_.size(); ++stage) {
+            const auto& steps = this->times_[stage];
+            out += fmt::format("    \"{}\": {{ \"total\": {:.6e}, \"steps\": [{:.6e}] }}{}\n",
+                               stageNames[stage],
+                               std::accumulate(steps.begin(), steps.end(), 0.0),
+                               fmt::join(steps, ", "),
+                               (stage + 1 < this->times_.size()) ? "," : "");
+        }
+
+        return out + "  }\n}\n";
+    }
+
+private:
+    std::array<std::vector<double>, NumStages> times_{};
+};
+
+// -----------------------------------------------------------------------
+// Benchmark driver.  Mirrors msim::run() and EclipseIO::writeTimeStep(),
+// but with each output stage timed separately.
+
+StageTimes runBenchmark(const Opm::EclipseState& es,
+                        const Opm::Schedule& schedule,
+                        Opm::SummaryConfig& summary_config)
+{
+    Opm::msim msim(es, schedule);
+    for (const auto& name : schedule.wellNames()) {
+        if (name.front() == 'I') {
+            msim.well_rate(name, Opm::data::Rates::opt::wat, injectionRate);
+        }
+        else {
+            msim.well_rate(name, Opm::data::Rates::opt::oil, oilRate);
+            msim.well_rate(name, Opm::data::Rates::opt::wat, waterRate);
+            msim.well_rate(name, Opm::data::Rates::opt::gas, gasRate);
+        }
+    }
+    msim.solution("PRESSURE", solution);
+
+    const auto& grid = es.getInputGrid();
+    const auto& ioConfig = es.getIOConfig();
+    const auto resultSet = Opm::EclIO::OutputStream::ResultSet {
+        ioConfig.getOutputDir(), ioConfig.getBaseName()
+    };
+    const auto formatted = Opm::EclIO::OutputStream::Formatted { ioConfig.getFMTOUT() };
+
+    Opm::out::Summary summary(summary_config, es, grid, schedule, ioConfig.getBaseName());
+    Opm::UDQState udq_state(schedule.getUDQConfig(0).params().undefinedValue());
+    Opm::WellTestState wtest_state;
+    std::optional<Opm::RestartIO::Helpers::AggregateAquiferData> aquiferData{};
+
+    Opm::data::Solution sol;
+    StageTimes times;
+
+    const auto first_rft = schedule.first_RFT();
+    for (std::size_t report_step = 1; report_step < schedule.size(); ++report_step) {
+        times.beginStep();
+
+        Opm::data::Wells well_data;
+        Opm::data::GroupAndNetworkValues group_nwrk_data;
+
+        const double seconds_elapsed = schedule.seconds(report_step);
+        msim.simulate(sol, well_data, group_nwrk_data, report_step,
+                      schedule.seconds(report_step - 1),
+                      seconds_elapsed - schedule.seconds(report_step - 1));
+
+        times.time(SummaryEval, [&]() {
+            summary.eval(msim.st, report_step, seconds_elapsed, well_data,
+                         /* wbp = */ {}, group_nwrk_data,
+                         /* single_values = */ {},
+                         /* initial_inplace = */ {},
+                         /* inplace = */ {});
+        });
+
+        times.time(UDQEval, [&]() {
+            msim.schedule.getUDQConfig(report_step - 1)
+                .eval(report_step,
+                      msim.schedule.wellMatcher(report_step),
+                      msim.schedule[report_step].group_order(),
+                      msim.schedule.segmentMatcherFactory(report_step),
+                      Opm::msim::createRegionSetMatcherFactory(es),
+                      msim.st, udq_state);
+        });
+
+        times.time(SummaryWrite, [&]() {
+            summary.add_timestep(msim.st, report_step, true);
+            summary.write(report_step + 1 == schedule.size());
+        });
+
+        if (msim.schedule.write_rst_file(report_step)) {
+            times.time(RestartSave, [&]() {
+                Opm::EclIO::OutputStream::Restart rstFile {
+                    resultSet, static_cast<int>(report_step), formatted,
+                    Opm::EclIO::OutputStream::Unified { ioConfig.getUNIFOUT() }
+                };
+
+                Opm::RestartIO::save(rstFile, report_step, seconds_elapsed,
+                                     Opm::RestartValue(sol, well_data, group_nwrk_data, {}),
+                                     es, grid, msim.schedule, msim.action_state,
+                                     wtest_state, msim.st, udq_state, aquiferData);
+            });
+        }
+
+        if (first_rft.has_value() && (report_step >= first_rft.value())) {
+            times.time(RFTWrite, [&]() {
+                Opm::EclIO::OutputStream::RFT rftFile {
+                    resultSet, formatted,
+                    Opm::EclIO::OutputStream::RFT::OpenExisting { report_step > first_rft.value() }
+                };
+
+                Opm::RftIO::write(report_step, seconds_elapsed, es.getUnits(),
+                                  grid, msim.schedule, well_data, rftFile);
+            });
+        }
+
+        times.time(ActionXEval, [&]() {
+            msim.post_step(sol, well_data, group_nwrk_data, report_step,
+                           Opm::TimeService::from_time_t(msim.schedule.simTime(report_step)));
+        });
+    }
+
+    return times;
+}
+
+void printUsage(std::ostream& os)
+{
+    os << R"(Usage: msim_benchmark [options]
+
+Generates a synthetic model, runs it through msim and prints the time
+spent in each output stage at each report step as JSON.
+
+Options:
+  -c <n>    Approximate number of grid cells (default 100000)
+  -w <n>    Number of wells; every fourth well is an injector (default 100)
+  -g <n>    Number of well groups (default 10)
+  -s <n>    Number of segments of each producer; less than 2 for
+            standard wells (default 0)
+  -u <n>    Number of UDQs (default 10)
+  -a <n>    Number of ACTIONX blocks (default 10)
+  -n <n>    Number of report steps (default 10)
+  -d <dir>  Directory for the generated deck and output files (default .)
+  -o <file> Write JSON to <file> instead of standard output
+  -h        Print this help
+)";
+}
+
+} // Anonymous namespace
+
+int main(int argc, char** argv)
+{
+    auto size = ModelSize{};
+    auto outputDir = std::filesystem::path { "." };
+    auto jsonFile = std::string{};
+
+    int c = 0;
+    while ((c = getopt(argc, argv, "a:c:d:g:hn:o:s:u:w:")) != -1) {
+        switch (c) {
+        case 'a': size.actions = std::stoul(optarg); break;
+        case 'c': size.cells = std::stoul(optarg); break;
+        case 'd': outputDir = optarg; break;
+        case 'g': size.groups = std::stoul(optarg); break;
+        case 'n': size.steps = std::stoul(optarg); break;
+        case 'o': jsonFile = optarg; break;
+        case 's': size.segments = std::stoul(optarg); break;
+        case 'u': size.udqs = std::stoul(optarg); break;
+        case 'w': size.wells = std::stoul(optarg); break;
+        case 'h':
+            printUsage(std::cout);
+            return EXIT_SUCCESS;
+        default:
+            printUsage(std::cerr);
+            return EXIT_FAILURE;
+        }
+    }
+
+    if ((size.cells == 0) || (size.wells == 0) || (size.groups == 0) || (size.steps == 0)) {
+        std::cerr << "Cells, wells, groups and report steps must be positive\n";
+        return EXIT_FAILURE;
+    }
+
+    const auto dims = gridDims(size.cells);
+
+    std::filesystem::create_directories(outputDir);
+    const auto deckFile = outputDir / "MSIM_BENCHMARK.DATA";
+    std::ofstream { deckFile } << syntheticDeck(size, dims);
+
+    Opm::OpmLog::setupSimpleDefaultLogging();
+
+    Opm::Parser parser;
+    Opm::ParseContext parse_context;
+    Opm::ErrorGuard error_guard;
+    auto python = std::make_shared<Opm::Python>();
+
+    const auto deck = parser.parseFile(deckFile.generic_string(), parse_context, error_guard);
+    const Opm::EclipseState state(deck);
+    const Opm::Schedule schedule(deck, state, parse_context, error_guard, python);
+    Opm::SummaryConfig summary_config(deck, schedule, state.fieldProps(), state.aquifer(),
+                                      parse_context, error_guard);
+
+    if (error_guard) {
+        error_guard.dump();
+        error_guard.terminate();
+    }
+
+    const auto json = runBenchmark(state, schedule, summary_config).json(size, dims);
+
+    if (jsonFile.empty()) {
+        std::cout << json;
+    }
+    else {
+        std::ofstream { jsonFile } << json;
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -90,6 +90,12 @@ inline void loadDeck(const char* deck_file)
               << "   schedule.: " << std::chrono::duration<double>(schedule_time).count()  << " seconds\n"
               << "   summary..: " << std::chrono::duration<double>(summary_time).count()  << " seconds"
               << std::endl;
+
+    std::cout << "\nEclipseState stages:\n";
+    for (const auto& [stage, seconds] : state.constructionTimings()) {
+        std::cout << "   " << std::left << std::setw(30) << stage << ": " << seconds << " seconds\n";
+    }
+    std::cout.flush();
 }
 
 } // Anonymous namespace
@@ -25,6 +25,7 @@ class EclipseIO;
 class ParseContext;
 class Parser;
 class Python;
+class RegionSetMatcher;
 class UDQState;
 class WellTestState;
 
@@ -42,6 +43,12 @@ public:
     void solution(const std::string& field, std::function<solution_function> func);
     void run(EclipseIO& io, bool report_only);
     void post_step(data::Solution& sol, data::Wells& well_data, data::GroupAndNetworkValues& group_nwrk_data, size_t report_step, const time_point& sim_time);
+    void simulate(data::Solution& sol, data::Wells& well_data, data::GroupAndNetworkValues& group_nwrk_data, size_t report_step, double seconds_elapsed, double time_step);
+
+    // Region set matcher factory for the summary evaluation of 'es', as
+    // used by run().  The EclipseState must outlive the factory.
+    static std::function<std::unique_ptr<RegionSetMatcher>()>
+    createRegionSetMatcherFactory(const EclipseState& es);
 
 private:
     void run_step(const WellTestState& wtest_state,
@@ -65,7 +72,6 @@ private:
                 size_t report_step, bool substep, double seconds_elapsed,
                 const data::Solution& sol, const data::Wells& well_data,
                 const data::GroupAndNetworkValues& group_data, EclipseIO& io);
-    void simulate(data::Solution& sol, data::Wells& well_data, data::GroupAndNetworkValues& group_nwrk_data, size_t report_step, double seconds_elapsed, double time_step);
 
     EclipseState state;
     std::map<std::string, std::map<data::Rates::opt, std::function<well_rate_function>>> well_rates;
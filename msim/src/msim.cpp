@@ -57,23 +57,21 @@
 #include <string>
 #include <utility>
 
-namespace {
-    std::function<std::unique_ptr<Opm::RegionSetMatcher>()>
-    createRegionSetMatcherFactory(const Opm::EclipseState& es)
-    {
-        return {
-            [es = std::cref(es)]() {
-                return std::make_unique<Opm::RegionSetMatcher>
-                    (es.get().fipRegionStatistics());
-            }
-        };
-    }
-} // Anonymous namespace
-
 namespace Opm {
 
 std::shared_ptr<Python> msim::python = std::make_shared<Python>();
 
+std::function<std::unique_ptr<RegionSetMatcher>()>
+msim::createRegionSetMatcherFactory(const EclipseState& es)
+{
+    return {
+        [es = std::cref(es)]() {
+            return std::make_unique<RegionSetMatcher>
+                (es.get().fipRegionStatistics());
+        }
+    };
+}
+
 msim::msim(const EclipseState& state_arg, const Schedule& schedule_arg)
     : state   (state_arg)
     , schedule(schedule_arg)
@@ -10,6 +10,8 @@ set (opm-common_CONFIG_VAR
 	HAVE_ECL_INPUT
 	HAVE_CXA_DEMANGLE
 	HAVE_FNMATCH_H
+	OPM_DENSEAD_SIMD
+	OPM_DENSEAD_SIMD_BYTES
 	)
 
 # dependencies
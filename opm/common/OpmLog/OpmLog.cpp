@@ -21,6 +21,7 @@
 #include <opm/common/OpmLog/Logger.hpp>
 #include <opm/common/OpmLog/StreamLog.hpp>
 #include <iostream>
+#include <mutex>
 #include <errno.h>  // For errno
 #include <stdio.h>  // For fileno() and stdout
 
@@ -38,6 +39,13 @@
 #include <unistd.h> // For isatty()
 #endif
 
+namespace {
+
+    // Serialises messages from concurrent parts of the input processing.
+    std::mutex message_mutex;
+
+} // Anonymous namespace
+
 namespace Opm {
 
     bool OpmLog::stdoutIsTerminal()
@@ -73,14 +81,18 @@ namespace Opm {
 
 
     void OpmLog::addMessage(int64_t messageFlag , const std::string& message) {
-        if (m_logger)
+        if (m_logger) {
+            std::lock_guard<std::mutex> guard(message_mutex);
             m_logger->addMessage( messageFlag , message );
+        }
     }
 
 
     void OpmLog::addTaggedMessage(int64_t messageFlag, const std::string& tag, const std::string& message) {
-        if (m_logger)
+        if (m_logger) {
+            std::lock_guard<std::mutex> guard(message_mutex);
             m_logger->addTaggedMessage( messageFlag, tag, message );
+        }
     }
 
 
@@ -0,0 +1,134 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#include <opm/common/utility/ConcurrentTasks.hpp>
+
+#include <chrono>
+#include <exception>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+namespace {
+
+    void rethrowFirst(const std::vector<std::exception_ptr>& errors)
+    {
+        for (const auto& error : errors) {
+            if (error) {
+                std::rethrow_exception(error);
+            }
+        }
+    }
+
+    // Run 'spawn', which creates OpenMP tasks, such that the tasks are
+    // executed by a thread team.  Reuses the current team if there is one.
+    template <typename Spawn>
+    void inThreadTeam(Spawn&& spawn)
+    {
+#ifdef _OPENMP
+        if (omp_in_parallel()) {
+            spawn();
+        }
+        else {
+            #pragma omp parallel
+            #pragma omp single
+            spawn();
+        }
+#else
+        spawn();
+#endif
+    }
+
+} // Anonymous namespace
+
+std::vector<double>
+Opm::runConcurrently(const std::vector<std::function<void()>>& tasks)
+{
+    std::vector<double> elapsed(tasks.size(), 0.0);
+    std::vector<std::exception_ptr> errors(tasks.size());
+
+    const auto run = [&tasks, &elapsed, &errors](const std::size_t task)
+    {
+        const auto start = std::chrono::steady_clock::now();
+        try {
+            tasks[task]();
+        }
+        catch (...) {
+            errors[task] = std::current_exception();
+        }
+        elapsed[task] = std::chrono::duration<double>
+            (std::chrono::steady_clock::now() - start).count();
+    };
+
+    if (tasks.size() < 2) {
+        for (auto task = 0*tasks.size(); task < tasks.size(); ++task) {
+            run(task);
+        }
+    }
+    else {
+        inThreadTeam([&run, num_tasks = tasks.size()]()
+        {
+            for (auto task = 0*num_tasks; task < num_tasks; ++task) {
+                #pragma omp task default(shared) firstprivate(task)
+                run(task);
+            }
+
+            #pragma omp taskwait
+        });
+    }
+
+    rethrowFirst(errors);
+
+    return elapsed;
+}
+
+void Opm::forEachConcurrently(const std::size_t n,
+                              const std::function<void(std::size_t)>& body)
+{
+    std::vector<std::exception_ptr> errors(n);
+
+    const auto run = [&body, &errors](const std::size_t i)
+    {
+        try {
+            body(i);
+        }
+        catch (...) {
+            errors[i] = std::current_exception();
+        }
+    };
+
+    if (n < 2) {
+        for (auto i = 0*n; i < n; ++i) {
+            run(i);
+        }
+    }
+    else {
+        inThreadTeam([&run, n]()
+        {
+            #pragma omp taskloop default(shared)
+            for (std::size_t i = 0; i < n; ++i) {
+                run(i);
+            }
+        });
+    }
+
+    rethrowFirst(errors);
+}
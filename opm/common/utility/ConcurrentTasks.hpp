@@ -0,0 +1,49 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#ifndef OPM_CONCURRENT_TASKS_HPP
+#define OPM_CONCURRENT_TASKS_HPP
+
+#include <cstddef>
+#include <functional>
+#include <vector>
+
+namespace Opm {
+
+/// Run independent tasks, as OpenMP tasks if OpenMP is enabled and
+/// sequentially otherwise.  May be called from within another task, in
+/// which case the nested tasks share the enclosing thread team.
+///
+/// Exceptions thrown by the tasks are rethrown, in task order, once all
+/// tasks have completed.
+///
+/// \return Wall clock time, in seconds, of each task.
+std::vector<double> runConcurrently(const std::vector<std::function<void()>>& tasks);
+
+/// Call body(i) for all i in [0, n), concurrently if OpenMP is enabled.
+///
+/// Exceptions are rethrown, in index order, once all calls have completed.
+/// Intended for fairly coarse grained work such as one table per call;
+/// use a plain OpenMP loop for per-cell work.
+void forEachConcurrently(std::size_t n, const std::function<void(std::size_t)>& body);
+
+} // namespace Opm
+
+#endif // OPM_CONCURRENT_TASKS_HPP
@@ -0,0 +1,93 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef OPM_RELAXED_COUNTER_HPP
+#define OPM_RELAXED_COUNTER_HPP
+
+#include <atomic>
+#include <cstddef>
+
+namespace Opm {
+
+/// Copyable counter which may be incremented concurrently.
+///
+/// Intended for bookkeeping counters--e.g., "has this object been used"
+/// --which are updated from const member functions.  Increments impose no
+/// ordering on other memory operations.
+class RelaxedCounter
+{
+public:
+    RelaxedCounter() = default;
+
+    RelaxedCounter(const std::size_t value)
+        : count_{ value }
+    {}
+
+    RelaxedCounter(const RelaxedCounter& rhs)
+        : count_{ rhs.value() }
+    {}
+
+    RelaxedCounter& operator=(const RelaxedCounter& rhs)
+    {
+        this->count_.store(rhs.value(), std::memory_order_relaxed);
+        return *this;
+    }
+
+    RelaxedCounter& operator=(const std::size_t value)
+    {
+        this->count_.store(value, std::memory_order_relaxed);
+        return *this;
+    }
+
+    /// Increment counter.  Returns previous value.
+    std::size_t operator++(int)
+    {
+        return this->count_.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    std::size_t value() const
+    {
+        return this->count_.load(std::memory_order_relaxed);
+    }
+
+    operator std::size_t() const
+    {
+        return this->value();
+    }
+
+    bool operator==(const RelaxedCounter& rhs) const
+    {
+        return this->value() == rhs.value();
+    }
+
+    template <class Serializer>
+    void serializeOp(Serializer& serializer)
+    {
+        auto count = this->value();
+        serializer(count);
+        this->count_.store(count, std::memory_order_relaxed);
+    }
+
+private:
+    std::atomic<std::size_t> count_{0};
+};
+
+} // namespace Opm
+
+#endif // OPM_RELAXED_COUNTER_HPP
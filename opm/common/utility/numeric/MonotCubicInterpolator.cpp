@@ -32,6 +32,7 @@
 
 #include "config.h"
 #include <opm/common/utility/numeric/MonotCubicInterpolator.hpp>
+#include <opm/common/utility/numeric/findSegments.hpp>
 
 #include <algorithm>
 #include <cmath>
@@ -241,6 +242,113 @@ evaluate(double x) const {
 //    return x;
 // }
 
+void
+MonotCubicInterpolator::
+evaluate(const vector<double>& x, vector<double>& f) const {
+  evaluateBatch_<false>(x, f, nullptr);
+}
+
+
+void
+MonotCubicInterpolator::
+evaluate(const vector<double>& x, vector<double>& f, vector<double>& dfdx) const {
+  evaluateBatch_<true>(x, f, &dfdx);
+}
+
+
+template <bool computeDerivative>
+void
+MonotCubicInterpolator::
+evaluateBatch_(const vector<double>& x, vector<double>& f, vector<double>* dfdx) const {
+
+  for (const double xval : x) {
+    if (std::isnan(xval) || std::isinf(xval)) {
+      throw("MonotCubicInterpolator: evaluate() received inf/nan input.");
+    }
+  }
+
+  f.resize(x.size());
+  if constexpr (computeDerivative) {
+    dfdx->resize(x.size());
+  }
+  if (x.empty()) {
+    return;
+  }
+
+  // Flat copies of the data, in the order of ascending x
+  const vector<double> xdata = get_xVector();
+  const vector<double> fdata = get_fVector();
+  vector<double> ddata_flat;
+  const bool cubic = (ddata.size() == data.size());
+  if (cubic) {
+    ddata_flat.reserve(ddata.size());
+    for (const auto& xd : ddata) {
+      ddata_flat.push_back(xd.second);
+    }
+  }
+
+  // No interval to interpolate in; a single data point is constant (!!)
+  if (xdata.size() < 2) {
+    if (xdata.empty()) {
+      throw("MonotCubicInterpolator: evaluate() empty data.");
+    }
+    std::fill(f.begin(), f.end(), fdata.front());
+    if constexpr (computeDerivative) {
+      std::fill(dfdx->begin(), dfdx->end(), 0.0);
+    }
+    return;
+  }
+
+  // Interval j is (xdata[j], xdata[j+1]]
+  vector<std::size_t> interval(x.size());
+  findSegments</*rightClosed=*/true>(xdata.data(), xdata.size(),
+                                     x.data(), x.size(), interval.data());
+
+  for (std::size_t k = 0; k < x.size(); ++k) {
+    // Constant extrapolation (!!)
+    if (x[k] < xdata.front() || x[k] > xdata.back()) {
+      f[k] = (x[k] < xdata.front()) ? fdata.front() : fdata.back();
+      if constexpr (computeDerivative) {
+        (*dfdx)[k] = 0.0;
+      }
+      continue;
+    }
+
+    const std::size_t j = interval[k];
+    const double x1 = xdata[j];
+    const double x2 = xdata[j + 1];
+    const double f1 = fdata[j];
+    const double f2 = fdata[j + 1];
+
+    if (!cubic) {
+      // Linear interpolation if derivative data is not available
+      f[k] = f1 + (f2 - f1) / (x2 - x1) * (x[k] - x1);
+      if constexpr (computeDerivative) {
+        (*dfdx)[k] = (f2 - f1) / (x2 - x1);
+      }
+    }
+    else {
+      const double t = (x[k] - x1)/(x2 - x1); // t \in [0,1]
+      const double h = x2 - x1;
+      const double d1 = ddata_flat[j];
+      const double d2 = ddata_flat[j + 1];
+      f[k]
+        = f1 * H00(t)
+        + d1 * H10(t) * h
+        + f2 * H01(t)
+        + d2 * H11(t) * h ;
+      if constexpr (computeDerivative) {
+        (*dfdx)[k]
+          = (f1 * H00prime(t)
+             + d1 * H10prime(t) * h
+             + f2 * H01prime(t)
+             + d2 * H11prime(t) * h) / h;
+      }
+    }
+  }
+}
+
+
 vector<double>
 MonotCubicInterpolator::
 get_xVector() const
@@ -227,6 +227,33 @@ class MonotCubicInterpolator {
    */
    double evaluate(double x, double & errorestimate_output ) const ;
 
+   /**
+      @param x x values
+      @param f f(x) for each of the x values (output)
+
+      Evaluates the interpolant at a batch of x values, with the same
+      results as evaluate(double) for each of them.
+
+      The intervals of sorted x values are found by walking along the
+      data points, those of unsorted x values by a branch free
+      bisection. The data points are copied into flat arrays once per
+      call, so batches should be large compared to the data.
+   */
+   void evaluate(const std::vector<double>& x, std::vector<double>& f) const;
+
+   /**
+      @param x x values
+      @param f f(x) for each of the x values (output)
+      @param dfdx f'(x) for each of the x values (output)
+
+      As evaluate(const std::vector<double>&, std::vector<double>&),
+      also returning the derivative of the interpolant. The derivative
+      is zero where the interpolant is extrapolated by a constant.
+   */
+   void evaluate(const std::vector<double>& x,
+                 std::vector<double>& f,
+                 std::vector<double>& dfdx) const;
+
    /**
       Minimum x-value, returns both x and f in a pair.
 
@@ -536,6 +563,26 @@ private:
        return t*t*t - t*t;
    }
 
+   /* Derivatives of the Hermite basis functions with respect to t */
+
+   double H00prime(double t) const {
+       return 6*t*t - 6*t;
+   }
+   double H10prime(double t) const {
+       return 3*t*t - 4*t + 1;
+   }
+   double H01prime(double t) const {
+       return -6*t*t + 6*t;
+   }
+   double H11prime(double t) const {
+       return 3*t*t - 2*t;
+   }
+
+   template <bool computeDerivative>
+   void evaluateBatch_(const std::vector<double>& x,
+                       std::vector<double>& f,
+                       std::vector<double>* dfdx) const;
+
 
    void computeInternalFunctionData() const ;
 
@@ -0,0 +1,103 @@
+/*
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef OPM_FIND_SEGMENTS_HEADER_INCLUDED
+#define OPM_FIND_SEGMENTS_HEADER_INCLUDED
+
+#include <algorithm>
+#include <cstddef>
+
+namespace Opm {
+
+namespace detail {
+
+//! \brief Number of the given knots which lie below x.
+//! \details The number of steps only depends on the number of knots, and
+//!          each step is a conditional move, so that the searches for
+//!          consecutive values overlap in the processor instead of stalling
+//!          on mispredicted branches.
+template <bool rightClosed, class Scalar>
+std::size_t countKnotsBelow(const Scalar* knots, std::size_t numKnots, const Scalar x)
+{
+    const auto below = [x](const Scalar knot)
+    { return rightClosed ? knot < x : knot <= x; };
+
+    const Scalar* base = knots;
+    while (numKnots > 1) {
+        const std::size_t half = numKnots / 2;
+        base = below(base[half]) ? base + half : base;
+        numKnots -= half;
+    }
+    return static_cast<std::size_t>(base - knots) + below(*base);
+}
+
+} // namespace detail
+
+//! \brief Locate the segments of a piecewise defined function which contain
+//!        each of a batch of values.
+//!
+//! \details The segment i is [knots[i], knots[i+1]), or (knots[i], knots[i+1]]
+//!          if rightClosed is true. Values outside the knots are assigned to
+//!          the first or last segment. The knots must be ascending.
+//!
+//!          If the values are sorted, the segments are found by a single walk
+//!          along the knots. Otherwise, each value is located by a branch
+//!          free bisection.
+//!
+//! \param[in]  knots    Ascending abscissas of the function.
+//! \param[in]  numKnots Number of knots, at least one.
+//! \param[in]  x        Values to locate.
+//! \param[in]  n        Number of values.
+//! \param[out] segments Segment index of each value, in [0, max(numKnots-2, 0)].
+template <bool rightClosed = false, class Scalar>
+void findSegments(const Scalar* knots, const std::size_t numKnots,
+                  const Scalar* x, const std::size_t n,
+                  std::size_t* segments)
+{
+    if (numKnots < 3) {
+        std::fill(segments, segments + n, std::size_t{0});
+        return;
+    }
+
+    // The segment of x is the number of interior knots below it.
+    const Scalar* interior = knots + 1;
+    const std::size_t numInterior = numKnots - 2;
+
+    if (std::is_sorted(x, x + n)) {
+        const auto below = [](const Scalar knot, const Scalar value)
+        { return rightClosed ? knot < value : knot <= value; };
+
+        std::size_t segment = (n > 0)
+            ? detail::countKnotsBelow<rightClosed>(interior, numInterior, x[0])
+            : 0;
+        for (std::size_t k = 0; k < n; ++k) {
+            while (segment < numInterior && below(interior[segment], x[k])) {
+                ++segment;
+            }
+            segments[k] = segment;
+        }
+        return;
+    }
+
+    for (std::size_t k = 0; k < n; ++k) {
+        segments[k] = detail::countKnotsBelow<rightClosed>(interior, numInterior, x[k]);
+    }
+}
+
+} // namespace Opm
+
+#endif // OPM_FIND_SEGMENTS_HEADER_INCLUDED
@@ -51,13 +51,20 @@ std::size_t Deck::count(const std::string& keyword) const {
     return this->global_view().count(keyword);
 }
 
-const DeckView& Deck::global_view() const {
-    if (!this->m_global_view) {
-        this->m_global_view = std::make_unique<DeckView>();
-        for (const auto& kw : this->keywordList)
-            this->m_global_view->add_keyword(kw);
-    }
-    return *this->m_global_view;
+DeckView Deck::global_view() const {
+    return DeckView(this->m_index, 0, this->keywordList.size());
+}
+
+void Deck::reindex() {
+    // Views of the current index keep it alive; build a new one.
+    this->m_index = std::make_shared<DeckView::Index>();
+    for (const auto& kw : this->keywordList)
+        this->m_index->add(kw);
+}
+
+void Deck::remove_keywords(int from, int to) {
+    this->keywordList.erase(this->keywordList.begin() + from, this->keywordList.begin() + to);
+    this->reindex();
 }
 
     Opm::DeckView Deck::operator[](const std::string& keyword) const {
@@ -78,6 +85,7 @@ const DeckView& Deck::global_view() const {
         , file_tree( d.file_tree )
         , unit_system_access_count(d.unit_system_access_count)
     {
+        this->reindex();
     }
 
     Deck::Deck( Deck&& d )
@@ -88,6 +96,7 @@ const DeckView& Deck::global_view() const {
         , input_path( d.input_path )
         , file_tree( std::move(d.file_tree) )
         , unit_system_access_count(d.unit_system_access_count)
+        , m_index( std::exchange(d.m_index, std::make_shared<DeckView::Index>()) )
     {
     }
 
@@ -100,6 +109,7 @@ const DeckView& Deck::global_view() const {
         result.m_dataFile = "test1";
         result.input_path = "test2";
         result.unit_system_access_count = 1;
+        result.reindex();
 
         return result;
     }
@@ -114,8 +124,15 @@ const DeckView& Deck::global_view() const {
         else if (keyword.name() == "PVT-M")
             this->selectActiveUnitSystem( UnitSystem::UnitType::UNIT_TYPE_PVT_M );
 
+        const auto* storage = this->keywordList.data();
         this->keywordList.push_back( std::move( keyword ) );
-        this->m_global_view = nullptr;
+        if (this->keywordList.data() != storage) {
+            // Keywords were relocated; update the addresses held by the index.
+            std::transform(this->keywordList.begin(), std::prev(this->keywordList.end()),
+                           this->m_index->keywords.begin(),
+                           [](const auto& kw) { return &kw; });
+        }
+        this->m_index->add(this->keywordList.back());
     }
 
     void Deck::addKeyword( const DeckKeyword& keyword ) {
@@ -227,6 +244,7 @@ const DeckView& Deck::global_view() const {
         input_path = data.input_path;
         unit_system_access_count = data.unit_system_access_count;
         activeUnits = data.activeUnits;
+        this->reindex();
 
         return *this;
     }
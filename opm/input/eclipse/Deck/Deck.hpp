@@ -20,6 +20,8 @@
 #ifndef DECK_HPP
 #define DECK_HPP
 
+#include <opm/common/utility/RelaxedCounter.hpp>
+
 #include <opm/input/eclipse/Deck/DeckView.hpp>
 #include <opm/input/eclipse/Deck/DeckTree.hpp>
 #include <opm/input/eclipse/Deck/DeckKeyword.hpp>
@@ -82,6 +84,9 @@ namespace Opm {
             const_iterator begin() const;
             const_iterator end() const;
 
+            // View of all keywords.  Cheap; shares the deck's keyword index.
+            DeckView global_view() const;
+
             Opm::DeckView operator[](const std::string& keyword) const;
             const DeckKeyword& operator[](std::size_t index) const;
 
@@ -105,6 +110,9 @@ namespace Opm {
                 serializer(m_dataFile);
                 serializer(input_path);
                 serializer(unit_system_access_count);
+                if (!serializer.isSerializing()) {
+                    this->reindex();
+                }
             }
 
             bool hasKeyword( const std::string& keyword ) const;
@@ -126,7 +134,7 @@ namespace Opm {
             }
             size_t count(const std::string& keyword) const;
 
-            void remove_keywords(int from, int to) { keywordList.erase(keywordList.begin() +from, keywordList.begin() + to); };     
+            void remove_keywords(int from, int to);
 
         private:
 
@@ -137,10 +145,13 @@ namespace Opm {
             std::optional<std::string> m_dataFile;
             std::string input_path;
             DeckTree file_tree;
-            mutable std::size_t unit_system_access_count = 0;
+            mutable RelaxedCounter unit_system_access_count{};
+
+            // Keyword name -> positions index, maintained as keywords are
+            // added.  Shared with all views of this deck.
+            std::shared_ptr<DeckView::Index> m_index{std::make_shared<DeckView::Index>()};
 
-            const DeckView& global_view() const;
-            mutable std::unique_ptr<DeckView> m_global_view{nullptr};
+            void reindex();
     };
 }
 #endif  /* DECK_HPP */
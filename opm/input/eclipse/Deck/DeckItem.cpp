@@ -24,9 +24,11 @@
 
 #include <algorithm>
 #include <cmath>
+#include <memory>
 #include <ostream>
 #include <string>
 #include <stdexcept>
+#include <type_traits>
 
 namespace Opm {
 
@@ -42,13 +44,13 @@ const std::vector< int >& DeckItem::value_ref< int >() const {
     if( this->type != get_type< int >() )
         throw std::invalid_argument( "DeckItem::value_ref<int> Item of wrong type. this->type: " + tag_name(this->type) + " " + this->name());
 
-    return this->ival;
+    return std::get< std::vector< int > >( this->storage );
 }
 
 template<>
 const std::vector< double >& DeckItem::value_ref< double >() const {
     if (this->type == get_type<double>())
-        return this->dval;
+        return std::get< std::vector< double > >( this->storage );
 
     throw std::invalid_argument( "DeckItem::value_ref<double> Item of wrong type. this->type: " + tag_name(this->type) + " " + this->name());
 }
@@ -58,7 +60,7 @@ const std::vector< std::string >& DeckItem::value_ref< std::string >() const {
     if( this->type != get_type< std::string >() )
         throw std::invalid_argument( "DeckItem::value_ref<std::string> Item of wrong type. this->type: " + tag_name(this->type) + " " + this->name());
 
-    return this->sval;
+    return std::get< std::vector< std::string > >( this->storage );
 }
 
 template<>
@@ -66,7 +68,7 @@ const std::vector< RawString >& DeckItem::value_ref< RawString >() const {
     if( this->type != get_type< RawString >() )
         throw std::invalid_argument( "DeckItem::value_ref<RawString> Item of wrong type. this->type: " + tag_name(this->type) + " " + this->name());
 
-    return this->rsval;
+    return std::get< std::vector< RawString > >( this->storage );
 }
 
 template<>
@@ -74,23 +76,74 @@ const std::vector< UDAValue >& DeckItem::value_ref< UDAValue >() const {
     if( this->type != get_type< UDAValue >() )
         throw std::invalid_argument( "DeckItem::value_ref<UDAValue> Item of wrong type. this->type: " + tag_name(this->type) + " " + this->name());
 
-    return this->uval;
+    return std::get< std::vector< UDAValue > >( this->storage );
 }
 
 
+DeckItem::SIData::SIData(SIData&& other) noexcept
+    : data_(other.data_.exchange(nullptr, std::memory_order_acq_rel))
+{}
+
+DeckItem::SIData&
+DeckItem::SIData::operator=(const SIData& other)
+{
+    if (this != &other)
+        this->reset();
+
+    return *this;
+}
+
+DeckItem::SIData&
+DeckItem::SIData::operator=(SIData&& other) noexcept
+{
+    if (this != &other) {
+        this->reset();
+        this->data_.store(other.data_.exchange(nullptr, std::memory_order_acq_rel),
+                          std::memory_order_release);
+    }
+
+    return *this;
+}
+
+DeckItem::SIData::~SIData()
+{
+    this->reset();
+}
+
+const std::vector<double>&
+DeckItem::SIData::publish(std::unique_ptr<const std::vector<double>> values) const
+{
+    const std::vector<double>* expected = nullptr;
+    if (this->data_.compare_exchange_strong(expected, values.get(),
+                                            std::memory_order_acq_rel,
+                                            std::memory_order_acquire))
+        return *values.release();
+
+    // Another reader published first; its array is used and ours dropped.
+    return *expected;
+}
+
+void DeckItem::SIData::reset()
+{
+    delete this->data_.exchange(nullptr, std::memory_order_acq_rel);
+}
+
 DeckItem::DeckItem( const std::string& nm, int) :
+    storage( std::vector< int >{} ),
     type( get_type< int >() ),
     item_name( nm )
 {
 }
 
 DeckItem::DeckItem( const std::string& nm, std::string) :
+    storage( std::vector< std::string >{} ),
     type( get_type< std::string >() ),
     item_name( nm )
 {
 }
 
 DeckItem::DeckItem( const std::string& nm, RawString) :
+    storage( std::vector< RawString >{} ),
     type( get_type< RawString >() ),
     item_name( nm )
 {
@@ -98,6 +151,7 @@ DeckItem::DeckItem( const std::string& nm, RawString) :
 
 
 DeckItem::DeckItem( const std::string& nm, double, const std::vector<Dimension>& active_dim, const std::vector<Dimension>& default_dim) :
+    storage( std::vector< double >{} ),
     type( get_type< double >() ),
     item_name( nm ),
     active_dimensions(active_dim),
@@ -106,6 +160,7 @@ DeckItem::DeckItem( const std::string& nm, double, const std::vector<Dimension>&
 }
 
 DeckItem::DeckItem( const std::string& nm, UDAValue, const std::vector<Dimension>& active_dim, const std::vector<Dimension>& default_dim) :
+    storage( std::vector< UDAValue >{} ),
     type( get_type< UDAValue >() ),
     item_name( nm ),
     active_dimensions(active_dim),
@@ -116,32 +171,40 @@ DeckItem::DeckItem( const std::string& nm, UDAValue, const std::vector<Dimension
 DeckItem DeckItem::serializationTestObject()
 {
     DeckItem result;
-    result.dval = {1.0};
-    result.ival = {2};
-    result.sval = {"test1"};
-    result.uval = {UDAValue(3.0)};
+    result.storage = std::vector< std::string >{"test1"};
     result.type = type_tag::string;
     result.item_name = "test2";
     result.value_status = {value::status::deck_value};
-    result.raw_data = false;
     result.active_dimensions = {Dimension::serializationTestObject()};
     result.default_dimensions = {Dimension::serializationTestObject()};
 
     return result;
 }
 
+namespace {
+    // Empty value array of the same type as the one held in 'storage'.
+    template <typename Storage>
+    Storage emptyStorage(const Storage& storage)
+    {
+        return std::visit([](const auto& values) -> Storage
+        {
+            return std::decay_t<decltype(values)>{};
+        }, storage);
+    }
+}
+
 DeckItem DeckItem::emptyStructuralCopy() const
 {
-    auto ret = *this;
-
-    ret.dval .clear();
-    ret.ival .clear();
-    ret.sval .clear();
-    ret.rsval.clear();
-    ret.uval .clear();
+    // Member-wise copy of the structural information only, to avoid
+    // copying potentially large value arrays that would immediately be
+    // discarded.
+    DeckItem ret;
 
-    ret.value_status.clear();
-    ret.raw_data = true;
+    ret.storage = emptyStorage(this->storage);
+    ret.type = this->type;
+    ret.item_name = this->item_name;
+    ret.active_dimensions = this->active_dimensions;
+    ret.default_dimensions = this->default_dimensions;
 
     return ret;
 }
@@ -154,7 +217,7 @@ bool DeckItem::defaultApplied( size_t index ) const {
     return value::defaulted( this->value_status.at(index));
 }
 
-const std::vector<value::status>& DeckItem::getValueStatus() const {
+const ValueStatusRuns& DeckItem::getValueStatus() const {
     return this->value_status;
 }
 
@@ -208,12 +271,12 @@ UDAValue DeckItem::get( size_t index ) const {
 
 template <>
 void DeckItem::shrink_to_fit<int>() {
-    this->ival.shrink_to_fit();
+    this->value_ref< int >().shrink_to_fit();
 }
 
 template <>
 void DeckItem::shrink_to_fit<double>() {
-    this->dval.shrink_to_fit();
+    this->value_ref< double >().shrink_to_fit();
 }
 
 
@@ -229,6 +292,7 @@ void DeckItem::push( T x ) {
 
     val.push_back( std::move( x ) );
     this->value_status.push_back( value::status::deck_value );
+    this->si_data.reset();
 }
 
 void DeckItem::push_back( int x ) {
@@ -256,7 +320,8 @@ void DeckItem::push( T x, size_t n ) {
     auto& val = this->value_ref< T >();
 
     val.insert( val.end(), n, x );
-    this->value_status.insert( this->value_status.end(), n, value::status::deck_value );
+    this->value_status.push_back( value::status::deck_value, n );
+    this->si_data.reset();
 }
 
 void DeckItem::push_back( int x, size_t n ) {
@@ -283,7 +348,8 @@ void DeckItem::push_default( T x, std::size_t n ) {
                 "no 'pseudo defaults' can be added before");
 
     val.insert(val.end(), n, std::move( x ) );
-    this->value_status.insert( this->value_status.end(), n, value::status::valid_default );
+    this->value_status.push_back( value::status::valid_default, n );
+    this->si_data.reset();
 }
 
 void DeckItem::push_backDefault( int x, std::size_t n ) {
@@ -311,7 +377,8 @@ template<typename T>
 void DeckItem::push_backDummyDefault( std::size_t n ) {
     auto& val = this->value_ref< T >();
     val.insert( val.end(), n, T() );
-    this->value_status.insert( this->value_status.end(), n, value::status::empty_default );
+    this->value_status.push_back( value::status::empty_default, n );
+    this->si_data.reset();
 }
 
 std::string DeckItem::getTrimmedString( size_t index ) const {
@@ -322,33 +389,19 @@ double DeckItem::getSIDouble( size_t index ) const {
     return this->getSIDoubleData().at( index );
 }
 
-template<>
-const std::vector<double>& DeckItem::getData() const {
-    auto& data = (const_cast<DeckItem*>(this))->value_ref< double >();
-    if (this->raw_data)
-        return data;
-
-    const auto dim_size = this->active_dimensions.size();
-    for( size_t index = 0; index < data.size(); index++ ) {
-        const auto dimIndex = index % dim_size;
-        if (value::defaulted(this->value_status[index])) {
-            const auto& dim = this->default_dimensions[dimIndex];
-            data[ index ] = dim.convertSiToRaw( data[ index ] );
-        } else {
-            const auto& dim = this->active_dimensions[dimIndex];
-            data[ index ] = dim.convertSiToRaw( data[ index ] );
-        }
-    }
-    this->raw_data = true;
-    return data;
+const Dimension& DeckItem::dimension_(const std::size_t index) const
+{
+    const auto& dim = value::defaulted(this->value_status[index])
+        ? this->default_dimensions
+        : this->active_dimensions;
+
+    return dim[index % this->active_dimensions.size()];
 }
 
 const std::vector<double>& DeckItem::getSIDoubleData() const
 {
-    auto& data = (const_cast<DeckItem*>(this))->value_ref<double>();
-    if (!this->raw_data) {
-        return data;
-    }
+    if (const auto* si = this->si_data.load(); si != nullptr)
+        return *si;
 
     if (this->active_dimensions.empty()) {
         throw std::invalid_argument {
@@ -358,22 +411,12 @@ const std::vector<double>& DeckItem::getSIDoubleData() const
         };
     }
 
-    // This is an unobservable state change - SIData is lazily converted to
-    // SI units, so externally the object still behaves as const.
-
-    const auto dim_size = this->active_dimensions.size();
-    const auto sz = data.size();
-    for (auto index = 0*sz; index < sz; ++index) {
-        const auto& dim = value::defaulted(this->value_status[index])
-            ? this->default_dimensions
-            : this->active_dimensions;
-
-        data[index] = dim[index % dim_size].convertRawToSi(data[index]);
-    }
-
-    this->raw_data = false;
+    const auto& raw = this->value_ref<double>();
+    auto si = std::make_unique<std::vector<double>>(raw.size());
+    for (auto index = 0*raw.size(); index < raw.size(); ++index)
+        (*si)[index] = this->dimension_(index).convertRawToSi(raw[index]);
 
-    return data;
+    return this->si_data.publish(std::move(si));
 }
 
 
@@ -397,22 +440,19 @@ void DeckItem::write_vector(DeckOutput& stream, const std::vector<T>& data) cons
 void DeckItem::write(DeckOutput& stream) const {
     switch( this->type ) {
     case type_tag::integer:
-        this->write_vector( stream, this->ival );
+        this->write_vector( stream, this->value_ref< int >() );
         break;
     case type_tag::fdouble:
-        {
-            const auto& data = this->getData<double>();
-            this->write_vector( stream,  data );
-            break;
-        }
+        this->write_vector( stream, this->value_ref< double >() );
+        break;
     case type_tag::string:
-        this->write_vector( stream,  this->sval );
+        this->write_vector( stream,  this->value_ref< std::string >() );
         break;
     case type_tag::raw_string:
-        this->write_vector( stream,  this->rsval );
+        this->write_vector( stream,  this->value_ref< RawString >() );
         break;
     case type_tag::uda:
-        this->write_vector( stream,  this->uval );
+        this->write_vector( stream,  this->value_ref< UDAValue >() );
         break;
     default:
         throw std::logic_error( "DeckItem::write: Type not set." );
@@ -458,31 +498,26 @@ bool DeckItem::equal(const DeckItem& other, bool cmp_default, bool cmp_numeric)
 
     switch( this->type ) {
     case type_tag::integer:
-        if (this->ival != other.ival)
+        if (this->value_ref< int >() != other.value_ref< int >())
             return false;
         break;
     case type_tag::string:
-        if (this->sval != other.sval)
+        if (this->value_ref< std::string >() != other.value_ref< std::string >())
             return false;
         break;
     case type_tag::fdouble:
         if (cmp_numeric) {
             constexpr double rel_eps = 1e-4;
             constexpr double abs_eps = 1e-4;
-            const auto& this_data = this->getData<double>();
-            const auto& other_data = other.getData<double>();
+            const auto& this_data = this->value_ref< double >();
+            const auto& other_data = other.value_ref< double >();
             for (size_t i=0; i < this_data.size(); i++) {
                 if (!double_equal( this_data[i] , other_data[i], rel_eps, abs_eps))
                     return false;
             }
         } else {
-            if (this->raw_data == other.raw_data)
-                return (this->dval == other.dval);
-            else {
-                const auto& this_data = this->getData<double>();
-                const auto& other_data = other.getData<double>();
-                return (this_data == other_data);
-            }
+            if (this->value_ref< double >() != other.value_ref< double >())
+                return false;
         }
         break;
     default:
@@ -541,7 +576,8 @@ bool DeckItem::to_bool(std::string string_value) {
 
 void DeckItem::reserve_additionalRawString(std::size_t n)
 {
-    this->rsval.reserve(rsval.size() + n);
+    auto& rsval = this->value_ref< RawString >();
+    rsval.reserve(rsval.size() + n);
 }
 
 /*
@@ -561,6 +597,7 @@ template void DeckItem::push_backDummyDefault<RawString>( std::size_t );
 template void DeckItem::push_backDummyDefault<UDAValue>( std::size_t );
 
 template const std::vector< int >& DeckItem::getData< int >() const;
+template const std::vector< double >& DeckItem::getData< double >() const;
 template const std::vector< UDAValue >& DeckItem::getData< UDAValue >() const;
 template const std::vector< std::string >& DeckItem::getData< std::string >() const;
 template const std::vector<RawString>& DeckItem::getData<RawString>() const;
@@ -20,7 +20,10 @@
 #ifndef DECKITEM_HPP
 #define DECKITEM_HPP
 
+#include <atomic>
+#include <memory>
 #include <string>
+#include <variant>
 #include <vector>
 #include <iosfwd>
 
@@ -28,6 +31,7 @@
 #include <opm/input/eclipse/Utility/Typetools.hpp>
 #include <opm/input/eclipse/Deck/UDAValue.hpp>
 #include <opm/input/eclipse/Deck/value_status.hpp>
+#include <opm/input/eclipse/Deck/ValueStatusRuns.hpp>
 
 
 namespace Opm {
@@ -75,7 +79,7 @@ namespace Opm {
 
         template< typename T > const std::vector< T >& getData() const;
         const std::vector< double >& getSIDoubleData() const;
-        const std::vector<value::status>& getValueStatus() const;
+        const ValueStatusRuns& getValueStatus() const;
         const std::vector<Dimension>& getActiveDimensions() const
         {
             return this->active_dimensions;
@@ -136,20 +140,15 @@ namespace Opm {
         bool is_string() { return  type == get_type< std::string >(); };
         bool is_raw_string() { return  type == get_type< RawString >(); };
 
-        UDAValue& get_uda() { return uval[0]; };
+        UDAValue& get_uda() { return value_ref<UDAValue>()[0]; };
 
         template<class Serializer>
         void serializeOp(Serializer& serializer)
         {
-            serializer(dval);
-            serializer(ival);
-            serializer(sval);
-            serializer(rsval);
-            serializer(uval);
+            serializer(storage);
             serializer(type);
             serializer(item_name);
             serializer(value_status);
-            serializer(raw_data);
             serializer(active_dimensions);
             serializer(default_dimensions);
         }
@@ -157,22 +156,50 @@ namespace Opm {
         void reserve_additionalRawString(std::size_t);
 
     private:
-        mutable std::vector< double > dval;
-        std::vector< int > ival;
-        std::vector< std::string > sval;
-        std::vector< RawString > rsval;
-        std::vector< UDAValue > uval;
+        /*
+          Only the values of the item's active type are stored.  The
+          alternative held by the variant always corresponds to the 'type'
+          member, except for default constructed items of unknown type.
+        */
+        using Storage = std::variant< std::vector< int >,
+                                      std::vector< double >,
+                                      std::vector< std::string >,
+                                      std::vector< RawString >,
+                                      std::vector< UDAValue > >;
+
+        Storage storage;
 
         type_tag type = type_tag::unknown;
 
         std::string item_name;
-        std::vector<value::status> value_status;
+        ValueStatusRuns value_status;
+
         /*
-          To save space we mutate the dval object in place when asking for SI
-          data; the current state of of the dval member is tracked with the
-          raw_data bool member.
+          Double values converted to SI units.  The raw values are never
+          modified; the converted values are computed on first request and
+          published with a compare-exchange, so that concurrent readers of
+          the same const DeckItem take no lock and see either no array or
+          a complete one.  Modifying the item's values discards the array,
+          and copies compute their own.
         */
-        mutable bool raw_data = true;
+        class SIData {
+        public:
+            SIData() = default;
+            SIData(const SIData&) {}
+            SIData(SIData&& other) noexcept;
+            SIData& operator=(const SIData& other);
+            SIData& operator=(SIData&& other) noexcept;
+            ~SIData();
+
+            const std::vector<double>* load() const { return this->data_.load(std::memory_order_acquire); }
+            const std::vector<double>& publish(std::unique_ptr<const std::vector<double>> values) const;
+            void reset();
+
+        private:
+            mutable std::atomic<const std::vector<double>*> data_{nullptr};
+        };
+
+        SIData si_data;
         std::vector< Dimension > active_dimensions;
         std::vector< Dimension > default_dimensions;
 
@@ -182,6 +209,8 @@ namespace Opm {
         template< typename T > void push( T, size_t );
         template< typename T > void push_default( T, std::size_t n );
         template< typename T > void write_vector(DeckOutput& writer, const std::vector<T>& data) const;
+
+        const Dimension& dimension_(std::size_t index) const;
     };
 }
 #endif  /* DECKITEM_HPP */
@@ -310,7 +310,7 @@ namespace Opm {
         return this->getDataRecord().getDataItem().getSIDoubleData();
     }
 
-    const std::vector<value::status>& DeckKeyword::getValueStatus() const {
+    const ValueStatusRuns& DeckKeyword::getValueStatus() const {
         return this->getDataRecord().getDataItem().getValueStatus();
    }
 
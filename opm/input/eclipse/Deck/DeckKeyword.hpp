@@ -24,7 +24,7 @@
 #include <vector>
 
 #include <opm/input/eclipse/Deck/DeckRecord.hpp>
-#include <opm/input/eclipse/Deck/value_status.hpp>
+#include <opm/input/eclipse/Deck/ValueStatusRuns.hpp>
 #include <opm/common/OpmLog/KeywordLocation.hpp>
 
 namespace Opm {
@@ -70,7 +70,7 @@ namespace Opm {
         const std::vector<double>& getRawDoubleData() const;
         const std::vector<double>& getSIDoubleData() const;
         const std::vector<std::string>& getStringData() const;
-        const std::vector<value::status>& getValueStatus() const;
+        const ValueStatusRuns& getValueStatus() const;
         size_t getDataSize() const;
         void write( DeckOutput& output ) const;
         void write_data( DeckOutput& output ) const;
@@ -50,44 +50,32 @@ namespace {
         {"SCHEDULE", 7},
     };
 
-    std::pair<std::size_t, std::size_t>
-    index_pair(const Opm::Deck& deck, const std::string& section)
+    // Section boundaries are looked up in the deck's keyword index: the
+    // section starts at the first occurrence of its keyword, and ends at
+    // the first subsequent occurrence of the keyword of any later section.
+    Opm::DeckView section_view(const Opm::Deck& deck, const std::string& section)
     {
-        if (!deck.hasKeyword(section)) {
-            return {0,0};
+        const auto global = deck.global_view();
+        const auto start_index = global.find(section);
+        if (!start_index.has_value()) {
+            return {};
         }
 
-        auto start_index = deck.index(section).front();
-        std::unordered_set<std::string> end_set;
-        {
-            auto this_section_index = section_index.at(section);
+        const auto this_section_index = section_index.at(section);
 
-            for (const auto& [section_name, index] : section_index) {
-                if (index > this_section_index) {
-                    end_set.insert(section_name);
-                }
-            }
-        }
-
-        if (end_set.empty()) {
-            return {start_index, deck.size()};
-        }
-
-        std::size_t deck_index = start_index;
-        while (true) {
-            const auto& kw = deck[deck_index];
-            if (end_set.count(kw.name()) == 1) {
-                break;
+        auto end_index = global.size();
+        for (const auto& [section_name, index] : section_index) {
+            if (index <= this_section_index) {
+                continue;
             }
 
-            ++deck_index;
-
-            if (deck_index == deck.size()) {
-                break;
+            const auto next = global.find(section_name, *start_index);
+            if (next.has_value()) {
+                end_index = std::min(end_index, *next);
             }
         }
 
-        return {start_index, deck_index};
+        return global.slice(*start_index, end_index);
     }
 
 } // Anonymous namespace
@@ -95,15 +83,10 @@ namespace {
 namespace Opm {
 
     DeckSection::DeckSection(const Deck& deck, const std::string& section)
-        : section_name(section)
+        : DeckView(section_view(deck, section))
+        , section_name(section)
         , units(deck.getActiveUnitSystem())
-    {
-        const auto& [start_index, end_index] = index_pair(deck, section);
-
-        for (std::size_t index = start_index; index < end_index; ++index) {
-            this->add_keyword(deck[index]);
-        }
-    }
+    {}
 
     const std::string& DeckSection::name() const
     {
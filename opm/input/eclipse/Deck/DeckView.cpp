@@ -18,68 +18,189 @@
 
 #include <opm/input/eclipse/Deck/DeckView.hpp>
 
-#include <functional>
+#include <algorithm>
 #include <stdexcept>
+#include <string>
+#include <utility>
+
+void Opm::DeckView::Index::add(const Opm::DeckKeyword& kw) {
+    this->positions[kw.name()].push_back(this->keywords.size());
+    this->keywords.push_back(&kw);
+}
+
+void Opm::DeckView::Index::clear() {
+    this->keywords.clear();
+    this->positions.clear();
+}
+
+Opm::DeckView::DeckView(std::shared_ptr<const Index> index_arg, std::size_t first_arg, std::size_t last_arg)
+    : shared_index(std::move(index_arg))
+    , first(first_arg)
+    , last(last_arg)
+{
+    if (this->first > this->last || (this->shared_index && this->last > this->shared_index->keywords.size()))
+        throw std::out_of_range("Invalid DeckView range");
+}
 
 void Opm::DeckView::add_keyword(const Opm::DeckKeyword& kw) {
-    this->keyword_index[kw.name()].push_back(this->keywords.size());
-    this->keywords.push_back(std::cref(kw));
+    // Views share their index with the Deck and with other views; never
+    // modify an index which is shared or which extends beyond this view.
+    const auto owns_index = this->shared_index
+        && (this->shared_index.use_count() == 1)
+        && (this->selection == nullptr)
+        && (this->first == 0)
+        && (this->last == this->shared_index->keywords.size());
+
+    if (!owns_index) {
+        auto own = std::make_shared<Index>();
+        for (const auto& view_kw : *this)
+            own->add(view_kw);
+
+        this->shared_index = std::move(own);
+        this->selection = nullptr;
+        this->selection_name = nullptr;
+        this->first = 0;
+        this->last = this->shared_index->keywords.size();
+    }
+
+    std::const_pointer_cast<Index>(this->shared_index)->add(kw);
+    ++this->last;
+}
+
+std::pair<std::size_t, std::size_t>
+Opm::DeckView::keyword_range(const std::string& keyword,
+                             const std::vector<std::size_t>*& positions) const
+{
+    positions = nullptr;
+    if (this->empty())
+        return {0, 0};
+
+    if (this->selection != nullptr) {
+        if (keyword != *this->selection_name)
+            return {0, 0};
+
+        positions = this->selection;
+        return {this->first, this->last};
+    }
+
+    auto iter = this->shared_index->positions.find(keyword);
+    if (iter == this->shared_index->positions.end())
+        return {0, 0};
+
+    positions = &iter->second;
+    const auto begin = std::lower_bound(positions->begin(), positions->end(), this->first);
+    const auto end = std::lower_bound(begin, positions->end(), this->last);
+    return { static_cast<std::size_t>(begin - positions->begin()),
+             static_cast<std::size_t>(end - positions->begin()) };
+}
+
+std::size_t Opm::DeckView::position(std::size_t kw_index) const {
+    return (this->selection == nullptr)
+        ? this->first + kw_index
+        : (*this->selection)[this->first + kw_index];
 }
 
 bool Opm::DeckView::has_keyword(const std::string& kw) const {
-    return this->keyword_index.find(kw) != this->keyword_index.end();
+    return this->count(kw) > 0;
 }
 
 bool Opm::DeckView::empty() const {
-    return this->keywords.empty();
+    return this->first == this->last;
 }
 
 std::size_t Opm::DeckView::size() const {
-    return this->keywords.size();
+    return this->last - this->first;
 }
 
 const Opm::DeckKeyword& Opm::DeckView::operator[](std::size_t kw_index) const {
-    return this->keywords.at(kw_index).get();
+    if (kw_index >= this->size())
+        throw std::out_of_range("DeckView index " + std::to_string(kw_index) +
+                                " out of range [0, " + std::to_string(this->size()) + ")");
+
+    return *this->shared_index->keywords[this->position(kw_index)];
 }
 
 Opm::DeckView Opm::DeckView::operator[](const std::string& kw_name) const {
+    const std::vector<std::size_t>* positions = nullptr;
+    const auto [begin, end] = this->keyword_range(kw_name, positions);
+    if (begin == end)
+        return {};
+
     DeckView dw;
-    auto iter = this->keyword_index.find(kw_name);
-    if (iter != this->keyword_index.end()) {
-        for (const auto& kw_index : iter->second) {
-            const auto& kw = this->keywords[kw_index].get();
-            dw.add_keyword(kw);
-        }
-    }
+    dw.shared_index = this->shared_index;
+    dw.first = begin;
+    dw.last = end;
+    dw.selection = positions;
+    dw.selection_name = (this->selection != nullptr)
+        ? this->selection_name
+        : &this->shared_index->positions.find(kw_name)->first;
+
+    return dw;
+}
+
+Opm::DeckView Opm::DeckView::slice(std::size_t begin, std::size_t end) const {
+    if (begin > end || end > this->size())
+        throw std::out_of_range("DeckView slice [" + std::to_string(begin) + ", " + std::to_string(end) +
+                                ") out of range [0, " + std::to_string(this->size()) + ")");
+
+    DeckView dw = *this;
+    dw.first = this->first + begin;
+    dw.last = this->first + end;
     return dw;
 }
 
+std::optional<std::size_t> Opm::DeckView::find(const std::string& keyword, std::size_t from) const {
+    if (from >= this->size())
+        return {};
+
+    const std::vector<std::size_t>* positions = nullptr;
+    const auto [begin, end] = this->keyword_range(keyword, positions);
+    if (begin == end)
+        return {};
+
+    if (this->selection != nullptr)
+        return from;
+
+    const auto iter = std::lower_bound(positions->begin() + begin,
+                                       positions->begin() + end,
+                                       this->first + from);
+    if (iter == positions->begin() + end)
+        return {};
+
+    return *iter - this->first;
+}
+
 const Opm::DeckKeyword& Opm::DeckView::front() const {
     if (this->empty())
         throw std::logic_error("Tried to get front() from empty DeckView");
 
-    return this->keywords.front().get();
+    return *this->begin();
 }
 
 const Opm::DeckKeyword& Opm::DeckView::back() const {
     if (this->empty())
         throw std::logic_error("Tried to get back() from empty DeckView");
 
-    return this->keywords.back().get();
+    return (*this)[this->size() - 1];
 }
 
 std::vector<std::size_t> Opm::DeckView::index(const std::string& keyword) const {
-    auto iter = this->keyword_index.find(keyword);
-    if (iter != this->keyword_index.end())
-        return iter->second;
+    const std::vector<std::size_t>* positions = nullptr;
+    const auto [begin, end] = this->keyword_range(keyword, positions);
+
+    std::vector<std::size_t> kw_index;
+    kw_index.reserve(end - begin);
+    for (auto i = begin; i < end; ++i) {
+        kw_index.push_back((this->selection != nullptr)
+                           ? i - this->first
+                           : (*positions)[i] - this->first);
+    }
 
-    return {};
+    return kw_index;
 }
 
 std::size_t Opm::DeckView::count(const std::string& keyword) const {
-    auto iter = this->keyword_index.find(keyword);
-    if (iter == this->keyword_index.end())
-        return 0;
-
-    return iter->second.size();
+    const std::vector<std::size_t>* positions = nullptr;
+    const auto [begin, end] = this->keyword_range(keyword, positions);
+    return end - begin;
 }
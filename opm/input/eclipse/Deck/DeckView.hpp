@@ -22,50 +22,73 @@
 
 #include <opm/input/eclipse/Deck/DeckKeyword.hpp>
 
+#include <cstddef>
 #include <iterator>
+#include <memory>
+#include <optional>
+#include <string>
 #include <unordered_map>
+#include <vector>
 
 namespace Opm {
 
-
+/*
+  A DeckView is a lightweight, ordered selection of keywords.  The keywords
+  and a keyword name -> positions index are kept in a shared Index object;
+  a view is a contiguous range of that index, optionally restricted to the
+  occurrences of a single keyword name.  Creating a sub-view, e.g. a
+  section of a deck or all occurrences of a keyword, therefore does not
+  copy or re-index any keywords.
+*/
 class DeckView {
 public:
-    typedef std::vector<std::reference_wrapper<const DeckKeyword>> storage_type;
+    struct Index {
+        std::vector<const DeckKeyword*> keywords;
+        std::unordered_map<std::string, std::vector<std::size_t>> positions;
 
+        void add(const DeckKeyword& kw);
+        void clear();
+    };
 
     struct Iterator {
-        explicit Iterator(storage_type::const_iterator inner_iter) :
-            inner(inner_iter)
+        Iterator(const Index* index, const std::vector<std::size_t>* selection, std::size_t pos) :
+            index(index), selection(selection), pos(pos)
         {}
 
-        using difference_type = storage_type::const_iterator::difference_type;
-        using iterator_category = storage_type::const_iterator::iterator_category;
+        using difference_type = std::ptrdiff_t;
+        using iterator_category = std::random_access_iterator_tag;
         using pointer = const DeckKeyword*;
         using reference = const DeckKeyword&;
         using value_type = DeckKeyword;
 
-        const DeckKeyword& operator*() const { return this->inner->get(); }
-        const DeckKeyword* operator->() const { return &this->inner->get(); }
+        const DeckKeyword& operator*() const { return *this->operator->(); }
+        const DeckKeyword* operator->() const {
+            return this->index->keywords[this->selection == nullptr ? this->pos : (*this->selection)[this->pos]];
+        }
 
-        Iterator& operator++()    { ++this->inner; return *this; }
-        Iterator  operator++(int) { auto tmp = *this; ++this->inner; return tmp; }
+        Iterator& operator++()    { ++this->pos; return *this; }
+        Iterator  operator++(int) { auto tmp = *this; ++this->pos; return tmp; }
 
-        Iterator& operator--()    { --this->inner; return *this; }
-        Iterator  operator--(int) { auto tmp = *this; --this->inner; return tmp; }
+        Iterator& operator--()    { --this->pos; return *this; }
+        Iterator  operator--(int) { auto tmp = *this; --this->pos; return tmp; }
 
-        Iterator::difference_type operator-(const Iterator &other) const { return this->inner - other.inner; }
-        Iterator operator+(Iterator::difference_type shift) const { Iterator tmp = *this; tmp.inner += shift; return tmp;}
+        Iterator::difference_type operator-(const Iterator &other) const {
+            return static_cast<difference_type>(this->pos) - static_cast<difference_type>(other.pos);
+        }
+        Iterator operator+(Iterator::difference_type shift) const { Iterator tmp = *this; tmp.pos += shift; return tmp;}
 
-        friend bool operator== (const Iterator& a, const Iterator& b) { return a.inner == b.inner; };
-        friend bool operator<= (const Iterator& a, const Iterator& b) { return a.inner <= b.inner; };
-        friend bool operator!= (const Iterator& a, const Iterator& b) { return a.inner != b.inner; };
+        friend bool operator== (const Iterator& a, const Iterator& b) { return a.pos == b.pos; };
+        friend bool operator<= (const Iterator& a, const Iterator& b) { return a.pos <= b.pos; };
+        friend bool operator!= (const Iterator& a, const Iterator& b) { return a.pos != b.pos; };
 
     private:
-        storage_type::const_iterator inner;
+        const Index* index;
+        const std::vector<std::size_t>* selection;
+        std::size_t pos;
     };
 
-    Iterator begin() const { return Iterator(this->keywords.begin()); }
-    Iterator end() const { return Iterator(this->keywords.end()); }
+    Iterator begin() const { return Iterator(this->shared_index.get(), this->selection, this->first); }
+    Iterator end() const { return Iterator(this->shared_index.get(), this->selection, this->last); }
 
     const DeckKeyword& operator[](std::size_t index) const;
     DeckView operator[](const std::string& keyword) const;
@@ -75,11 +98,21 @@ public:
     const DeckKeyword& back() const;
 
     DeckView() = default;
+
+    // View of an existing index, covering positions [first, last).
+    DeckView(std::shared_ptr<const Index> index, std::size_t first, std::size_t last);
+
     void add_keyword(const DeckKeyword& kw);
     bool has_keyword(const std::string& kw) const;
     bool empty() const;
     std::size_t size() const;
 
+    // Sub-view covering positions [first, last) of this view.
+    DeckView slice(std::size_t first, std::size_t last) const;
+
+    // Position of first occurrence of keyword at or after position 'from'.
+    std::optional<std::size_t> find(const std::string& keyword, std::size_t from = 0) const;
+
     template<class Keyword>
     bool has_keyword() const {
         return this->has_keyword( Keyword::keywordName );
@@ -91,8 +124,21 @@ public:
     }
 
 private:
-    storage_type keywords;
-    std::unordered_map<std::string, std::vector<std::size_t>> keyword_index;
+    std::shared_ptr<const Index> shared_index{};
+
+    // Range of view, in positions of 'shared_index->keywords' or, for a single
+    // keyword view, in positions of 'selection'.
+    std::size_t first{0};
+    std::size_t last{0};
+
+    // Positions of the selected keyword in a single keyword view.
+    const std::vector<std::size_t>* selection{nullptr};
+    const std::string* selection_name{nullptr};
+
+    // Sub-range of the positions of 'keyword' which lie within this view.
+    std::pair<std::size_t, std::size_t> keyword_range(const std::string& keyword,
+                                                      const std::vector<std::size_t>*& positions) const;
+    std::size_t position(std::size_t index) const;
 };
 
 }
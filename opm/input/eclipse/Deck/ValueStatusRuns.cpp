@@ -0,0 +1,110 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <opm/input/eclipse/Deck/ValueStatusRuns.hpp>
+
+#include <stdexcept>
+#include <string>
+
+namespace Opm {
+
+ValueStatusRuns::ValueStatusRuns(std::initializer_list<value::status> init)
+{
+    for (const auto& st : init) {
+        this->push_back(st);
+    }
+}
+
+void ValueStatusRuns::push_back(const value::status st, const std::size_t n)
+{
+    if (n == 0) {
+        return;
+    }
+
+    if (this->isFlat()) {
+        this->flat_.insert(this->flat_.end(), n, st);
+        return;
+    }
+
+    if (!this->status_.empty() && (this->status_.back() == st)) {
+        this->ends_.back() += n;
+        return;
+    }
+
+    this->ends_.push_back(this->size() + n);
+    this->status_.push_back(st);
+
+    this->flattenIfDense();
+}
+
+value::status ValueStatusRuns::at(const std::size_t i) const
+{
+    if (i >= this->size()) {
+        throw std::out_of_range {
+            "Value status index " + std::to_string(i) +
+            " out of range [0, " + std::to_string(this->size()) + ')'
+        };
+    }
+
+    return (*this)[i];
+}
+
+std::vector<value::status> ValueStatusRuns::expand() const
+{
+    if (this->isFlat()) {
+        return this->flat_;
+    }
+
+    auto expanded = std::vector<value::status>{};
+    expanded.reserve(this->size());
+
+    auto start = std::size_t{0};
+    for (auto run = 0*this->numRuns(); run < this->numRuns(); ++run) {
+        expanded.insert(expanded.end(), this->ends_[run] - start, this->status_[run]);
+        start = this->ends_[run];
+    }
+
+    return expanded;
+}
+
+void ValueStatusRuns::clear()
+{
+    this->ends_.clear();
+    this->status_.clear();
+    this->flat_.clear();
+}
+
+void ValueStatusRuns::flattenIfDense()
+{
+    // A run costs an end index and a flag, a value one flag.  Short
+    // sequences keep their runs, which are cheap either way.
+    constexpr auto minRuns = std::size_t{16};
+    constexpr auto valuesPerRun = std::size_t{8};
+
+    const auto numRuns = this->numRuns();
+    if ((numRuns <= minRuns) || (numRuns * valuesPerRun <= this->size())) {
+        return;
+    }
+
+    this->flat_ = this->expand();
+    this->ends_ = std::vector<std::size_t>{};
+    this->status_ = std::vector<value::status>{};
+}
+
+} // namespace Opm
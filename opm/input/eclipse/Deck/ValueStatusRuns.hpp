@@ -0,0 +1,226 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef OPM_VALUE_STATUS_RUNS_HPP
+#define OPM_VALUE_STATUS_RUNS_HPP
+
+#include <opm/input/eclipse/Deck/value_status.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+namespace Opm {
+
+/// Run-length encoded sequence of value::status flags.
+///
+/// The value status of a deck item is typically constant over long
+/// stretches--e.g., all deck values followed by a number of defaulted
+/// values--so storing one flag per value wastes memory for bulk data
+/// keywords such as PERMX.  This container stores one entry per run of
+/// identical flags, while still presenting a random access, read-only
+/// interface of the expanded sequence.  Sequences whose status changes
+/// often, where a run costs more than the values it covers, are stored
+/// with one flag per value instead.
+class ValueStatusRuns
+{
+public:
+    /// Forward iterator over the expanded status sequence.
+    class const_iterator
+    {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = value::status;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const value::status*;
+        using reference = const value::status&;
+
+        const_iterator() = default;
+
+        reference operator*() const
+        {
+            return this->runs_->isFlat()
+                ? this->runs_->flat_[this->pos_]
+                : this->runs_->status_[this->run_];
+        }
+
+        const_iterator& operator++()
+        {
+            if (this->runs_->isFlat()) {
+                ++this->pos_;
+            }
+            else if (++this->pos_ == this->runs_->ends_[this->run_]) {
+                ++this->run_;
+            }
+
+            return *this;
+        }
+
+        const_iterator operator++(int)
+        {
+            auto tmp = *this;
+            ++*this;
+            return tmp;
+        }
+
+        bool operator==(const const_iterator& that) const
+        {
+            return this->pos_ == that.pos_;
+        }
+
+        bool operator!=(const const_iterator& that) const
+        {
+            return !(*this == that);
+        }
+
+    private:
+        friend class ValueStatusRuns;
+
+        const_iterator(const ValueStatusRuns* runs,
+                       const std::size_t      run,
+                       const std::size_t      pos)
+            : runs_{ runs }, run_{ run }, pos_{ pos }
+        {}
+
+        const ValueStatusRuns* runs_{nullptr};
+        std::size_t run_{0};
+        std::size_t pos_{0};
+    };
+
+    using value_type = value::status;
+    using size_type = std::size_t;
+
+    ValueStatusRuns() = default;
+    ValueStatusRuns(std::initializer_list<value::status> init);
+
+    /// Append \p n copies of status flag \p st.  Extends the last run
+    /// if its status equals \p st.
+    void push_back(const value::status st, const std::size_t n = 1);
+
+    /// Number of values in expanded sequence.
+    std::size_t size() const
+    {
+        return this->isFlat() ? this->flat_.size()
+            : (this->ends_.empty() ? 0 : this->ends_.back());
+    }
+
+    bool empty() const
+    {
+        return this->ends_.empty() && this->flat_.empty();
+    }
+
+    /// Number of runs of identical status flags, or zero if the
+    /// sequence is stored with one flag per value.
+    std::size_t numRuns() const
+    {
+        return this->ends_.size();
+    }
+
+    /// Whether the sequence is stored with one flag per value.
+    bool isFlat() const
+    {
+        return !this->flat_.empty();
+    }
+
+    /// Status of value \p i.  Logarithmic in the number of runs.
+    /// Sequential access should use the iterator instead.
+    value::status operator[](const std::size_t i) const
+    {
+        if (this->isFlat()) {
+            return this->flat_[i];
+        }
+
+        const auto run = std::upper_bound(this->ends_.begin(), this->ends_.end(), i);
+        return this->status_[run - this->ends_.begin()];
+    }
+
+    /// Status of value \p i, with range checking.
+    value::status at(const std::size_t i) const;
+
+    /// Whether or not all values satisfy predicate \p pred.  Evaluates
+    /// the predicate once per run rather than once per value.
+    template <typename Predicate>
+    bool all_of(Predicate&& pred) const
+    {
+        const auto& status = this->isFlat() ? this->flat_ : this->status_;
+        return std::all_of(status.begin(), status.end(),
+                           std::forward<Predicate>(pred));
+    }
+
+    /// Expanded sequence, one status flag per value.
+    std::vector<value::status> expand() const;
+
+    /// Remove all values.  Does not release memory.
+    void clear();
+
+    const_iterator begin() const
+    {
+        return { this, 0, 0 };
+    }
+
+    const_iterator end() const
+    {
+        return { this, this->numRuns(), this->size() };
+    }
+
+    bool operator==(const ValueStatusRuns& that) const
+    {
+        if (this->isFlat() != that.isFlat()) {
+            return (this->size() == that.size())
+                && std::equal(this->begin(), this->end(), that.begin());
+        }
+
+        return (this->ends_ == that.ends_)
+            && (this->status_ == that.status_)
+            && (this->flat_ == that.flat_);
+    }
+
+    bool operator!=(const ValueStatusRuns& that) const
+    {
+        return !(*this == that);
+    }
+
+    template <class Serializer>
+    void serializeOp(Serializer& serializer)
+    {
+        serializer(this->ends_);
+        serializer(this->status_);
+        serializer(this->flat_);
+    }
+
+private:
+    /// One past the last value index of each run.
+    std::vector<std::size_t> ends_{};
+
+    /// Status flag of each run.
+    std::vector<value::status> status_{};
+
+    /// Status flag of each value, once runs no longer pay off.
+    std::vector<value::status> flat_{};
+
+    /// Switch to one flag per value if the runs cost more.
+    void flattenIfDense();
+};
+
+} // namespace Opm
+
+#endif // OPM_VALUE_STATUS_RUNS_HPP
@@ -22,6 +22,7 @@
 #include <opm/common/OpmLog/OpmLog.hpp>
 #include <opm/common/OpmLog/InfoLogger.hpp>
 #include <opm/common/OpmLog/LogUtil.hpp>
+#include <opm/common/utility/ConcurrentTasks.hpp>
 #include <opm/common/utility/OpmInputError.hpp>
 
 #include <opm/io/eclipse/rst/aquifer.hpp>
@@ -56,6 +57,7 @@
 #include <fmt/format.h>
 #include <fmt/ranges.h>
 
+#include <chrono>
 #include <cstddef>
 #include <filesystem>
 #include <map>
@@ -93,10 +95,52 @@ namespace {
             }
         }
     }
+
+    using StageTimings = std::vector<std::pair<std::string, double>>;
+    using Clock = std::chrono::steady_clock;
+
+    double seconds_since(const Clock::time_point start)
+    {
+        return std::chrono::duration<double>(Clock::now() - start).count();
+    }
 }
 
 namespace Opm {
 
+    struct EclipseState::DeckStages
+    {
+        explicit DeckStages(const Deck& deck)
+        {
+            // The tables, the grid geometry and the fault definitions are
+            // independent of each other and of everything but the deck.
+            const auto elapsed = runConcurrently({
+                [this, &deck]() { this->tables = TableManager(deck); },
+                [this, &deck]() { this->grid = EclipseGrid(deck, nullptr); },
+                [this, &deck]()
+                {
+                    if (DeckSection::hasGRID(deck)) {
+                        this->faults = FaultCollection(GRIDSection(deck), GridDims(deck));
+                    }
+                },
+            });
+
+            this->timings = {
+                { "tables", elapsed[0] },
+                { "grid",   elapsed[1] },
+                { "faults", elapsed[2] },
+            };
+
+            this->done = Clock::now();
+        }
+
+        TableManager tables{};
+        EclipseGrid grid{};
+        FaultCollection faults{};
+
+        StageTimings timings{};
+        Clock::time_point done{};
+    };
+
 // The field_props and grid both have a relationship to the number of active
 // cells, and update eachother through an inelegant dance through the
 // EclispeState construction:
@@ -131,11 +175,24 @@ namespace Opm {
 
     EclipseState::EclipseState(const Deck& deck)
     try
-        : m_tables(            deck )
+        : EclipseState(deck, DeckStages(deck))
+    {}
+    catch (const OpmInputError& opm_error) {
+        OpmLog::error(opm_error.what());
+        throw;
+    }
+    catch (const std::exception& std_error) {
+        OpmLog::error(fmt::format("\nAn error occurred while creating the reservoir properties\n"
+                                  "Internal error: {}\n", std_error.what()));
+        throw;
+    }
+
+    EclipseState::EclipseState(const Deck& deck, DeckStages&& stages)
+        : m_tables(            std::move(stages.tables) )
         , m_runspec(           deck )
         , m_eclipseConfig(     deck )
         , m_deckUnitSystem(    deck.getActiveUnitSystem() )
-        , m_inputGrid(         deck, nullptr )
+        , m_inputGrid(         std::move(stages.grid) )
         , m_inputNnc(          m_inputGrid, deck)
         , m_gridDims(          deck )
         , field_props(         deck, m_runspec.phases(), m_inputGrid, m_tables, m_runspec.numComps())
@@ -147,7 +204,12 @@ namespace Opm {
         , m_micppara(          deck)
         , wag_hyst_config(     deck)
         , co2_store_config(    deck)
+        , m_faults(            std::move(stages.faults) )
+        , m_construction_timings( std::move(stages.timings) )
     {
+        this->m_construction_timings.emplace_back("properties", seconds_since(stages.done));
+
+        auto start = Clock::now();
         this->assignRunTitle(deck);
         this->reportNumberOfActivePhases();
 
@@ -158,27 +220,24 @@ namespace Opm {
         if (field_props.has_double("MINPVV")) {
             field_props.deleteMINPVV();
         }
+        this->m_construction_timings.emplace_back("numerical aquifers", seconds_since(start));
+
+        start = Clock::now();
         this->initLgrs(deck);
         this->aquifer_config.load_connections(deck, this->getInputGrid());
+        this->m_construction_timings.emplace_back("lgrs and aquifer connections", seconds_since(start));
 
+        start = Clock::now();
         this->applyMULTXYZ();
         this->initFaults(deck);
         m_simulationConfig.m_ThresholdPressure.readFaults(deck,m_faults);
+        this->m_construction_timings.emplace_back("transmissibility multipliers", seconds_since(start));
 
         if (this->getInitConfig().restartRequested()) {
             verify_consistent_restart_information(deck.get<ParserKeywords::RESTART>().back(),
                                                   this->getIOConfig(), this->getInitConfig());
         }
     }
-    catch (const OpmInputError& opm_error) {
-        OpmLog::error(opm_error.what());
-        throw;
-    }
-    catch (const std::exception& std_error) {
-        OpmLog::error(fmt::format("\nAn error occurred while creating the reservoir properties\n"
-                                  "Internal error: {}\n", std_error.what()));
-        throw;
-    }
 
 
 
@@ -463,9 +522,8 @@ namespace Opm {
         if (!DeckSection::hasGRID(deck))
             return;
 
+        // m_faults is constructed along with the grid and the tables.
         const GRIDSection gridSection ( deck );
-
-        m_faults = FaultCollection(gridSection, m_inputGrid);
         setMULTFLT(gridSection);
 
         if (DeckSection::hasEDIT(deck)) {
@@ -43,6 +43,8 @@
 #include <cstddef>
 #include <memory>
 #include <optional>
+#include <string>
+#include <utility>
 #include <vector>
 
 namespace Opm {
@@ -146,6 +148,13 @@ namespace Opm {
         void loadRestartNetworkPressures(const RestartIO::RstNetwork& network);
         const std::optional<std::map<std::string, double> >& getRestartNetworkPressures() const { return this->m_restart_network_pressures; }
 
+        /// Wall clock time, in seconds, of each stage of the constructor.
+        /// Empty unless constructed from a Deck.
+        const std::vector<std::pair<std::string, double>>& constructionTimings() const
+        {
+            return this->m_construction_timings;
+        }
+
         template<class Serializer>
         void serializeOp(Serializer& serializer)
         {
@@ -175,6 +184,12 @@ namespace Opm {
         static bool rst_cmp(const EclipseState& full_state, const EclipseState& rst_state);
 
     private:
+        // Members which depend on the Deck only.  These are constructed
+        // concurrently, before the remaining members.
+        struct DeckStages;
+
+        EclipseState(const Deck& deck, DeckStages&& stages);
+
         void initIOConfigPostSchedule(const Deck& deck);
         void assignRunTitle(const Deck& deck);
         void reportNumberOfActivePhases() const;
@@ -215,6 +230,8 @@ namespace Opm {
         std::optional<std::map<std::string, double> > m_restart_network_pressures{std::nullopt};
 
         std::optional<FIPRegionStatistics> fipRegionStatistics_{std::nullopt};
+
+        std::vector<std::pair<std::string, double>> m_construction_timings{};
     };
 } // namespace Opm
 
@@ -81,6 +81,10 @@ namespace Opm {
                     const std::vector<double>& zcorn ,
                     const int * actnum = nullptr);
 
+        EclipseGrid(const EclipseGrid&) = default;
+        EclipseGrid(EclipseGrid&&) = default;
+        EclipseGrid& operator=(const EclipseGrid&) = default;
+        EclipseGrid& operator=(EclipseGrid&&) = default;
         virtual ~EclipseGrid() = default;
 
         /// EclipseGrid ignores ACTNUM in Deck, and therefore needs ACTNUM
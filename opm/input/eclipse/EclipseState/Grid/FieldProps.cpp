@@ -38,6 +38,7 @@
 #include <opm/input/eclipse/Units/UnitSystem.hpp>
 
 #include <opm/input/eclipse/Deck/Deck.hpp>
+#include <opm/input/eclipse/Deck/ValueStatusRuns.hpp>
 
 #include <opm/input/eclipse/Parser/ParserKeywords/A.hpp>
 #include <opm/input/eclipse/Parser/ParserKeywords/B.hpp>
@@ -54,6 +55,7 @@
 #include <array>
 #include <cstddef>
 #include <functional>
+#include <iterator>
 #include <optional>
 #include <set>
 #include <stdexcept>
@@ -317,27 +319,52 @@ Please check whether this is on purpose or if you did not properly define this r
     OpmLog::warning(Log::fileMessage(keyword.location(), message));
 }
 
+/// Status of deck values visited in increasing index order.  Walks the
+/// runs with the iterator instead of searching them for every value.
+class DeckStatusCursor
+{
+public:
+    explicit DeckStatusCursor(const ValueStatusRuns& status)
+        : current_{ status.begin() }
+    {}
+
+    value::status operator()(const std::size_t index)
+    {
+        std::advance(this->current_, index - this->index_);
+        this->index_ = index;
+        return *this->current_;
+    }
+
+private:
+    ValueStatusRuns::const_iterator current_{};
+    std::size_t index_{0};
+};
+
 template <typename T>
 void assign_deck(const Fieldprops::keywords::keyword_info<T>& kw_info,
                  const DeckKeyword& keyword,
                  Fieldprops::FieldData<T>& field_data,
                  const std::vector<T>& deck_data,
-                 const std::vector<value::status>& deck_status,
+                 const ValueStatusRuns& deck_status,
                  const Box& box)
 {
     verify_deck_data(kw_info, keyword, deck_data, box);
 
-    for (const auto& cell_index : box.index_list()) {
-        auto active_index = cell_index.active_index;
-        auto data_index = cell_index.data_index;
+    // The index lists are ordered by data index, so each pass visits the
+    // deck values in order.
+    {
+        auto status = DeckStatusCursor { deck_status };
         for (size_t i = 0; i < kw_info.num_value; ++i) {
-            auto deck_data_index = i* box.size() + data_index;
-            if (value::has_value(deck_status[deck_data_index])) {
-                auto data_active_index = i * box.size() + active_index;
-                if (deck_status[deck_data_index] == value::status::deck_value ||
-                    field_data.value_status[data_active_index] == value::status::uninitialized) {
-                    field_data.data[data_active_index] = deck_data[deck_data_index];
-                    field_data.value_status[data_active_index] = deck_status[deck_data_index];
+            for (const auto& cell_index : box.index_list()) {
+                const auto deck_data_index = i * box.size() + cell_index.data_index;
+                const auto deck_value_status = status(deck_data_index);
+                if (value::has_value(deck_value_status)) {
+                    auto data_active_index = i * box.size() + cell_index.active_index;
+                    if (deck_value_status == value::status::deck_value ||
+                        field_data.value_status[data_active_index] == value::status::uninitialized) {
+                        field_data.data[data_active_index] = deck_data[deck_data_index];
+                        field_data.value_status[data_active_index] = deck_value_status;
+                    }
                 }
             }
         }
@@ -348,12 +375,14 @@ void assign_deck(const Fieldprops::keywords::keyword_info<T>& kw_info,
         auto& global_status = field_data.global_value_status.value();
         const auto& index_list = box.global_index_list();
 
+        auto status = DeckStatusCursor { deck_status };
         for (const auto& cell : index_list) {
-            if ((deck_status[cell.data_index] == value::status::deck_value) ||
+            const auto deck_value_status = status(cell.data_index);
+            if ((deck_value_status == value::status::deck_value) ||
                 (global_status[cell.global_index] == value::status::uninitialized))
             {
                 global_data[cell.global_index] = deck_data[cell.data_index];
-                global_status[cell.global_index] = deck_status[cell.data_index];
+                global_status[cell.global_index] = deck_value_status;
             }
         }
     }
@@ -364,19 +393,23 @@ void multiply_deck(const Fieldprops::keywords::keyword_info<T>& kw_info,
                    const DeckKeyword& keyword,
                    Fieldprops::FieldData<T>& field_data,
                    const std::vector<T>& deck_data,
-                   const std::vector<value::status>& deck_status,
+                   const ValueStatusRuns& deck_status,
                    const Box& box)
 {
     verify_deck_data(kw_info, keyword, deck_data, box);
-    for (const auto& cell_index : box.index_list()) {
-        auto active_index = cell_index.active_index;
-        auto data_index = cell_index.data_index;
-
-        if (value::has_value(deck_status[data_index]) &&
-            value::has_value(field_data.value_status[active_index]))
-        {
-            field_data.data[active_index] *= deck_data[data_index];
-            field_data.value_status[active_index] = deck_status[data_index];
+    {
+        auto status = DeckStatusCursor { deck_status };
+        for (const auto& cell_index : box.index_list()) {
+            auto active_index = cell_index.active_index;
+            auto data_index = cell_index.data_index;
+            const auto deck_value_status = status(data_index);
+
+            if (value::has_value(deck_value_status) &&
+                value::has_value(field_data.value_status[active_index]))
+            {
+                field_data.data[active_index] *= deck_data[data_index];
+                field_data.value_status[active_index] = deck_value_status;
+            }
         }
     }
 
@@ -385,12 +418,14 @@ void multiply_deck(const Fieldprops::keywords::keyword_info<T>& kw_info,
         auto& global_status = field_data.global_value_status.value();
         const auto& index_list = box.global_index_list();
 
+        auto status = DeckStatusCursor { deck_status };
         for (const auto& cell : index_list) {
-            if ((deck_status[cell.data_index] == value::status::deck_value) ||
+            const auto deck_value_status = status(cell.data_index);
+            if ((deck_value_status == value::status::deck_value) ||
                 (global_status[cell.global_index] == value::status::uninitialized))
             {
                 global_data[cell.global_index] *= deck_data[cell.data_index];
-                global_status[cell.global_index] = deck_status[cell.data_index];
+                global_status[cell.global_index] = deck_value_status;
             }
         }
     }
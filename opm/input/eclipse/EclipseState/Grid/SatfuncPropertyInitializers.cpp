@@ -35,7 +35,7 @@
 #include <opm/input/eclipse/EclipseState/Tables/TableContainer.hpp>
 #include <opm/input/eclipse/EclipseState/Tables/TableManager.hpp>
 
-#include <opm/input/eclipse/Utility/Functional.hpp>
+#include <opm/common/utility/ConcurrentTasks.hpp>
 
 #include <algorithm>
 #include <array>
@@ -43,11 +43,14 @@
 #include <exception>
 #include <functional>
 #include <iterator>
+#include <map>
 #include <memory>
+#include <numeric>
 #include <stdexcept>
 #include <string>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 #include <stddef.h>
 
@@ -137,6 +140,72 @@ namespace {
         };
     }
 
+    /*
+     * Lowest numbered saturation region with the same saturation function
+     * tables as each region.  The TableManager shares a single table
+     * object between regions with identical table data, so regions are
+     * identified by the addresses of their tables.  The LET tables are
+     * not region-shared objects, so no regions are merged when present.
+     */
+    std::vector<std::size_t>
+    satRegionRepresentatives(const Opm::TableManager& tm)
+    {
+        const auto num_tables = tm.getTabdims().getNumSatTables();
+
+        auto representative = std::vector<std::size_t>(num_tables);
+        std::iota(representative.begin(), representative.end(), std::size_t{0});
+
+        if (!tm.getSwofletTable().empty() || !tm.getSgofletTable().empty()) {
+            return representative;
+        }
+
+        const auto containers = std::array {
+            &tm.getSwofTables(), &tm.getSgofTables(), &tm.getSlgofTables(),
+            &tm.getSwfnTables(), &tm.getSgfnTables(), &tm.getSof2Tables(),
+            &tm.getSof3Tables(), &tm.getSgwfnTables(), &tm.getGsfTables(),
+            &tm.getWsfTables(),
+        };
+
+        auto first = std::map<std::vector<const Opm::SimpleTable*>, std::size_t>{};
+        for (auto region = 0*num_tables; region < num_tables; ++region) {
+            auto tables = std::vector<const Opm::SimpleTable*>{};
+            for (const auto* container : containers) {
+                tables.push_back((container->empty() || (region >= container->max()))
+                                 ? nullptr : &container->getTable(region));
+            }
+
+            representative[region] = first.emplace(std::move(tables), region).first->second;
+        }
+
+        return representative;
+    }
+
+    /*
+     * Per-region end-point values, i.e., func(i) for each saturation
+     * region i.  Evaluated once per distinct set of saturation function
+     * tables, concurrently.
+     */
+    template <typename Func>
+    std::vector<double>
+    mapRegions(const Opm::TableManager& tm, Func&& func)
+    {
+        const auto representative = satRegionRepresentatives(tm);
+
+        auto values = std::vector<double>(representative.size());
+        Opm::forEachConcurrently(representative.size(), [&](const std::size_t region)
+        {
+            if (representative[region] == region) {
+                values[region] = func(static_cast<int>(region));
+            }
+        });
+
+        for (auto region = 0*representative.size(); region < representative.size(); ++region) {
+            values[region] = values[representative[region]];
+        }
+
+        return values;
+    }
+
     std::vector<double>
     findMinWaterSaturation(const Opm::TableManager& tm,
                            const Opm::Phases&       ph)
@@ -172,18 +241,18 @@ namespace {
         switch( getSaturationFunctionFamily( tm, ph ) ) {
             case SatfuncFamily::I:
                 if( !swofTables.empty() )
-                    return Opm::fun::map( famI, Opm::fun::iota( num_tables ) );
+                    return mapRegions( tm, famI );
                 else if ( !swofLetTables.empty() )
-                    return Opm::fun::map( famI_let, Opm::fun::iota( num_tables ) );
+                    return mapRegions( tm, famI_let );
                 else
                     throw std::domain_error("Either SWOF or SWOFLET tables must be provided");
 
             case SatfuncFamily::II: 
                 if( !swfnTables.empty() )
-                    return map( famII, Opm::fun::iota( num_tables ) );
+                    return mapRegions( tm, famII );
                 else
-                    return map( famII_sgwfn, Opm::fun::iota( num_tables ) );
-            case SatfuncFamily::III: return map( famIII, Opm::fun::iota( num_tables ) );
+                    return mapRegions( tm, famII_sgwfn );
+            case SatfuncFamily::III: return mapRegions( tm, famIII );
             default:
                 throw std::domain_error("No valid saturation keyword family specified");
         }
@@ -224,18 +293,18 @@ namespace {
         switch( getSaturationFunctionFamily( tm, ph ) ) {
             case SatfuncFamily::I:
                 if( !swofTables.empty() )
-                    return map( famI, Opm::fun::iota( num_tables ) );
+                    return mapRegions( tm, famI );
                 else if ( !swofLetTables.empty() )
-                    return Opm::fun::map( famI_let, Opm::fun::iota( num_tables ) );
+                    return mapRegions( tm, famI_let );
                 else
                     throw std::domain_error("Either SWOF or SWOFLET tables must be provided");
 
             case SatfuncFamily::II:
                 if( !swfnTables.empty() ) 
-                    return map( famII, Opm::fun::iota( num_tables ) );
+                    return mapRegions( tm, famII );
                 else
-                    return map( famII_sgwfn, Opm::fun::iota( num_tables ) );
-            case SatfuncFamily::III: return map( famIII, Opm::fun::iota( num_tables ) );
+                    return mapRegions( tm, famII_sgwfn );
+            case SatfuncFamily::III: return mapRegions( tm, famIII );
 
             default:
                 throw std::domain_error("No valid saturation keyword family specified");
@@ -285,19 +354,19 @@ namespace {
                     throw std::runtime_error( "Saturation keyword family I requires either sgof or slgof non-empty" );
 
                 if( !sgofTables.empty() )
-                    return Opm::fun::map( famI_sgof, Opm::fun::iota( num_tables ) );
+                    return mapRegions( tm, famI_sgof );
                 else if( !sgofLetTables.empty() )
-                    return Opm::fun::map( famI_sgof_let, Opm::fun::iota( num_tables ) );
+                    return mapRegions( tm, famI_sgof_let );
                 else
-                    return Opm::fun::map( famI_slgof, Opm::fun::iota( num_tables ) );
+                    return mapRegions( tm, famI_slgof );
 
             case SatfuncFamily::II:
                 if( !sgfnTables.empty() )
-                    return Opm::fun::map( famII, Opm::fun::iota( num_tables ) );
+                    return mapRegions( tm, famII );
                 else
-                    return Opm::fun::map( famII_sgwfn, Opm::fun::iota( num_tables ) );
+                    return mapRegions( tm, famII_sgwfn );
             case SatfuncFamily::III:
-                return Opm::fun::map( famIII, Opm::fun::iota( num_tables ) );
+                return mapRegions( tm, famIII );
 
             default:
                 throw std::domain_error("No valid saturation keyword family specified");
@@ -350,19 +419,19 @@ namespace {
                     throw std::runtime_error( "Saturation keyword family I requires either sgof or slgof non-empty" );
 
                 if( !sgofTables.empty() )
-                    return Opm::fun::map( famI_sgof, Opm::fun::iota( num_tables ) );
+                    return mapRegions( tm, famI_sgof );
                 else if( !sgofLetTables.empty() )
-                    return Opm::fun::map( famI_sgof_let, Opm::fun::iota( num_tables ) );
+                    return mapRegions( tm, famI_sgof_let );
                 else
-                    return Opm::fun::map( famI_slgof, Opm::fun::iota( num_tables ) );
+                    return mapRegions( tm, famI_slgof );
 
             case SatfuncFamily::II:
                 if( !sgfnTables.empty() )
-                    return Opm::fun::map( famII, Opm::fun::iota( num_tables ) );
+                    return mapRegions( tm, famII );
                 else
-                    return Opm::fun::map( famII_sgwfn, Opm::fun::iota( num_tables ) );
+                    return mapRegions( tm, famII_sgwfn );
             case SatfuncFamily::III:
-                return Opm::fun::map( famIII, Opm::fun::iota( num_tables ) );
+                return mapRegions( tm, famIII );
 
             default:
                 throw std::domain_error("No valid saturation keyword family specified");
@@ -481,18 +550,18 @@ namespace {
         switch( getSaturationFunctionFamily( tm, ph ) ) {
             case SatfuncFamily::I:
                 if( !swofTables.empty() )
-                    return Opm::fun::map( famI, Opm::fun::iota( num_tables ) );
+                    return mapRegions( tm, famI );
                 else if ( !swofLetTables.empty() )
-                    return Opm::fun::map( famI_let, Opm::fun::iota( num_tables ) );
+                    return mapRegions( tm, famI_let );
                 else
                     throw std::domain_error("Either SWOF or SWOFLET tables must be provided");
 
             case SatfuncFamily::II:
                 if( !swfnTables.empty() )
-                    return Opm::fun::map( famII, Opm::fun::iota( num_tables ) );
+                    return mapRegions( tm, famII );
                 else
-                    return Opm::fun::map( famII_sgwfn, Opm::fun::iota( num_tables ) );
-            case SatfuncFamily::III: return Opm::fun::map( famIII, Opm::fun::iota( num_tables ) );
+                    return mapRegions( tm, famII_sgwfn );
+            case SatfuncFamily::III: return mapRegions( tm, famIII );
 
             default: throw std::domain_error("No valid saturation keyword family specified");
         }
@@ -580,19 +649,19 @@ namespace {
                     throw std::runtime_error( "Saturation keyword family I requires either sgof or slgof non-empty" );
 
                 if( !sgofTables.empty() )
-                    return Opm::fun::map( famI_sgof, Opm::fun::iota( num_tables ) );
+                    return mapRegions( tm, famI_sgof );
                 else if( !sgofLetTables.empty() )
-                    return Opm::fun::map( famI_sgof_let, Opm::fun::iota( num_tables ) );
+                    return mapRegions( tm, famI_sgof_let );
                 else
-                    return Opm::fun::map( famI_slgof, Opm::fun::iota( num_tables ) );
+                    return mapRegions( tm, famI_slgof );
 
             case SatfuncFamily::II:
                 if( !sgfnTables.empty() )
-                    return Opm::fun::map( famII, Opm::fun::iota( num_tables ) );
+                    return mapRegions( tm, famII );
                 else
-                    return Opm::fun::map( famII_sgwfn, Opm::fun::iota( num_tables ) );
+                    return mapRegions( tm, famII_sgwfn );
             case SatfuncFamily::III:
-                return Opm::fun::map( famIII, Opm::fun::iota( num_tables ) );
+                return mapRegions( tm, famIII );
 
             default:
                 throw std::domain_error("No valid saturation keyword family specified");
@@ -681,16 +750,16 @@ namespace {
         switch( getSaturationFunctionFamily( tm, ph ) ) {
             case SatfuncFamily::I:
                 if( !swofTables.empty() )
-                    return Opm::fun::map( famI, Opm::fun::iota( num_tables ) );
+                    return mapRegions( tm, famI );
                 else if ( !swofLetTables.empty() )
-                    return Opm::fun::map( famI_let, Opm::fun::iota( num_tables ) );
+                    return mapRegions( tm, famI_let );
                 else
                     throw std::domain_error("Either SWOF or SWOFLET tables must be provided");
 
             case SatfuncFamily::II:
                 return ph.active(::Opm::Phase::GAS)
-                    ? Opm::fun::map( famII_3p, Opm::fun::iota( num_tables ) )
-                    : Opm::fun::map( famII_2p, Opm::fun::iota( num_tables ) );
+                    ? mapRegions( tm, famII_3p )
+                    : mapRegions( tm, famII_2p );
             case SatfuncFamily::III:
                 throw std::domain_error("Saturation keyword family III is not applicable for a oil system");
             default: throw std::domain_error("No valid saturation keyword family specified");
@@ -776,16 +845,16 @@ namespace {
                     throw std::runtime_error( "Saturation keyword family I requires either sgof or slgof non-empty" );
 
                 if( !sgofTables.empty() )
-                    return Opm::fun::map( famI_sgof, Opm::fun::iota( num_tables ) );
+                    return mapRegions( tm, famI_sgof );
                 else if( !sgofLetTables.empty() )
-                    return Opm::fun::map( famI_sgof_let, Opm::fun::iota( num_tables ) );
+                    return mapRegions( tm, famI_sgof_let );
                 else
-                    return Opm::fun::map( famI_slgof, Opm::fun::iota( num_tables ) );
+                    return mapRegions( tm, famI_slgof );
 
             case SatfuncFamily::II:
                 return ph.active(::Opm::Phase::WATER)
-                    ? Opm::fun::map( famII_3p, Opm::fun::iota( num_tables ) )
-                    : Opm::fun::map( famII_2p, Opm::fun::iota( num_tables ) );
+                    ? mapRegions( tm, famII_3p )
+                    : mapRegions( tm, famII_2p );
             case SatfuncFamily::III:
                 throw std::domain_error("Saturation keyword family III is not applicable for a oil system");
             default:
@@ -838,18 +907,18 @@ namespace {
                 if( sgofTables.empty() && sgofLetTables.empty() && slgofTables.empty() )
                     throw std::runtime_error( "Saturation keyword family I requires either sgof or slgof non-empty" );
                 if( !sgofTables.empty() )
-                    return Opm::fun::map( famI_sgof, Opm::fun::iota( num_tables ) );
+                    return mapRegions( tm, famI_sgof );
                 else if( !sgofLetTables.empty() )
-                    return Opm::fun::map( famI_sgof_let, Opm::fun::iota( num_tables ) );
+                    return mapRegions( tm, famI_sgof_let );
                 else
-                    return Opm::fun::map( famI_slgof, Opm::fun::iota( num_tables ) );
+                    return mapRegions( tm, famI_slgof );
             case SatfuncFamily::II:
                 if( !sgfnTables.empty() )
-                    return Opm::fun::map( famII, Opm::fun::iota( num_tables ) );
+                    return mapRegions( tm, famII );
                 else
-                    return Opm::fun::map( famII_sgwfn, Opm::fun::iota( num_tables ) );
+                    return mapRegions( tm, famII_sgwfn );
             case SatfuncFamily::III:
-                return Opm::fun::map( famIII, Opm::fun::iota( num_tables ) );
+                return mapRegions( tm, famIII );
             default:
                 throw std::domain_error("No valid saturation keyword family specified");
         }
@@ -937,18 +1006,18 @@ namespace {
                 if( sgofTables.empty() && sgofLetTables.empty() && slgofTables.empty() )
                     throw std::runtime_error( "Saturation keyword family I requires either sgof or slgof non-empty" );
                 if( !sgofTables.empty() )
-                    return Opm::fun::map( famI_sgof, Opm::fun::iota( num_tables ) );
+                    return mapRegions( tm, famI_sgof );
                 else if( !sgofLetTables.empty() )
-                    return Opm::fun::map( famI_sgof_let, Opm::fun::iota( num_tables ) );
+                    return mapRegions( tm, famI_sgof_let );
                 else
-                    return Opm::fun::map( famI_slgof, Opm::fun::iota( num_tables ) );
+                    return mapRegions( tm, famI_slgof );
             case SatfuncFamily::II:
                 if( !sgfnTables.empty() )
-                    return Opm::fun::map( famII, Opm::fun::iota( num_tables ) );
+                    return mapRegions( tm, famII );
                 else
-                    return Opm::fun::map( famII_sgwfn, Opm::fun::iota( num_tables ) );
+                    return mapRegions( tm, famII_sgwfn );
             case SatfuncFamily::III:
-                return Opm::fun::map( famIII, Opm::fun::iota( num_tables ) );
+                return mapRegions( tm, famIII );
             default:
                 throw std::domain_error("No valid saturation keyword family specified");
         }
@@ -1025,19 +1094,19 @@ namespace {
         switch( getSaturationFunctionFamily( tm, ph ) ) {
             case SatfuncFamily::I:
                 if( !swofTables.empty() )
-                    return Opm::fun::map( famI, Opm::fun::iota( num_tables ) );
+                    return mapRegions( tm, famI );
                 else if( !swofLetTables.empty() )
-                    return Opm::fun::map( famI_let, Opm::fun::iota( num_tables ) );
+                    return mapRegions( tm, famI_let );
                 else
                     throw std::domain_error("Either SWOF or SWOFLET tables must be provided");
 
             case SatfuncFamily::II:
                 if( !swfnTables.empty() )
-                    return Opm::fun::map( famII, Opm::fun::iota( num_tables ) );
+                    return mapRegions( tm, famII );
                 else
-                    return Opm::fun::map( famII_sgwfn, Opm::fun::iota( num_tables ) );
+                    return mapRegions( tm, famII_sgwfn );
             case SatfuncFamily::III:
-                return Opm::fun::map( famIII, Opm::fun::iota( num_tables ) );
+                return mapRegions( tm, famIII );
             default:
                 throw std::domain_error("No valid saturation keyword family specified");
         }
@@ -1094,16 +1163,16 @@ namespace {
         switch( getSaturationFunctionFamily( tm, ph ) ) {
             case SatfuncFamily::I:
                 if ( !swofTables.empty() )
-                    return Opm::fun::map( famI, Opm::fun::iota( num_tables ) );
+                    return mapRegions( tm, famI );
                 else if ( !swofLetTables.empty() )
-                    return Opm::fun::map( famI_let, Opm::fun::iota( num_tables ) );
+                    return mapRegions( tm, famI_let );
                 else
                     throw std::domain_error("Either SWOF or SWOFLET tables must be provided");
 
             case SatfuncFamily::II:
                 return ph.active(::Opm::Phase::GAS)
-                    ? Opm::fun::map( famII_3p, Opm::fun::iota( num_tables ) )
-                    : Opm::fun::map( famII_2p, Opm::fun::iota( num_tables ) );
+                    ? mapRegions( tm, famII_3p )
+                    : mapRegions( tm, famII_2p );
             case SatfuncFamily::III:
                 throw std::domain_error("Saturation keyword family III is not applicable for a oil system");
             default:
@@ -1173,15 +1242,15 @@ namespace {
                 if( sgofTables.empty() && sgofLetTables.empty() && slgofTables.empty() )
                     throw std::runtime_error( "Saturation keyword family I requires either sgof or slgof non-empty" );
                 if( !sgofTables.empty() )
-                    return Opm::fun::map( famI_sgof, Opm::fun::iota( num_tables ) );
+                    return mapRegions( tm, famI_sgof );
                 else if( !sgofLetTables.empty() )
-                    return Opm::fun::map( famI_sgof_let, Opm::fun::iota( num_tables ) );
+                    return mapRegions( tm, famI_sgof_let );
                 else
-                    return Opm::fun::map( famI_slgof, Opm::fun::iota( num_tables ) );
+                    return mapRegions( tm, famI_slgof );
             case SatfuncFamily::II:
                 return ph.active(::Opm::Phase::WATER)
-                    ? Opm::fun::map( famII_3p, Opm::fun::iota( num_tables ) )
-                    : Opm::fun::map( famII_2p, Opm::fun::iota( num_tables ) );
+                    ? mapRegions( tm, famII_3p )
+                    : mapRegions( tm, famII_2p );
             case SatfuncFamily::III:
                 throw std::domain_error("Saturation keyword family III is not applicable for a oil system");
             default:
@@ -1243,18 +1312,18 @@ namespace {
                 if( sgofTables.empty() && sgofLetTables.empty() && slgofTables.empty() )
                     throw std::runtime_error( "Saturation keyword family I requires either sgof or slgof non-empty" );
                 if( !sgofTables.empty() )
-                    return Opm::fun::map( famI_sgof, Opm::fun::iota( num_tables ) );
+                    return mapRegions( tm, famI_sgof );
                 else if( !sgofLetTables.empty() )
-                    return Opm::fun::map( famI_sgof_let, Opm::fun::iota( num_tables ) );
+                    return mapRegions( tm, famI_sgof_let );
                 else
-                    return Opm::fun::map( famI_slgof, Opm::fun::iota( num_tables ) );
+                    return mapRegions( tm, famI_slgof );
             case SatfuncFamily::II:
                 if( !sgfnTables.empty() )
-                    return Opm::fun::map( famII, Opm::fun::iota( num_tables ) );
+                    return mapRegions( tm, famII );
                 else
-                    return Opm::fun::map( famII_sgwfn, Opm::fun::iota( num_tables ) );
+                    return mapRegions( tm, famII_sgwfn );
             case SatfuncFamily::III:
-                return Opm::fun::map( famIII, Opm::fun::iota( num_tables ) );
+                return mapRegions( tm, famIII );
             default:
                 throw std::domain_error("No valid saturation keyword family specified");
         }
@@ -1289,14 +1358,14 @@ namespace {
         switch( getSaturationFunctionFamily( tm, ph ) ) {
             case SatfuncFamily::I:
                 if (!swofTables.empty())
-                    return Opm::fun::map( famI, Opm::fun::iota( num_tables ) );
+                    return mapRegions( tm, famI );
                 else if (!swofLetTables.empty())
-                    return Opm::fun::map( famI_let, Opm::fun::iota( num_tables ) );
+                    return mapRegions( tm, famI_let );
                 else
                     throw std::domain_error("Either SWOF or SWOFLET tables must be provided");
 
             case SatfuncFamily::II:
-                return Opm::fun::map( famII, Opm::fun::iota( num_tables ) );
+                return mapRegions( tm, famII );
             case SatfuncFamily::III:
                 return std::vector<double>(num_tables, 0.0);
             default:
@@ -1353,18 +1422,18 @@ namespace {
         switch( getSaturationFunctionFamily( tm, ph ) ) {
             case SatfuncFamily::I:
                 if ( !other_f1.empty() )
-                    return Opm::fun::map( famI, Opm::fun::iota( num_tables ) );
+                    return mapRegions( tm, famI );
                 else if ( !wat_f1_let.empty() )
-                    return Opm::fun::map( famI_let_wat, Opm::fun::iota( num_tables ) );
+                    return mapRegions( tm, famI_let_wat );
                 else if ( !gas_f1_let.empty() )
-                    return Opm::fun::map( famI_let_gas, Opm::fun::iota( num_tables ) );
+                    return mapRegions( tm, famI_let_gas );
                 else
                     throw std::domain_error("Valid family I tables must be provided");
 
             case SatfuncFamily::II:
                 return ph.active(::Opm::Phase::GAS) && ph.active(::Opm::Phase::WATER)
-                    ? Opm::fun::map( famII_3p, Opm::fun::iota( num_tables ) )
-                    : Opm::fun::map( famII_2p, Opm::fun::iota( num_tables ) );
+                    ? mapRegions( tm, famII_3p )
+                    : mapRegions( tm, famII_2p );
             case SatfuncFamily::III:
                 throw std::domain_error("Saturation keyword family III is not applicable for a oil system");
             default:
@@ -1410,18 +1479,18 @@ namespace {
         switch( getSaturationFunctionFamily( tm, ph ) ) {
             case SatfuncFamily::I:
                 if( !swofTables.empty() )
-                    return Opm::fun::map( famI, Opm::fun::iota( num_tables ) );
+                    return mapRegions( tm, famI );
                 else if( !swofLetTables.empty() )
-                    return Opm::fun::map( famI_let, Opm::fun::iota( num_tables ) );
+                    return mapRegions( tm, famI_let );
                 else
                     throw std::domain_error("Either SWOF or SWOFLET tables must be provided");
             case SatfuncFamily::II:
                 if( !swfnTables.empty() )
-                    return Opm::fun::map( famII, Opm::fun::iota( num_tables ) );
+                    return mapRegions( tm, famII );
                 else
-                    return Opm::fun::map( famII_sgwfn, Opm::fun::iota( num_tables ) );
+                    return mapRegions( tm, famII_sgwfn );
             case SatfuncFamily::III:
-                return Opm::fun::map( famIII, Opm::fun::iota( num_tables ) );
+                return mapRegions( tm, famIII );
             default:
                 throw std::domain_error("No valid saturation keyword family specified");
         }
@@ -1438,9 +1507,6 @@ namespace {
 
         const auto& table = depthTables.getTable( tableIdx );
 
-        if( tableIdx >= int( depthTables.size() ) )
-            throw std::invalid_argument("Not enough tables!");
-
         // evaluate the table at the cell depth
         const double value = table.evaluate( columnName, cellDepth );
 
@@ -1451,6 +1517,18 @@ namespace {
         return value;
     }
 
+    // Throws if selectValue() cannot use depth table 'tableIdx'.
+    void checkDepthTable(const Opm::TableContainer& depthTables,
+                         int tableIdx)
+    {
+        if( tableIdx < 0 ) return;
+
+        depthTables.getTable( tableIdx );
+
+        if( tableIdx >= int( depthTables.size() ) )
+            throw std::invalid_argument("Not enough tables!");
+    }
+
     void checkSatRegions(const std::size_t  cellIdx,
                          const int          satfunc,
                          const int          endfunc,
@@ -1485,18 +1563,28 @@ namespace {
         // assign a NaN in this case...
         const bool useEnptvd = tableManager.useEnptvd();
         const auto& enptvdTables = tableManager.getEnptvdTables();
+
+        // Validate all cells up front, as the evaluation loop below
+        // must not throw.
         for( size_t cellIdx = 0; cellIdx < values.size(); cellIdx++ ) {
             int satTableIdx = satnum_data[cellIdx] - 1;
             int endNum = endnum_data[cellIdx] - 1;
 
             // Active cell better have {SAT,END}NUM > 0.
             checkSatRegions(cellIdx, satTableIdx, endNum, "SATNUM");
+            checkDepthTable(enptvdTables, (useEnptvd && endNum >= 0) ? endNum : -1);
+        }
+
+#pragma omp parallel for schedule(static)
+        for( size_t cellIdx = 0; cellIdx < values.size(); cellIdx++ ) {
+            int satTableIdx = satnum_data[cellIdx] - 1;
+            int endNum = endnum_data[cellIdx] - 1;
 
             values[cellIdx] = selectValue(enptvdTables,
                                           (useEnptvd && endNum >= 0) ? endNum : -1,
                                           columnName,
                                           cell_depth[cellIdx],
-                                          fallbackValues[ satTableIdx ],
+                                          fallbackValues[satTableIdx],
                                           useOneMinusTableValue);
         }
 
@@ -1522,12 +1610,22 @@ namespace {
         // assign a NaN in this case...
         const bool useImptvd = tableManager.useImptvd();
         const Opm::TableContainer& imptvdTables = tableManager.getImptvdTables();
+
+        // Validate all cells up front, as the evaluation loop below
+        // must not throw.
         for( size_t cellIdx = 0; cellIdx < values.size(); cellIdx++ ) {
-            int imbTableIdx = imbnum_data[ cellIdx ] - 1;
-            int endNum = endnum_data[ cellIdx ] - 1;
+            int imbTableIdx = imbnum_data[cellIdx] - 1;
+            int endNum = endnum_data[cellIdx] - 1;
 
             // Active cell better have {IMB,END}NUM > 0.
             checkSatRegions(cellIdx, imbTableIdx, endNum, "IMBNUM");
+            checkDepthTable(imptvdTables, (useImptvd && endNum >= 0) ? endNum : -1);
+        }
+
+#pragma omp parallel for schedule(static)
+        for( size_t cellIdx = 0; cellIdx < values.size(); cellIdx++ ) {
+            int imbTableIdx = imbnum_data[cellIdx] - 1;
+            int endNum = endnum_data[cellIdx] - 1;
 
             values[cellIdx] = selectValue(imptvdTables,
                                           (useImptvd && endNum >= 0) ? endNum : -1,
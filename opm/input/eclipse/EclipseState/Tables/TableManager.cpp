@@ -20,11 +20,15 @@
 
 #include <algorithm>
 #include <cmath>
+#include <cstddef>
+#include <functional>
 #include <iomanip>
 #include <ios>
 #include <iterator>
 #include <memory>
 #include <sstream>
+#include <unordered_map>
+#include <vector>
 
 #include <fmt/format.h>
 
@@ -33,6 +37,7 @@
 #include <opm/common/OpmLog/LogUtil.hpp>
 #include <opm/common/OpmLog/StreamLog.hpp>
 
+#include <opm/common/utility/ConcurrentTasks.hpp>
 #include <opm/common/utility/OpmInputError.hpp>
 
 #include <opm/input/eclipse/Parser/ParserKeywords/A.hpp>
@@ -127,6 +132,91 @@ std::optional<JFunc> make_jfunc(const Deck& deck) {
     return JFunc(deck);
 }
 
+std::size_t tableDataHash(const DeckItem& dataItem)
+{
+    auto seed = dataItem.data_size();
+    for (const auto& value : dataItem.getData<double>()) {
+        seed ^= std::hash<double>{}(value) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+    }
+
+    return seed;
+}
+
+// Index of the record from which each region's table is created.  An
+// empty record repeats the previous region's table, and records with
+// identical data refer to the first such record, so that these regions
+// may share a single table object.
+std::vector<std::size_t> tableSources(const DeckKeyword& tableKeyword)
+{
+    auto sources = std::vector<std::size_t>(tableKeyword.size());
+    auto distinct = std::unordered_multimap<std::size_t, std::size_t>{};
+
+    for (auto tableIdx = 0*tableKeyword.size(); tableIdx < tableKeyword.size(); ++tableIdx) {
+        const auto& dataItem = tableKeyword.getRecord(tableIdx).getItem("DATA");
+
+        if (dataItem.data_size() == 0) {
+            if (tableIdx == 0) {
+                throw OpmInputError {
+                    fmt::format("Cannot default region {}'s table data", tableIdx + 1),
+                    tableKeyword.location()
+                };
+            }
+
+            sources[tableIdx] = sources[tableIdx - 1];
+            continue;
+        }
+
+        const auto [begin, end] = distinct.equal_range(tableDataHash(dataItem));
+        const auto same = std::find_if(begin, end, [&tableKeyword, &dataItem](const auto& candidate)
+        {
+            return tableKeyword.getRecord(candidate.second).getItem("DATA")
+                .equal(dataItem, /* cmp_default = */ true, /* cmp_numeric = */ false);
+        });
+
+        if (same != end) {
+            sources[tableIdx] = same->second;
+        }
+        else {
+            distinct.emplace(tableDataHash(dataItem), tableIdx);
+            sources[tableIdx] = tableIdx;
+        }
+    }
+
+    return sources;
+}
+
+// Create the distinct tables of a region-keyed table keyword, in parallel,
+// and add one table per region to the container.
+template <class TableType, class MakeTable>
+void internaliseTables(const DeckKeyword& tableKeyword,
+                       TableContainer&    container,
+                       MakeTable&&        makeTable)
+{
+    const auto sources = tableSources(tableKeyword);
+
+    auto tables = std::vector<std::shared_ptr<TableType>>(sources.size());
+    forEachConcurrently(sources.size(), [&](const std::size_t tableIdx)
+    {
+        if (sources[tableIdx] != tableIdx) {
+            return;
+        }
+
+        try {
+            tables[tableIdx] = makeTable(tableKeyword.getRecord(tableIdx).getItem("DATA"), tableIdx);
+        }
+        catch (const std::runtime_error& err) {
+            throw OpmInputError(err, tableKeyword.location());
+        }
+        catch (const std::invalid_argument& err) {
+            throw OpmInputError(err, tableKeyword.location());
+        }
+    });
+
+    for (auto tableIdx = 0*sources.size(); tableIdx < sources.size(); ++tableIdx) {
+        container.addTable(tableIdx, tables[sources[tableIdx]]);
+    }
+}
+
 }
 
 
@@ -149,19 +239,22 @@ std::optional<JFunc> make_jfunc(const Deck& deck) {
         m_salinity = ParserKeywords::SALINITY::MOLALITY::defaultValue;
 
         initDims( deck );
-        initSimpleTables( deck );
-        initFullTables(deck, "PVTG", m_pvtgTables);
-        initFullTables(deck, "PVTGW", m_pvtgwTables);
-        initFullTables(deck, "PVTGWO", m_pvtgwoTables);
-        initFullTables(deck, "PVTO", m_pvtoTables);
+
+        // The table families populate distinct members and are
+        // internalised concurrently.
+        runConcurrently({
+            [this, &deck]() { this->initSimpleTables(deck); },
+            [this, &deck]() { this->initFullTables(deck, "PVTG", this->m_pvtgTables); },
+            [this, &deck]() { this->initFullTables(deck, "PVTGW", this->m_pvtgwTables); },
+            [this, &deck]() { this->initFullTables(deck, "PVTGWO", this->m_pvtgwoTables); },
+            [this, &deck]() { this->initFullTables(deck, "PVTO", this->m_pvtoTables); },
+            [this, &deck]() { this->initFullTables(deck, "PVTSOL", this->m_pvtsolTables); },
+        });
 
         if (deck.hasKeyword<ParserKeywords::PVTO>()) {
             this->checkPVTOMonotonicity(deck);
         }
 
-        if( deck.hasKeyword( "PVTSOL" ) )
-           initFullTables(deck, "PVTSOL", m_pvtsolTables);
-
         if( deck.hasKeyword( "PVTW" ) )
             this->m_pvtwTable = PvtwTable( deck["PVTW"].back() );
 
@@ -1554,32 +1647,9 @@ std::optional<JFunc> make_jfunc(const Deck& deck) {
             return;
         }
 
-        auto lastComplete = 0 * numTables;
-        const auto& tableKeyword = deck[keywordName].back();
-        for (size_t tableIdx = 0; tableIdx < tableKeyword.size(); ++tableIdx) {
-            const auto& dataItem = tableKeyword.getRecord( tableIdx ).getItem("DATA");
-            if (dataItem.data_size() > 0) {
-                try {
-                    std::shared_ptr<TableType> table = std::make_shared<TableType>( dataItem, useJFunc(), tableIdx );
-                    container.addTable( tableIdx , table );
-                    lastComplete = tableIdx;
-                } catch (const std::runtime_error& err) {
-                    throw OpmInputError(err, tableKeyword.location());
-                } catch (const std::invalid_argument& err) {
-                    throw OpmInputError(err, tableKeyword.location());
-                }
-            }
-            else if (tableIdx > static_cast<size_t>(0)) {
-                const auto& item = tableKeyword.getRecord(lastComplete).getItem("DATA");
-                container.addTable(tableIdx, std::make_shared<TableType>(item, useJFunc(), tableIdx));
-            }
-            else {
-                throw OpmInputError {
-                    fmt::format("Cannot default region {}'s table data", tableIdx + 1),
-                    tableKeyword.location()
-                };
-            }
-        }
+        internaliseTables<TableType>(deck[keywordName].back(), container,
+            [useJFunc = this->useJFunc()](const DeckItem& dataItem, const std::size_t tableIdx)
+            { return std::make_shared<TableType>(dataItem, useJFunc, tableIdx); });
     }
 
     template <class TableType>
@@ -1599,34 +1669,9 @@ std::optional<JFunc> make_jfunc(const Deck& deck) {
 
         auto& container = forceGetTables(tableName, numTables);
 
-        auto lastComplete = 0 * numTables;
-        const auto& tableKeyword = deck[keywordName].back();
-        for (size_t tableIdx = 0; tableIdx < tableKeyword.size(); ++tableIdx) {
-            const auto& dataItem = tableKeyword.getRecord(tableIdx).getItem("DATA");
-
-            if (dataItem.data_size() > 0) {
-                try {
-                    container.addTable(tableIdx, std::make_shared<TableType>(dataItem, tableIdx));
-                    lastComplete = tableIdx;
-                }
-                catch (const std::runtime_error& err) {
-                    throw OpmInputError(err, tableKeyword.location());
-                }
-                catch (const std::invalid_argument& err) {
-                    throw OpmInputError(err, tableKeyword.location());
-                }
-            }
-            else if (tableIdx > static_cast<size_t>(0)) {
-                const auto& item = tableKeyword.getRecord(lastComplete).getItem("DATA");
-                container.addTable(tableIdx, std::make_shared<TableType>(item, tableIdx));
-            }
-            else {
-                throw OpmInputError {
-                    fmt::format("Cannot default region {}'s table data", tableIdx + 1),
-                    tableKeyword.location()
-                };
-            }
-        }
+        internaliseTables<TableType>(deck[keywordName].back(), container,
+            [](const DeckItem& dataItem, const std::size_t tableIdx)
+            { return std::make_shared<TableType>(dataItem, tableIdx); });
     }
 
     template <class TableType>
@@ -1691,9 +1736,16 @@ std::optional<JFunc> make_jfunc(const Deck& deck) {
 
         const auto& tableKeyword = deck[keywordName].back();
 
-        int numTables = TableType::numTables( tableKeyword );
-        for (int tableIdx = 0; tableIdx < numTables; ++tableIdx)
-            tableVector.emplace_back( tableKeyword , tableIdx );
+        const auto numTables = static_cast<std::size_t>(TableType::numTables( tableKeyword ));
+
+        // Regions are independent of one another.
+        auto tables = std::vector<TableType>(numTables);
+        forEachConcurrently(numTables, [&tables, &tableKeyword](const std::size_t tableIdx)
+        {
+            tables[tableIdx] = TableType(tableKeyword, static_cast<int>(tableIdx));
+        });
+
+        std::move(tables.begin(), tables.end(), std::back_inserter(tableVector));
     }
 
 }
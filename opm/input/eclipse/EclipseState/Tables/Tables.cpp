@@ -2554,8 +2554,7 @@ namespace
     bool all_defaulted(const DeckRecord& record)
     {
         return std::all_of(record.begin(), record.end(), [](const DeckItem& item) {
-            const auto& vstat = item.getValueStatus();
-            return std::all_of(vstat.begin(), vstat.end(), &value::defaulted);
+            return item.getValueStatus().all_of(&value::defaulted);
         });
     }
 
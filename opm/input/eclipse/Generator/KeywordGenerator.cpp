@@ -23,6 +23,7 @@
 
 #include <opm/json/JsonObject.hpp>
 
+#include <opm/input/eclipse/Parser/BuiltinKeywordTable.hpp>
 #include <opm/input/eclipse/Parser/ParserKeyword.hpp>
 
 #include <cctype>
@@ -31,6 +32,7 @@
 #include <map>
 #include <sstream>
 #include <string>
+#include <vector>
 
 #include <fmt/format.h>
 
@@ -214,24 +216,55 @@ void Builtin::emplace{}() const
         newSource << R"(// Generated code.  Please do not edit this file directly.
 
 #include <opm/input/eclipse/Parser/Parser.hpp>
+#include <opm/input/eclipse/Parser/BuiltinKeywordTable.hpp>
 #include <opm/input/eclipse/Parser/ParserKeywords/Builtin.hpp>
 )";
 
+        // Keywords matching a regular expression and code keywords take
+        // part in every parse and are therefore added eagerly.  All other
+        // keywords are entered into the builtin keyword table and
+        // constructed on first lookup.
+        auto isEager = [](const ParserKeyword& kw)
+        {
+            return kw.hasMatchRegex() || kw.isCodeKeyword();
+        };
+
+        std::vector<std::string> factories;
+        std::map<std::string, std::size_t> deckNameKeyword;
+
         for (const auto& [first_char, keywords] : loader) {
+            std::stringstream declarations;
+            for (const auto& kw : keywords) {
+                if (isEager(kw)) {
+                    continue;
+                }
+
+                declarations << fmt::format("    ::Opm::ParserKeyword make_{}();\n", kw.className());
+
+                for (const auto& deck_name : kw.deck_names()) {
+                    // Later keywords take precedence, as when adding
+                    // keywords to the parser in sequence.
+                    deckNameKeyword.insert_or_assign(deck_name, factories.size());
+                }
+
+                factories.push_back(kw.className());
+            }
+
             const auto header = fmt::format(R"(#ifndef OPM_PARSER_INIT_{0}_HPP
 #define OPM_PARSER_INIT_{0}_HPP
 
 // Generated code.  Please do not edit this file directly.
 
-namespace Opm {{ class Parser; }}
+namespace Opm {{ class Parser; class ParserKeyword; }}
 
 namespace Opm::ParserKeywords {{
     void addDefaultKeywords{0}(Parser& p);
-}} // namespace Opm::ParserKeywords
+
+{1}}} // namespace Opm::ParserKeywords
 
 #endif // OPM_PARSER_INIT_{0}_HPP
 )",
-                                                   first_char);
+                                                   first_char, declarations.str());
 
             auto charHeaderFile = parserInitSource;
             charHeaderFile.replace_filename(
@@ -249,16 +282,25 @@ namespace Opm::ParserKeywords {{
 
 void Opm::ParserKeywords::addDefaultKeywords{0}([[maybe_unused]] Parser& p)
 {{
-    // Built-in '{0}' keywords.
+    // Built-in '{0}' keywords which are not in the builtin keyword table.
 )",
                                      first_char);
 
             for (const auto& kw : keywords) {
-                sourceStr << fmt::format("    p.addParserKeyword({}{{}});", kw.className()) << '\n';
+                if (isEager(kw)) {
+                    sourceStr << fmt::format("    p.addParserKeyword({}{{}});", kw.className()) << '\n';
+                }
             }
 
             // End of Opm::ParserKeywords::addDefaultKeywords{0}()
-            sourceStr << "}\n";
+            sourceStr << "}\n\n";
+
+            for (const auto& kw : keywords) {
+                if (! isEager(kw)) {
+                    sourceStr << fmt::format("::Opm::ParserKeyword Opm::ParserKeywords::make_{0}() {{ return {0}{{}}; }}\n",
+                                             kw.className());
+                }
+            }
 
             const auto charSourceFile = std::filesystem::path(sourcePath) / fmt::format("ParserInit{}.cpp", first_char);
             write_file(sourceStr, charSourceFile, m_verbose, fmt::format("init source for {}", first_char));
@@ -267,9 +309,65 @@ void Opm::ParserKeywords::addDefaultKeywords{0}([[maybe_unused]] Parser& p)
                                      first_char);
         }
 
+        std::vector<std::string> deckNames;
+        deckNames.reserve(deckNameKeyword.size());
+        for (const auto& deck_name : deckNameKeyword) {
+            deckNames.push_back(deck_name.first);
+        }
+
+        const auto layout = ParserKeywords::buildPerfectHash(deckNames);
+
         newSource << R"(
+#include <array>
+#include <cstdint>
+
+namespace {
+
+using Table = ::Opm::ParserKeywords::BuiltinKeywordTable;
+
+)";
+
+        newSource << fmt::format("constexpr std::array<Table::Factory, {}> factories {{\n", factories.size());
+        for (const auto& className : factories) {
+            newSource << fmt::format("    &::Opm::ParserKeywords::make_{},\n", className);
+        }
+        newSource << "};\n\n";
+
+        newSource << fmt::format("constexpr std::array<std::uint32_t, {}> seeds {{\n", layout.seeds.size());
+        for (const auto& seed : layout.seeds) {
+            newSource << fmt::format("    {}u,\n", seed);
+        }
+        newSource << "};\n\n";
+
+        newSource << fmt::format("constexpr std::array<Table::Entry, {}> entries {{{{\n", layout.slots.size());
+        for (const auto& slot : layout.slots) {
+            if (slot == ParserKeywords::PerfectHashLayout::npos) {
+                newSource << "    {},\n";
+            }
+            else {
+                const auto& deck_name = deckNames[slot];
+                newSource << fmt::format("    {{ \"{}\", {}u }},\n", deck_name, deckNameKeyword.at(deck_name));
+            }
+        }
+        newSource << "}};\n\n";
+
+        newSource << R"(constexpr Table table {
+    entries.data(), entries.size(),
+    seeds.data(), seeds.size(),
+    factories.data(), factories.size(),
+};
+
+} // Anonymous namespace
+
+const Opm::ParserKeywords::BuiltinKeywordTable& Opm::ParserKeywords::builtinKeywordTable()
+{
+    return table;
+}
+
 void Opm::Parser::addDefaultKeywords()
 {
+    this->m_builtinKeywords = ParserKeywords::BuiltinKeywords { ParserKeywords::builtinKeywordTable() };
+
 )";
 
         for (const auto& kw_pair : loader) {
@@ -0,0 +1,244 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <opm/input/eclipse/Parser/BuiltinKeywordTable.hpp>
+
+#include <opm/input/eclipse/Parser/ParserKeyword.hpp>
+
+#include <algorithm>
+#include <limits>
+#include <numeric>
+#include <stdexcept>
+#include <utility>
+
+namespace {
+
+    // Try to place all names of a single bucket using a particular seed.
+    // Returns false, and leaves 'occupied' unchanged, if two names of the
+    // bucket collide or if any slot is taken.
+    bool placeBucket(const std::vector<std::string>& names,
+                     const std::vector<std::size_t>& bucket,
+                     const std::uint32_t             seed,
+                     std::vector<std::size_t>&       slots,
+                     std::vector<std::size_t>&       candidate)
+    {
+        candidate.clear();
+        for (const auto& name : bucket) {
+            const auto slot = Opm::ParserKeywords::keywordNameHash(names[name], seed) % slots.size();
+            if ((slots[slot] != Opm::ParserKeywords::PerfectHashLayout::npos) ||
+                (std::find(candidate.begin(), candidate.end(), slot) != candidate.end()))
+            {
+                return false;
+            }
+
+            candidate.push_back(slot);
+        }
+
+        for (auto i = 0*bucket.size(); i < bucket.size(); ++i) {
+            slots[candidate[i]] = bucket[i];
+        }
+
+        return true;
+    }
+
+} // Anonymous namespace
+
+namespace Opm::ParserKeywords {
+
+PerfectHashLayout buildPerfectHash(const std::vector<std::string>& names)
+{
+    auto layout = PerfectHashLayout{};
+    if (names.empty()) {
+        return layout;
+    }
+
+    // A load factor of 0.8 and an average of four names per bucket keeps
+    // the seed search short for the few thousand builtin keywords.
+    const auto numSlots = names.size() + names.size() / 4 + 1;
+    const auto numBuckets = (names.size() + 3) / 4;
+
+    auto buckets = std::vector<std::vector<std::size_t>>(numBuckets);
+    for (auto name = 0*names.size(); name < names.size(); ++name) {
+        buckets[keywordNameHash(names[name], 0) % numBuckets].push_back(name);
+    }
+
+    // Place the largest buckets first, while most slots are still free.
+    auto order = std::vector<std::size_t>(numBuckets);
+    std::iota(order.begin(), order.end(), std::size_t{0});
+    std::stable_sort(order.begin(), order.end(),
+                     [&buckets](const std::size_t b1, const std::size_t b2)
+                     { return buckets[b1].size() > buckets[b2].size(); });
+
+    layout.seeds.assign(numBuckets, 0);
+    layout.slots.assign(numSlots, PerfectHashLayout::npos);
+
+    auto candidate = std::vector<std::size_t>{};
+    for (const auto& b : order) {
+        if (buckets[b].empty()) {
+            break;
+        }
+
+        auto seed = std::uint32_t{1};
+        while (! placeBucket(names, buckets[b], seed, layout.slots, candidate)) {
+            if (seed == std::numeric_limits<std::uint32_t>::max()) {
+                throw std::logic_error {
+                    "Unable to construct perfect hash of keyword names.  "
+                    "Are the names distinct?"
+                };
+            }
+
+            ++seed;
+        }
+
+        layout.seeds[b] = seed;
+    }
+
+    return layout;
+}
+
+// ---------------------------------------------------------------------------
+
+BuiltinKeywords::BuiltinKeywords(const BuiltinKeywordTable& table)
+    : table_ { &table }
+{
+    this->allocateCache();
+}
+
+BuiltinKeywords::BuiltinKeywords(const BuiltinKeywords& rhs)
+    : table_ { rhs.table_ }
+{
+    this->allocateCache();
+}
+
+BuiltinKeywords::BuiltinKeywords(BuiltinKeywords&& rhs) noexcept
+    : table_ { std::exchange(rhs.table_, nullptr) }
+    , cache_ { std::move(rhs.cache_) }
+{}
+
+BuiltinKeywords& BuiltinKeywords::operator=(const BuiltinKeywords& rhs)
+{
+    if (this != &rhs) {
+        this->releaseCache();
+        this->table_ = rhs.table_;
+        this->allocateCache();
+    }
+
+    return *this;
+}
+
+BuiltinKeywords& BuiltinKeywords::operator=(BuiltinKeywords&& rhs) noexcept
+{
+    if (this != &rhs) {
+        this->releaseCache();
+        this->table_ = std::exchange(rhs.table_, nullptr);
+        this->cache_ = std::move(rhs.cache_);
+    }
+
+    return *this;
+}
+
+BuiltinKeywords::~BuiltinKeywords()
+{
+    this->releaseCache();
+}
+
+const ParserKeyword* BuiltinKeywords::find(std::string_view deckName) const
+{
+    if (this->table_ == nullptr) {
+        return nullptr;
+    }
+
+    const auto* entry = this->table_->find(deckName);
+    if (entry == nullptr) {
+        return nullptr;
+    }
+
+    auto& cached = this->cache_[entry->keyword];
+    if (const auto* kw = cached.load(std::memory_order_acquire); kw != nullptr) {
+        return kw;
+    }
+
+    auto fresh = std::make_unique<const ParserKeyword>(this->table_->factories[entry->keyword]());
+
+    const ParserKeyword* expected = nullptr;
+    if (cached.compare_exchange_strong(expected, fresh.get(),
+                                       std::memory_order_acq_rel,
+                                       std::memory_order_acquire))
+    {
+        return fresh.release();
+    }
+
+    // Another thread published the keyword first.
+    return expected;
+}
+
+std::size_t BuiltinKeywords::size() const
+{
+    if (this->table_ == nullptr) {
+        return 0;
+    }
+
+    return std::count_if(this->table_->entries,
+                         this->table_->entries + this->table_->numEntries,
+                         [](const BuiltinKeywordTable::Entry& entry)
+                         { return ! entry.deckName.empty(); });
+}
+
+std::vector<std::string_view> BuiltinKeywords::deckNames() const
+{
+    auto names = std::vector<std::string_view>{};
+    if (this->table_ == nullptr) {
+        return names;
+    }
+
+    for (auto i = 0*this->table_->numEntries; i < this->table_->numEntries; ++i) {
+        if (! this->table_->entries[i].deckName.empty()) {
+            names.push_back(this->table_->entries[i].deckName);
+        }
+    }
+
+    return names;
+}
+
+void BuiltinKeywords::allocateCache()
+{
+    if ((this->table_ == nullptr) || (this->table_->numKeywords == 0)) {
+        return;
+    }
+
+    this->cache_ = std::make_unique<std::atomic<const ParserKeyword*>[]>(this->table_->numKeywords);
+    for (auto i = 0*this->table_->numKeywords; i < this->table_->numKeywords; ++i) {
+        this->cache_[i].store(nullptr, std::memory_order_relaxed);
+    }
+}
+
+void BuiltinKeywords::releaseCache()
+{
+    if ((this->table_ == nullptr) || (this->cache_ == nullptr)) {
+        return;
+    }
+
+    for (auto i = 0*this->table_->numKeywords; i < this->table_->numKeywords; ++i) {
+        delete this->cache_[i].load(std::memory_order_relaxed);
+    }
+
+    this->cache_.reset();
+}
+
+} // namespace Opm::ParserKeywords
@@ -0,0 +1,171 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef OPM_BUILTIN_KEYWORD_TABLE_HPP
+#define OPM_BUILTIN_KEYWORD_TABLE_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace Opm {
+    class ParserKeyword;
+}
+
+namespace Opm::ParserKeywords {
+
+/// Seeded hash function of deck keyword names.
+///
+/// FNV-1a with the seed mixed into the offset basis, followed by a
+/// finalisation step to spread the seed's influence over all bits.
+constexpr std::uint32_t keywordNameHash(std::string_view name, std::uint32_t seed)
+{
+    std::uint32_t h = 2166136261u ^ (seed * 0x9e3779b9u);
+    for (const char c : name) {
+        h ^= static_cast<unsigned char>(c);
+        h *= 16777619u;
+    }
+
+    h ^= h >> 16;
+    h *= 0x85ebca6bu;
+    h ^= h >> 13;
+    h *= 0xc2b2ae35u;
+    h ^= h >> 16;
+
+    return h;
+}
+
+/// Compile-time table of the builtin keywords, keyed by deck name.
+///
+/// The table is a "hash and displace" perfect hash: a name is first
+/// mapped to a bucket, and the bucket's seed then maps the name to a
+/// slot which no other name occupies.  A lookup therefore costs two hash
+/// evaluations and a single string comparison.  The table is emitted by
+/// the keyword generator; ParserKeyword objects are not constructed until
+/// requested.
+struct BuiltinKeywordTable
+{
+    /// Function creating a builtin ParserKeyword.
+    using Factory = ParserKeyword (*)();
+
+    /// Hash table slot.  Free slots have an empty deck name.
+    struct Entry
+    {
+        std::string_view deckName{};
+
+        /// Index into factories.
+        std::uint32_t keyword{0};
+    };
+
+    const Entry* entries{nullptr};
+    std::size_t numEntries{0};
+
+    const std::uint32_t* seeds{nullptr};
+    std::size_t numBuckets{0};
+
+    const Factory* factories{nullptr};
+    std::size_t numKeywords{0};
+
+    /// Slot holding deck name \p name.  Nullptr if \p name is not a
+    /// builtin deck name.
+    constexpr const Entry* find(std::string_view name) const
+    {
+        if ((this->numEntries == 0) || (this->numBuckets == 0)) {
+            return nullptr;
+        }
+
+        const auto bucket = keywordNameHash(name, 0) % this->numBuckets;
+        const auto slot = keywordNameHash(name, this->seeds[bucket]) % this->numEntries;
+
+        const auto* entry = this->entries + slot;
+        return (!entry->deckName.empty() && (entry->deckName == name))
+            ? entry : nullptr;
+    }
+};
+
+/// Slot assignment of a perfect hash.
+struct PerfectHashLayout
+{
+    /// Seed of each bucket.
+    std::vector<std::uint32_t> seeds{};
+
+    /// Index of name in each slot.  Free slots hold npos.
+    std::vector<std::size_t> slots{};
+
+    static constexpr auto npos = static_cast<std::size_t>(-1);
+};
+
+/// Compute perfect hash slot assignment for a set of distinct names.
+/// Used by the keyword generator to lay out a BuiltinKeywordTable.
+PerfectHashLayout buildPerfectHash(const std::vector<std::string>& names);
+
+/// Builtin keyword table of this library.  Defined in generated code.
+const BuiltinKeywordTable& builtinKeywordTable();
+
+/// Lazily constructed ParserKeyword objects of a BuiltinKeywordTable.
+///
+/// Each keyword is constructed on first lookup and then cached.  Lookups
+/// may run concurrently; keywords are published atomically and a thread
+/// which loses the race to publish discards its own copy.
+class BuiltinKeywords
+{
+public:
+    BuiltinKeywords() = default;
+    explicit BuiltinKeywords(const BuiltinKeywordTable& table);
+
+    // Copies share the table but not the cached keywords.
+    BuiltinKeywords(const BuiltinKeywords& rhs);
+    BuiltinKeywords(BuiltinKeywords&& rhs) noexcept;
+    BuiltinKeywords& operator=(const BuiltinKeywords& rhs);
+    BuiltinKeywords& operator=(BuiltinKeywords&& rhs) noexcept;
+    ~BuiltinKeywords();
+
+    /// Whether or not \p deckName is a builtin deck name.  Does not
+    /// construct the keyword.
+    bool contains(std::string_view deckName) const
+    {
+        return (this->table_ != nullptr)
+            && (this->table_->find(deckName) != nullptr);
+    }
+
+    /// Builtin keyword for deck name \p deckName.  Nullptr if \p
+    /// deckName is not a builtin deck name.
+    const ParserKeyword* find(std::string_view deckName) const;
+
+    /// Number of builtin deck names.
+    std::size_t size() const;
+
+    /// All builtin deck names, in table order.
+    std::vector<std::string_view> deckNames() const;
+
+private:
+    const BuiltinKeywordTable* table_{nullptr};
+    std::unique_ptr<std::atomic<const ParserKeyword*>[]> cache_{};
+
+    void allocateCache();
+    void releaseCache();
+};
+
+} // namespace Opm::ParserKeywords
+
+#endif // OPM_BUILTIN_KEYWORD_TABLE_HPP
@@ -1489,7 +1489,10 @@ bool parseState( ParserState& parserState, const Parser& parser ) {
     Parser::Parser(bool addDefault) {
         // The addDefaultKeywords() method is implemented in a source file
         // ${PROJECT_BINARY_DIR}/ParserInit.cpp which is generated by the build
-        // system.
+        // system.  It registers the builtin keyword table, from which
+        // keywords are constructed on first lookup, and eagerly adds those
+        // few keywords which take part in every parse--i.e., keywords
+        // matching a regular expression and code keywords.
 
         if (addDefault)
             this->addDefaultKeywords();
@@ -1635,7 +1638,12 @@ bool parseState( ParserState& parserState, const Parser& parser ) {
     }
 
     size_t Parser::size() const {
-        return m_deckParserKeywords.size();
+        const auto numAdded =
+            std::count_if(m_deckParserKeywords.begin(), m_deckParserKeywords.end(),
+                          [this](const auto& deck_name)
+                          { return ! this->m_builtinKeywords.contains(deck_name.first); });
+
+        return m_builtinKeywords.size() + numAdded;
     }
 
     const ParserKeyword* Parser::matchingKeyword(const std::string_view& name) const
@@ -1660,13 +1668,15 @@ bool parseState( ParserState& parserState, const Parser& parser ) {
         }
 
         return (this->m_deckParserKeywords.find(name) != this->m_deckParserKeywords.end())
+            || this->m_builtinKeywords.contains(name)
             || (this->matchingKeyword(name) != nullptr);
     }
 
     bool Parser::isBaseRecognizedKeyword(std::string_view name) const
     {
         return ParserKeyword::validDeckName(name)
-            && (this->m_deckParserKeywords.find(name) != this->m_deckParserKeywords.end());
+            && ((this->m_deckParserKeywords.find(name) != this->m_deckParserKeywords.end())
+                || this->m_builtinKeywords.contains(name));
     }
 
 void Parser::addParserKeyword( ParserKeyword parserKeyword ) {
@@ -1709,8 +1719,9 @@ void Parser::addParserKeyword(const Json::JsonObject& jsonKeyword) {
 }
 
 bool Parser::hasKeyword( const std::string& name ) const {
-    return this->m_deckParserKeywords.find( std::string_view( name ) )
-        != this->m_deckParserKeywords.end();
+    return (this->m_deckParserKeywords.find( std::string_view( name ) )
+            != this->m_deckParserKeywords.end())
+        || this->m_builtinKeywords.contains( name );
 }
 
 const ParserKeyword& Parser::getKeyword( const std::string& name ) const {
@@ -1722,6 +1733,9 @@ const ParserKeyword& Parser::getParserKeywordFromDeckName(const std::string_view
 
     if( candidate != m_deckParserKeywords.end() ) return *candidate->second;
 
+    if (const auto* builtin = m_builtinKeywords.find( name ); builtin != nullptr)
+        return *builtin;
+
     const auto* wildCardKeyword = matchingKeyword( name );
 
     if ( !wildCardKeyword )
@@ -1735,6 +1749,10 @@ std::vector<std::string> Parser::getAllDeckNames () const {
     for (auto iterator = m_deckParserKeywords.begin(); iterator != m_deckParserKeywords.end(); iterator++) {
         keywords.push_back(std::string(iterator->first));
     }
+    for (const auto& deck_name : m_builtinKeywords.deckNames()) {
+        if (m_deckParserKeywords.find(deck_name) == m_deckParserKeywords.end())
+            keywords.push_back(std::string(deck_name));
+    }
     for (auto iterator = m_wildCardKeywords.begin(); iterator != m_wildCardKeywords.end(); iterator++) {
         keywords.push_back(std::string(iterator->first));
     }
@@ -31,6 +31,7 @@
 
 #include <stddef.h>
 
+#include <opm/input/eclipse/Parser/BuiltinKeywordTable.hpp>
 #include <opm/input/eclipse/Parser/ParserKeyword.hpp>
 
 namespace Json {
@@ -176,9 +177,14 @@ namespace Opm {
         // std::vector< std::unique_ptr< const ParserKeyword > > keyword_storage;
         std::list<ParserKeyword> keyword_storage;
 
-        // associative map of deck names and the corresponding ParserKeyword object
+        // associative map of deck names and the corresponding ParserKeyword
+        // object for explicitly added keywords.  Takes precedence over the
+        // builtin keywords.
         std::map< std::string_view, const ParserKeyword* > m_deckParserKeywords;
 
+        // builtin keywords, constructed on first lookup
+        ParserKeywords::BuiltinKeywords m_builtinKeywords;
+
         // associative map of the parser internal names and the corresponding
         // ParserKeyword object for keywords which match a regular expression
         std::map< std::string_view, const ParserKeyword* > m_wildCardKeywords;
@@ -226,6 +226,19 @@ namespace {
         return connection_factor;
     }
 
+    // Pack logical Cartesian cell coordinates into a single lookup key.
+    // Each coordinate gets 21 bits which is ample for any realistic
+    // grid dimension.
+    std::size_t ijkKey(const int i, const int j, const int k)
+    {
+        constexpr auto nbits = 21;
+        constexpr auto mask = (std::size_t{1} << nbits) - 1;
+
+        return ((static_cast<std::size_t>(i) & mask) << (2 * nbits))
+            |  ((static_cast<std::size_t>(j) & mask) << (1 * nbits))
+            |  ((static_cast<std::size_t>(k) & mask) << (0 * nbits));
+    }
+
 } // anonymous namespace
 
 namespace Opm {
@@ -246,7 +259,9 @@ namespace Opm {
         , headI        (headIArg)
         , headJ        (headJArg)
         , m_connections(connections)
-    {}
+    {
+        this->rebuildIndex();
+    }
 
     WellConnections WellConnections::serializationTestObject()
     {
@@ -255,6 +270,7 @@ namespace Opm {
         result.headI = 1;
         result.headJ = 2;
         result.m_connections = {Connection::serializationTestObject()};
+        result.rebuildIndex();
 
         return result;
     }
@@ -331,6 +347,8 @@ namespace Opm {
         this->m_connections.emplace_back(conn_i, conn_j, k, global_index, complnum,
                                          state, direction, ctf_kind, satTableId,
                                          depth, ctf_props, seqIndex, defaultSatTabId);
+
+        this->indexConnection(this->m_connections.size() - 1);
     }
 
     void WellConnections::addConnection(const int i, const int j, const int k,
@@ -512,14 +530,9 @@ The cell ({},{},{}) in well {} is not active and the connection will be ignored)
             ctf_props.static_dfac_corr_coeff =
                 staticForchheimerCoefficient(ctf_props, props->poro, wdfac);
 
-            auto prev = std::find_if(this->m_connections.begin(),
-                                     this->m_connections.end(),
-                                     [I, J, k](const Connection& c)
-                                     {
-                                         return c.sameCoordinate(I, J, k);
-                                     });
+            const auto prevPos = this->findIJK(I, J, k);
 
-            if (prev == this->m_connections.end()) {
+            if (! prevPos.has_value()) {
                 const std::size_t noConn = this->m_connections.size();
                 this->addConnection(I, J, k, cell.global_index, state,
                                     cell.depth, ctf_props, satTableId,
@@ -527,6 +540,8 @@ The cell ({},{},{}) in well {} is not active and the connection will be ignored)
                                     noConn, defaultSatTable);
             }
             else {
+                auto* prev = &this->m_connections[*prevPos];
+
                 const auto compl_num = prev->complnum();
                 const auto css_ind = prev->sort_value();
                 const auto conSegNo = prev->segment();
@@ -728,12 +743,9 @@ CF and Kh items for well {} must both be specified or both defaulted/negative)",
                 ctf_props.Ke = std::sqrt(K[0] * K[1]);
             }
 
-            auto prev = std::find_if(this->m_connections.begin(),
-                                     this->m_connections.end(),
-                                     [&ijk](const Connection& c)
-                                     { return c.sameCoordinate(ijk[0], ijk[1], ijk[2]); });
+            const auto prevPos = this->findIJK(ijk[0], ijk[1], ijk[2]);
 
-            if (prev == this->m_connections.end()) {
+            if (! prevPos.has_value()) {
                 const std::size_t noConn = this->m_connections.size();
                 this->addConnection(ijk[0], ijk[1], ijk[2],
                                     cell.global_index, state,
@@ -742,6 +754,8 @@ CF and Kh items for well {} must both be specified or both defaulted/negative)",
                                     noConn, defaultSatTable);
             }
             else {
+                auto* prev = &this->m_connections[*prevPos];
+
                 const auto compl_num = prev->complnum();
                 const auto css_ind = prev->sort_value();
                 const auto conSegNo = prev->segment();
@@ -838,62 +852,48 @@ CF and Kh items for well {} must both be specified or both defaulted/negative)",
 
     bool WellConnections::hasGlobalIndex(std::size_t global_index) const
     {
-        return std::any_of(this->begin(), this->end(),
-                           [global_index](const Connection& conn)
-                           {
-                               return conn.global_index() == global_index;
-                           });
+        return this->findGlobalIndex(global_index).has_value();
     }
 
     const Connection&
     WellConnections::getFromIJK(const int i, const int j, const int k) const
     {
-        for (size_t ic = 0; ic < size(); ++ic) {
-            if (get(ic).sameCoordinate(i, j, k)) {
-                return get(ic);
-            }
+        const auto pos = this->findIJK(i, j, k);
+        if (! pos.has_value()) {
+            throw std::runtime_error(" the connection is not found! \n ");
         }
 
-        throw std::runtime_error(" the connection is not found! \n ");
+        return this->m_connections[*pos];
     }
 
     const Connection& WellConnections::getFromGlobalIndex(std::size_t global_index) const
     {
-        auto conn_iter =
-            std::find_if(this->begin(), this->end(),
-                         [global_index] (const Connection& conn)
-                         { return conn.global_index() == global_index; });
-
-        if (conn_iter == this->end()) {
+        const auto pos = this->findGlobalIndex(global_index);
+        if (! pos.has_value()) {
             throw std::logic_error(fmt::format("No connection with global index {}", global_index));
         }
 
-        return *conn_iter;
+        return this->m_connections[*pos];
     }
 
     Connection& WellConnections::getFromIJK(const int i, const int j, const int k)
     {
-        for (size_t ic = 0; ic < size(); ++ic) {
-            if (get(ic).sameCoordinate(i, j, k)) {
-                return this->m_connections[ic];
-            }
+        const auto pos = this->findIJK(i, j, k);
+        if (! pos.has_value()) {
+            throw std::runtime_error(" the connection is not found! \n ");
         }
 
-        throw std::runtime_error(" the connection is not found! \n ");
+        return this->m_connections[*pos];
     }
 
     Connection* WellConnections::maybeGetFromGlobalIndex(const std::size_t global_index)
     {
-        auto conn_iter =
-            std::find_if(this->begin(), this->end(),
-                         [global_index] (const Connection& conn)
-                         { return conn.global_index() == global_index; });
-
-        if (conn_iter == this->end()) {
+        const auto pos = this->findGlobalIndex(global_index);
+        if (! pos.has_value()) {
             return nullptr;
         }
 
-        return &*conn_iter;
+        return &this->m_connections[*pos];
     }
 
     bool WellConnections::allConnectionsShut() const
@@ -932,6 +932,8 @@ CF and Kh items for well {} must both be specified or both defaulted/negative)",
                   {
                       return conn1.sort_value() < conn2.sort_value();
                   });
+
+        this->rebuildIndex();
     }
 
     void WellConnections::orderTRACK()
@@ -957,6 +959,8 @@ CF and Kh items for well {} must both be specified or both defaulted/negative)",
             size_t next_index = findClosestConnection(prev.getI(), prev.getJ(), prevz, pos);
             std::swap(m_connections[next_index], m_connections[pos]);
         }
+
+        this->rebuildIndex();
     }
 
     size_t WellConnections::findClosestConnection(int oi, int oj, double oz, size_t start_pos)
@@ -995,6 +999,8 @@ CF and Kh items for well {} must both be specified or both defaulted/negative)",
                   {
                       return conn1.depth() < conn2.depth();
                   });
+
+        this->rebuildIndex();
     }
 
     bool WellConnections::operator==(const WellConnections& rhs) const
@@ -1019,6 +1025,8 @@ CF and Kh items for well {} must both be specified or both defaulted/negative)",
 
         auto new_end = std::remove_if(m_connections.begin(), m_connections.end(), isInactive);
         m_connections.erase(new_end, m_connections.end());
+
+        this->rebuildIndex();
     }
 
     double WellConnections::segment_perf_length(int segment) const
@@ -1049,21 +1057,62 @@ CF and Kh items for well {} must both be specified or both defaulted/negative)",
         return this->md;
     }
 
+    void WellConnections::indexConnection(const std::size_t pos)
+    {
+        const auto& conn = this->m_connections[pos];
+
+        // Keep the first connection in each cell, matching the semantics
+        // of a linear search from the beginning of the connection set.
+        this->m_global_index_pos.try_emplace(conn.global_index(), pos);
+        this->m_ijk_pos.try_emplace(ijkKey(conn.getI(), conn.getJ(), conn.getK()), pos);
+    }
+
+    void WellConnections::rebuildIndex()
+    {
+        this->m_global_index_pos.clear();
+        this->m_ijk_pos.clear();
+
+        this->m_global_index_pos.reserve(this->m_connections.size());
+        this->m_ijk_pos.reserve(this->m_connections.size());
+
+        for (auto pos = std::size_t{0}; pos < this->m_connections.size(); ++pos) {
+            this->indexConnection(pos);
+        }
+    }
+
+    std::optional<std::size_t>
+    WellConnections::findIJK(const int i, const int j, const int k) const
+    {
+        auto posPos = this->m_ijk_pos.find(ijkKey(i, j, k));
+        if ((posPos == this->m_ijk_pos.end()) ||
+            ! this->m_connections[posPos->second].sameCoordinate(i, j, k))
+        {
+            return {};
+        }
+
+        return posPos->second;
+    }
+
+    std::optional<std::size_t>
+    WellConnections::findGlobalIndex(const std::size_t global_index) const
+    {
+        auto posPos = this->m_global_index_pos.find(global_index);
+        if (posPos == this->m_global_index_pos.end()) {
+            return {};
+        }
+
+        return posPos->second;
+    }
+
     std::optional<int>
     getCompletionNumberFromGlobalConnectionIndex(const WellConnections& connections,
                                                  const std::size_t      global_index)
     {
-        auto connPos = std::find_if(connections.begin(), connections.end(),
-            [global_index](const Connection& conn)
-        {
-            return conn.global_index() == global_index;
-        });
-
-        if (connPos == connections.end()) {
+        if (! connections.hasGlobalIndex(global_index)) {
             // No connection exists with the requisite 'global_index'
             return {};
         }
 
-        return { connPos->complnum() };
+        return { connections.getFromGlobalIndex(global_index).complnum() };
     }
 }
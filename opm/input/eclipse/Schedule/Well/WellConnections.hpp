@@ -27,6 +27,7 @@
 #include <cstddef>
 #include <optional>
 #include <string>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -73,6 +74,7 @@ namespace Opm {
         void add(const Connection& conn)
         {
             this->m_connections.push_back(conn);
+            this->indexConnection(this->m_connections.size() - 1);
         }
 
         void addConnection(const int i, const int j, const int k,
@@ -124,6 +126,9 @@ namespace Opm {
 
         const_iterator begin() const { return this->m_connections.begin(); }
         const_iterator end() const { return this->m_connections.end(); }
+
+        // Mutable iteration must not change the cell (IJK/global index)
+        // of any connection, since that would invalidate the lookup index.
         auto begin() { return this->m_connections.begin(); }
         auto end() { return this->m_connections.end(); }
         void filter(const ActiveGridCells& grid);
@@ -177,6 +182,12 @@ namespace Opm {
             serializer(this->m_connections);
             serializer(this->coord);
             serializer(this->md);
+
+            // The lookup index is derived data, so rebuild it rather than
+            // transferring it.
+            if (!serializer.isSerializing()) {
+                this->rebuildIndex();
+            }
         }
 
     private:
@@ -188,6 +199,20 @@ namespace Opm {
         std::array<std::vector<double>, 3> coord{};
         std::vector<double> md{};
 
+        /// Position in m_connections of the first connection in each
+        /// global cell.  Derived from m_connections.
+        std::unordered_map<std::size_t, std::size_t> m_global_index_pos{};
+
+        /// Position in m_connections of the first connection in each
+        /// (I,J,K) cell, keyed by packed cell coordinates.  Derived from
+        /// m_connections.
+        std::unordered_map<std::size_t, std::size_t> m_ijk_pos{};
+
+        void indexConnection(const std::size_t pos);
+        void rebuildIndex();
+        std::optional<std::size_t> findIJK(const int i, const int j, const int k) const;
+        std::optional<std::size_t> findGlobalIndex(const std::size_t global_index) const;
+
         void addConnection(const int i, const int j, const int k,
                            const std::size_t global_index,
                            const int complnum,
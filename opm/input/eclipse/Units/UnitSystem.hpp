@@ -20,6 +20,8 @@
 #ifndef UNITSYSTEM_H
 #define UNITSYSTEM_H
 
+#include <opm/common/utility/RelaxedCounter.hpp>
+
 #include <opm/input/eclipse/Units/Dimension.hpp>
 
 #include <opm/input/eclipse/Schedule/UDQ/UDQEnums.hpp>
@@ -176,7 +178,7 @@ namespace Opm {
 
 
         */
-        mutable std::size_t m_use_count = 0;
+        mutable RelaxedCounter m_use_count{};
     };
 
 } // namespace Opm
@@ -202,7 +202,9 @@ void EclFile::loadData()
         }
 
         for (std::size_t i = 0; i < array_name.size(); i++) {
-            loadBinaryArray(fileH, i);
+            if (!arrayLoaded[i]) {
+                loadBinaryArray(fileH, i);
+            }
         }
 
         fileH.close();
@@ -219,7 +221,7 @@ void EclFile::loadData(const std::string& name)
 
         for (unsigned int arrIndex = 0; arrIndex < array_name.size(); arrIndex++) {
 
-            if (array_name[arrIndex] == name) {
+            if ((array_name[arrIndex] == name) && !arrayLoaded[arrIndex]) {
 
                 inFile.seekg(ifStreamPos[arrIndex]);
 
@@ -246,7 +248,7 @@ void EclFile::loadData(const std::string& name)
         }
 
         for (size_t i = 0; i < array_name.size(); i++) {
-            if (array_name[i] == name) {
+            if ((array_name[i] == name) && !arrayLoaded[i]) {
                 loadBinaryArray(fileH, i);
             }
         }
@@ -264,6 +266,9 @@ void EclFile::loadData(const std::vector<int>& arrIndex)
         std::ifstream inFile(inputFilename);
 
         for (int ind : arrIndex) {
+            if (arrayLoaded[ind]) {
+                continue;
+            }
 
             inFile.seekg(ifStreamPos[ind]);
 
@@ -288,7 +293,9 @@ void EclFile::loadData(const std::vector<int>& arrIndex)
         }
 
         for (int ind : arrIndex) {
-            loadBinaryArray(fileH, ind);
+            if (!arrayLoaded[ind]) {
+                loadBinaryArray(fileH, ind);
+            }
         }
 
         fileH.close();
@@ -298,6 +305,12 @@ void EclFile::loadData(const std::vector<int>& arrIndex)
 
 void EclFile::loadData(int arrIndex)
 {
+    // Arrays are immutable once loaded.  Callers may hold references to,
+    // or views of, the existing data.
+    if (arrayLoaded[arrIndex]) {
+        return;
+    }
+
     if (formatted) {
 
         std::ifstream inFile(inputFilename);
@@ -0,0 +1,295 @@
+// -*- mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-
+// vi: set et ts=4 sw=4 sts=4:
+/*
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 2 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+
+  Consult the COPYING file in the top-level source directory of this
+  module for the precise wording of the license and the list of
+  copyright holders.
+*/
+/*!
+ * \file
+ * \copydoc Opm::BinaryCoeff::Brine_CO2SolubilityTable
+ */
+#ifndef OPM_BINARY_COEFF_BRINE_CO2_SOLUBILITY_TABLE_HPP
+#define OPM_BINARY_COEFF_BRINE_CO2_SOLUBILITY_TABLE_HPP
+
+#include <opm/material/common/MathToolbox.hpp>
+#include <opm/material/common/TableCellMask.hpp>
+#include <opm/material/common/UniformTabulated2DFunction.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <tuple>
+#include <vector>
+
+namespace Opm {
+namespace BinaryCoeff {
+
+/*!
+ * \ingroup Binarycoefficients
+ * \brief Tabulated mutual solubilities of brine and CO2.
+ *
+ * The mole fraction of CO2 in brine and the mole fraction of H2O in the
+ * gas phase, as given by Brine_CO2::calculateMoleFractions() with both
+ * phases present, are sampled on a uniform (temperature, pressure) grid
+ * for each of a set of uniformly spaced salinities.  Evaluation is
+ * tri-linear, which keeps the interpolant between neighbouring samples
+ * and thus preserves the monotonicity of the solubility model, and
+ * provides derivatives through the evaluation type.
+ *
+ * The interpolant is compared to the solubility model at the centre of
+ * each cell of the table.  Cells where the relative deviation exceeds a
+ * tolerance, e.g. those crossed by the saturation curve of CO2, are not
+ * covered by the table and left to the solubility model.
+ */
+template <class Scalar>
+class Brine_CO2SolubilityTable
+{
+    using TabulatedFunction = UniformTabulated2DFunction<Scalar>;
+
+public:
+    /*!
+     * \brief Extent and resolution of the table.
+     *
+     * If numSalinities is zero, the salinity axis is chosen by the user
+     * of the table, typically from the salinities of the PVT regions.
+     */
+    struct Range
+    {
+        Scalar temperatureMin = 283.15; // K
+        Scalar temperatureMax = 423.15; // K
+        unsigned numTemperatures = 71;
+        Scalar pressureMin = 10.0e5; // Pa
+        Scalar pressureMax = 500.0e5; // Pa
+        unsigned numPressures = 491;
+        Scalar salinityMin = 0.0; // kg NaCl / kg solution
+        Scalar salinityMax = 0.0; // kg NaCl / kg solution
+        unsigned numSalinities = 0;
+        Scalar tolerance = 1.0e-3; // relative, at the cell centres
+    };
+
+    /*!
+     * \brief Sample the solubility model over the given range.
+     *
+     * A single salinity sample yields a table which only applies at
+     * exactly that salinity.
+     */
+    template <class BinaryCoeffBrineCO2, class CO2Params>
+    void init(const CO2Params& params, const int activityModel, const Range& range)
+    {
+        const unsigned numSalinities = std::max(range.numSalinities, 1u);
+        salinityMin_ = range.salinityMin;
+        salinityMax_ = (numSalinities > 1) ? range.salinityMax : range.salinityMin;
+
+        xlCO2_.assign(numSalinities, TabulatedFunction(range.temperatureMin, range.temperatureMax,
+                                                       range.numTemperatures,
+                                                       range.pressureMin, range.pressureMax,
+                                                       range.numPressures));
+        ygH2O_ = xlCO2_;
+
+        for (unsigned k = 0; k < numSalinities; ++k) {
+            const Scalar salinity = salinityMin_ + k*salinityStep_(numSalinities);
+            for (unsigned i = 0; i < range.numTemperatures; ++i) {
+                for (unsigned j = 0; j < range.numPressures; ++j) {
+                    Scalar xlCO2;
+                    Scalar ygH2O;
+                    moleFractions_<BinaryCoeffBrineCO2>(params, activityModel,
+                                                        xlCO2_[k].iToX(i), xlCO2_[k].jToY(j), salinity,
+                                                        xlCO2, ygH2O);
+                    xlCO2_[k].setSamplePoint(i, j, xlCO2);
+                    ygH2O_[k].setSamplePoint(i, j, ygH2O);
+                }
+            }
+        }
+
+        // Check the interpolation at the centre of each cell, taking the
+        // worst of all salinity intervals.
+        accurateCells_.init(xlCO2_.front(), [&](unsigned, unsigned,
+                                                const Scalar temperature, const Scalar pressure)
+        {
+            for (unsigned k = 0; k < std::max(numSalinities - 1, 1u); ++k) {
+                const Scalar salinity = salinityMin_ + (k + 0.5)*salinityStep_(numSalinities);
+
+                Scalar xlCO2;
+                Scalar ygH2O;
+                moleFractions_<BinaryCoeffBrineCO2>(params, activityModel,
+                                                    temperature, pressure, salinity,
+                                                    xlCO2, ygH2O);
+
+                const auto deviates = [&range](const Scalar interpolated, const Scalar exact)
+                { return std::abs(interpolated - exact) > range.tolerance*std::abs(exact); };
+
+                if (deviates(eval_(xlCO2_, temperature, pressure, salinity), xlCO2) ||
+                    deviates(eval_(ygH2O_, temperature, pressure, salinity), ygH2O))
+                {
+                    return false;
+                }
+            }
+            return true;
+        });
+    }
+
+    /*!
+     * \brief Table sampled over the given range, shared by all callers
+     *        asking for the same activity model and range.
+     *
+     * Building the table dominates the set-up of the PVT objects using it,
+     * and it is identical for e.g. the brine and gas PVT, as the CO2 tables
+     * are fixed.  It is therefore built on first request and kept for as
+     * long as any caller holds it.
+     */
+    template <class BinaryCoeffBrineCO2, class CO2Params>
+    static std::shared_ptr<const Brine_CO2SolubilityTable>
+    shared(const CO2Params& params, const int activityModel, const Range& range)
+    {
+        using Key = std::tuple<int,
+                               Scalar, Scalar, unsigned,
+                               Scalar, Scalar, unsigned,
+                               Scalar, Scalar, unsigned,
+                               Scalar>;
+
+        static std::mutex mutex;
+        static std::map<Key, std::weak_ptr<const Brine_CO2SolubilityTable>> tables;
+
+        const Key key { activityModel,
+                        range.temperatureMin, range.temperatureMax, range.numTemperatures,
+                        range.pressureMin, range.pressureMax, range.numPressures,
+                        range.salinityMin, range.salinityMax, range.numSalinities,
+                        range.tolerance };
+
+        std::lock_guard<std::mutex> lock(mutex);
+        auto& entry = tables[key];
+        if (auto table = entry.lock()) {
+            return table;
+        }
+
+        auto table = std::make_shared<Brine_CO2SolubilityTable>();
+        table->template init<BinaryCoeffBrineCO2>(params, activityModel, range);
+        entry = table;
+
+        return table;
+    }
+
+    /*!
+     * \brief Remove all samples; the table then applies nowhere.
+     */
+    void clear()
+    {
+        xlCO2_.clear();
+        ygH2O_.clear();
+        accurateCells_.clear();
+    }
+
+    bool empty() const
+    { return xlCO2_.empty(); }
+
+    /*!
+     * \brief Returns true iff the state lies within the tabulated range and
+     *        the table is accurate there.
+     */
+    template <class Evaluation>
+    bool applies(const Evaluation& temperature,
+                 const Evaluation& pressure,
+                 const Evaluation& salinity) const
+    {
+        if (empty()) {
+            return false;
+        }
+
+        const Scalar s = scalarValue(salinity);
+        if (xlCO2_.size() == 1 ? s != salinityMin_ : (s < salinityMin_ || s > salinityMax_)) {
+            return false;
+        }
+
+        return accurateCells_.applies(xlCO2_.front(), temperature, pressure);
+    }
+
+    /*!
+     * \brief Mole fraction of CO2 in brine [mol/mol].
+     */
+    template <class Evaluation>
+    Evaluation liquidMoleFractionCO2(const Evaluation& temperature,
+                                     const Evaluation& pressure,
+                                     const Evaluation& salinity) const
+    { return eval_(xlCO2_, temperature, pressure, salinity); }
+
+    /*!
+     * \brief Mole fraction of H2O in the gas phase [mol/mol].
+     */
+    template <class Evaluation>
+    Evaluation gasMoleFractionH2O(const Evaluation& temperature,
+                                  const Evaluation& pressure,
+                                  const Evaluation& salinity) const
+    { return eval_(ygH2O_, temperature, pressure, salinity); }
+
+private:
+    template <class BinaryCoeffBrineCO2, class CO2Params>
+    static void moleFractions_(const CO2Params& params,
+                               const int activityModel,
+                               const Scalar temperature,
+                               const Scalar pressure,
+                               const Scalar salinity,
+                               Scalar& xlCO2,
+                               Scalar& ygH2O)
+    {
+        BinaryCoeffBrineCO2::calculateMoleFractions(params,
+                                                    temperature,
+                                                    pressure,
+                                                    salinity,
+                                                    /*knownPhaseIdx=*/-1,
+                                                    xlCO2,
+                                                    ygH2O,
+                                                    activityModel,
+                                                    /*extrapolate=*/true);
+    }
+
+    Scalar salinityStep_(const unsigned numSalinities) const
+    { return (numSalinities > 1) ? (salinityMax_ - salinityMin_)/(numSalinities - 1) : Scalar{0}; }
+
+    template <class Evaluation>
+    Evaluation eval_(const std::vector<TabulatedFunction>& tables,
+                     const Evaluation& temperature,
+                     const Evaluation& pressure,
+                     const Evaluation& salinity) const
+    {
+        if (tables.size() == 1) {
+            return tables.front().eval(temperature, pressure, /*extrapolate=*/false);
+        }
+
+        const int numIntervals = static_cast<int>(tables.size()) - 1;
+        Evaluation sigma = (salinity - salinityMin_)/(salinityMax_ - salinityMin_)*numIntervals;
+        const int k = std::clamp(static_cast<int>(scalarValue(sigma)), 0, numIntervals - 1);
+        sigma -= k;
+
+        return tables[k].eval(temperature, pressure, /*extrapolate=*/false)*(1.0 - sigma)
+            + tables[k + 1].eval(temperature, pressure, /*extrapolate=*/false)*sigma;
+    }
+
+    std::vector<TabulatedFunction> xlCO2_{};
+    std::vector<TabulatedFunction> ygH2O_{};
+    TableCellMask accurateCells_{};
+    Scalar salinityMin_{};
+    Scalar salinityMax_{};
+};
+
+} // namespace BinaryCoeff
+} // namespace Opm
+
+#endif
@@ -28,11 +28,16 @@
 #define OPM_SPLINE_HPP
 
 #include <opm/common/Exceptions.hpp>
+#include <opm/common/utility/numeric/findSegments.hpp>
 
 #include <opm/material/common/TridiagonalMatrix.hpp>
 #include <opm/material/common/PolynomialUtils.hpp>
 
+#include <algorithm>
+#include <array>
+#include <cstddef>
 #include <iosfwd>
+#include <type_traits>
 #include <vector>
 
 namespace Opm
@@ -858,6 +863,51 @@ public:
         return evalDerivative3_(x, segmentIdx_(scalarValue(x)));
     }
 
+    /*!
+     * \brief Evaluate the spline at a batch of positions.
+     *
+     * This is equivalent to calling eval() for each position, but
+     * locates the segments of all positions at once: Sorted positions
+     * are located by walking along the sampling points, others by a
+     * branch free bisection.
+     *
+     * \param n The number of positions
+     * \param x The positions, any array of evaluations with operator[]
+     * \param y The array receiving the values of the spline
+     * \param extrapolate See eval()
+     */
+    template <class EvalArrayX, class EvalArrayY>
+    void evalArray(size_t n, const EvalArrayX& x, EvalArrayY&& y,
+                   bool extrapolate = false) const
+    {
+        evalArray_</*computeValue=*/true, /*computeDerivative=*/false>(n, x, y, y, extrapolate);
+    }
+
+    /*!
+     * \brief Evaluate the spline's derivative at a batch of positions.
+     *
+     * \copydetails evalArray()
+     */
+    template <class EvalArrayX, class EvalArrayY>
+    void evalDerivativeArray(size_t n, const EvalArrayX& x, EvalArrayY&& dydx,
+                             bool extrapolate = false) const
+    {
+        evalArray_</*computeValue=*/false, /*computeDerivative=*/true>(n, x, dydx, dydx, extrapolate);
+    }
+
+    /*!
+     * \brief Evaluate the spline and its derivative at a batch of
+     *        positions, locating the segments only once.
+     *
+     * \copydetails evalArray()
+     */
+    template <class EvalArrayX, class EvalArrayY, class EvalArrayDY>
+    void evalWithDerivativeArray(size_t n, const EvalArrayX& x, EvalArrayY&& y, EvalArrayDY&& dydx,
+                                 bool extrapolate = false) const
+    {
+        evalArray_</*computeValue=*/true, /*computeDerivative=*/true>(n, x, y, dydx, extrapolate);
+    }
+
     /*!
      * \brief Find the intersections of the spline with a cubic
      *        polynomial in the whole interval, throws
@@ -1460,10 +1510,15 @@ protected:
     // segment index
     template <class Evaluation>
     Evaluation eval_(const Evaluation& x, size_t i) const
+    { return evalAtT_(t_(x, i), i); }
+
+    // evaluate the spline given the position relative to the segment,
+    // t = (x - x_i)/(x_{i+1} - x_i), and the segment index
+    template <class Evaluation>
+    Evaluation evalAtT_(const Evaluation& t, size_t i) const
     {
         // See http://en.wikipedia.org/wiki/Cubic_Hermite_spline
         Scalar delta = h_(i + 1);
-        Evaluation t = (x - x_(i))/delta;
 
         return
             h00_(t) * y_(i)
@@ -1476,10 +1531,15 @@ protected:
     // and the segment index
     template <class Evaluation>
     Evaluation evalDerivative_(const Evaluation& x, size_t i) const
+    { return evalDerivativeAtT_(t_(x, i), i); }
+
+    // evaluate the derivative of a spline given the position relative
+    // to the segment and the segment index
+    template <class Evaluation>
+    Evaluation evalDerivativeAtT_(const Evaluation& t, size_t i) const
     {
         // See http://en.wikipedia.org/wiki/Cubic_Hermite_spline
         Scalar delta = h_(i + 1);
-        Evaluation t = (x - x_(i))/delta;
         Evaluation alpha = 1 / delta;
 
         return
@@ -1698,6 +1758,65 @@ protected:
         return k;
     }
 
+    // evaluate the spline and/or its derivative for a batch of
+    // positions, in chunks small enough for the segment indices to
+    // stay on the stack
+    template <bool computeValue, bool computeDerivative,
+              class EvalArrayX, class EvalArrayY, class EvalArrayDY>
+    void evalArray_(size_t n, const EvalArrayX& x, EvalArrayY& y, EvalArrayDY& dydx,
+                    bool extrapolate) const
+    {
+        using Evaluation = std::remove_cv_t<std::remove_reference_t<decltype(x[0])>>;
+
+        constexpr size_t chunkSize = 64;
+        std::array<Scalar, chunkSize> xValues;
+        std::array<size_t, chunkSize> segmentIdx;
+
+        const size_t last = numSamples() - 1;
+        const Scalar mLeft = evalDerivative_(xAt(0), /*segmentIdx=*/0);
+        const Scalar mRight = evalDerivative_(xAt(last), /*segmentIdx=*/last - 1);
+
+        for (size_t begin = 0; begin < n; begin += chunkSize) {
+            const size_t chunk = std::min(chunkSize, n - begin);
+            for (size_t k = 0; k < chunk; ++k) {
+                xValues[k] = scalarValue(x[begin + k]);
+                if (!extrapolate && !applies(xValues[k]))
+                    throw NumericalProblem("Tried to evaluate a spline outside of its range");
+            }
+
+            findSegments(xPos_.data(), numSamples(), xValues.data(), chunk, segmentIdx.data());
+
+            for (size_t k = 0; k < chunk; ++k) {
+                const Evaluation& xk = x[begin + k];
+                if (extrapolate && xValues[k] < xAt(0)) {
+                    if constexpr (computeValue)
+                        y[begin + k] = y_(0) + mLeft*(xk - xAt(0));
+                    if constexpr (computeDerivative)
+                        dydx[begin + k] = Evaluation(mLeft);
+                }
+                else if (extrapolate && xValues[k] > xAt(last)) {
+                    if constexpr (computeValue)
+                        y[begin + k] = y_(last) + mRight*(xk - xAt(last));
+                    if constexpr (computeDerivative)
+                        dydx[begin + k] = Evaluation(mRight);
+                }
+                else {
+                    const Evaluation t = t_(xk, segmentIdx[k]);
+                    if constexpr (computeValue)
+                        y[begin + k] = evalAtT_(t, segmentIdx[k]);
+                    if constexpr (computeDerivative)
+                        dydx[begin + k] = evalDerivativeAtT_(t, segmentIdx[k]);
+                }
+            }
+        }
+    }
+
+    // position relative to segment i, which is 0 at its start and 1 at
+    // its end
+    template <class Evaluation>
+    Evaluation t_(const Evaluation& x, size_t i) const
+    { return (x - x_(i))/h_(i + 1); }
+
     // find the segment index for a given x coordinate
     size_t segmentIdx_(Scalar x) const
     {
@@ -0,0 +1,119 @@
+// -*- mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-
+// vi: set et ts=4 sw=4 sts=4:
+/*
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 2 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+
+  Consult the COPYING file in the top-level source directory of this
+  module for the precise wording of the license and the list of
+  copyright holders.
+*/
+/*!
+ * \file
+ * \copydoc Opm::TableCellMask
+ */
+#ifndef OPM_TABLE_CELL_MASK_HPP
+#define OPM_TABLE_CELL_MASK_HPP
+
+#include <opm/material/common/MathToolbox.hpp>
+#include <opm/material/common/UniformTabulated2DFunction.hpp>
+
+#include <algorithm>
+#include <vector>
+
+namespace Opm {
+
+/*!
+ * \brief The cells of a UniformTabulated2DFunction where interpolation is
+ *        accurate.
+ *
+ * Tables which replace a model by interpolation check the interpolant
+ * against the model at the centre of each cell, and leave the cells where
+ * it deviates too much to the model.
+ */
+class TableCellMask
+{
+public:
+    /*!
+     * \brief Decide for each cell of the table whether it is accurate.
+     *
+     * \p accurate(i, j, x, y) is called for cell (i, j), whose centre is at
+     * (x, y).
+     */
+    template <class Scalar, class ContainerT, class Predicate>
+    void init(const UniformTabulated2DFunction<Scalar, ContainerT>& table, Predicate&& accurate)
+    {
+        numCellsX_ = table.numX() - 1;
+        numCellsY_ = table.numY() - 1;
+        accurate_.assign(numCellsX_*numCellsY_, false);
+        numAccurate_ = 0;
+
+        for (unsigned i = 0; i < numCellsX_; ++i) {
+            const Scalar x = 0.5*(table.iToX(i) + table.iToX(i + 1));
+            for (unsigned j = 0; j < numCellsY_; ++j) {
+                const Scalar y = 0.5*(table.jToY(j) + table.jToY(j + 1));
+                if (accurate(i, j, x, y)) {
+                    accurate_[j*numCellsX_ + i] = true;
+                    ++numAccurate_;
+                }
+            }
+        }
+    }
+
+    void clear()
+    {
+        accurate_.clear();
+        numCellsX_ = numCellsY_ = 0;
+        numAccurate_ = 0;
+    }
+
+    bool empty() const
+    { return accurate_.empty(); }
+
+    /*!
+     * \brief Fraction of the cells which are accurate.
+     */
+    double coverage() const
+    { return empty() ? 0.0 : static_cast<double>(numAccurate_) / accurate_.size(); }
+
+    /*!
+     * \brief Returns true iff (x, y) lies within the table and in an
+     *        accurate cell.
+     */
+    template <class Scalar, class ContainerT, class Evaluation>
+    bool applies(const UniformTabulated2DFunction<Scalar, ContainerT>& table,
+                 const Evaluation& x,
+                 const Evaluation& y) const
+    {
+        if (empty() || !table.applies(x, y)) {
+            return false;
+        }
+
+        const unsigned i = std::min(static_cast<unsigned>(scalarValue(table.xToI(x))), numCellsX_ - 1);
+        const unsigned j = std::min(static_cast<unsigned>(scalarValue(table.yToJ(y))), numCellsY_ - 1);
+
+        return accurate_[j*numCellsX_ + i];
+    }
+
+private:
+    std::vector<bool> accurate_{};
+    unsigned numCellsX_{0};
+    unsigned numCellsY_{0};
+    unsigned numAccurate_{0};
+};
+
+} // namespace Opm
+
+#endif
@@ -262,11 +262,24 @@ public:
      */
     template <class Evaluation>
     OPM_HOST_DEVICE static Evaluation liquidDensity(const Evaluation& temperature, const Evaluation& pressure, const Evaluation& salinity, bool extrapolate = false)
+    {
+        const Evaluation rhow = H2O::liquidDensity(temperature, pressure, extrapolate);
+        return liquidDensityFromWater(temperature, pressure, salinity, rhow);
+    }
+
+    /*!
+     * \brief The density of brine [kg/m^3] given the density of pure water
+     *        at the same temperature and pressure, e.g. from a table.
+     */
+    template <class Evaluation>
+    OPM_HOST_DEVICE static Evaluation liquidDensityFromWater(const Evaluation& temperature,
+                                                             const Evaluation& pressure,
+                                                             const Evaluation& salinity,
+                                                             const Evaluation& rhow)
     {
         Evaluation tempC = temperature - 273.15;
         Evaluation pMPa = pressure/1.0E6;
 
-        const Evaluation rhow = H2O::liquidDensity(temperature, pressure, extrapolate);
         return
             rhow +
             1000*salinity*(
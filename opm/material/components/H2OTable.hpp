@@ -0,0 +1,238 @@
+// -*- mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-
+// vi: set et ts=4 sw=4 sts=4:
+/*
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 2 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+
+  Consult the COPYING file in the top-level source directory of this
+  module for the precise wording of the license and the list of
+  copyright holders.
+*/
+/*!
+ * \file
+ * \copydoc Opm::H2OTable
+ */
+#ifndef OPM_H2O_TABLE_HPP
+#define OPM_H2O_TABLE_HPP
+
+#include <opm/material/common/TableCellMask.hpp>
+#include <opm/material/common/UniformTabulated2DFunction.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <exception>
+#include <vector>
+
+namespace Opm {
+
+/*!
+ * \ingroup Components
+ * \brief Tabulated properties of liquid water.
+ *
+ * The density, enthalpy and viscosity of liquid water as given by a
+ * water component, e.g. the IAPWS-97 based H2O or SimpleHuDuanH2O, are
+ * sampled on a uniform (temperature, pressure) grid covering the
+ * conditions of a reservoir. Evaluation is bilinear, and provides
+ * derivatives through the evaluation type.
+ *
+ * In contrast to TabulatedComponent, the tables are held by an object
+ * rather than globally, so that each user may choose whether and how
+ * to tabulate, and evaluation does not modify any state, so that one
+ * table may be used by several threads.
+ *
+ * The interpolant is compared to the component at the centre of each
+ * cell of the table. Cells where the relative deviation exceeds a
+ * tolerance, e.g. those crossed by the vapor pressure curve, or those
+ * where the component is not defined for liquid water, are not covered
+ * by the table and left to the component. The largest deviations of the
+ * covered cells are kept as an estimate of the error of the table.
+ */
+template <class Scalar>
+class H2OTable
+{
+    using TabulatedFunction = UniformTabulated2DFunction<Scalar>;
+
+public:
+    /*!
+     * \brief Extent and resolution of the table.
+     */
+    struct Range
+    {
+        Scalar temperatureMin = 278.15; // K
+        Scalar temperatureMax = 473.15; // K
+        unsigned numTemperatures = 196;
+        Scalar pressureMin = 1.0e5; // Pa
+        Scalar pressureMax = 1000.0e5; // Pa
+        unsigned numPressures = 56;
+        Scalar tolerance = 1.0e-3; // relative, at the cell centres
+    };
+
+    /*!
+     * \brief Largest relative deviations from the component of the cells
+     *        covered by the table, and the fraction of cells covered.
+     */
+    struct ErrorBounds
+    {
+        Scalar density = 0.0;
+        Scalar enthalpy = 0.0;
+        Scalar viscosity = 0.0;
+        Scalar coverage = 0.0;
+    };
+
+    /*!
+     * \brief Sample the properties of the water component over the given
+     *        range.
+     */
+    template <class RawH2O>
+    void init(const Range& range)
+    {
+        const TabulatedFunction grid(range.temperatureMin, range.temperatureMax, range.numTemperatures,
+                                     range.pressureMin, range.pressureMax, range.numPressures);
+        density_ = grid;
+        enthalpy_ = grid;
+        viscosity_ = grid;
+
+        std::vector<bool> validSample(range.numTemperatures*range.numPressures, true);
+        for (unsigned i = 0; i < range.numTemperatures; ++i) {
+            for (unsigned j = 0; j < range.numPressures; ++j) {
+                Scalar rho = 0.0;
+                Scalar h = 0.0;
+                Scalar mu = 0.0;
+                validSample[j*range.numTemperatures + i] =
+                    properties_<RawH2O>(grid.iToX(i), grid.jToY(j), rho, h, mu);
+                density_.setSamplePoint(i, j, rho);
+                enthalpy_.setSamplePoint(i, j, h);
+                viscosity_.setSamplePoint(i, j, mu);
+            }
+        }
+
+        // Check the interpolation at the centre of each cell.
+        errorBounds_ = ErrorBounds{};
+        accurateCells_.init(density_, [&](const unsigned i, const unsigned j,
+                                          const Scalar temperature, const Scalar pressure)
+        {
+            const bool validCorners =
+                validSample[j*range.numTemperatures + i] &&
+                validSample[j*range.numTemperatures + i + 1] &&
+                validSample[(j + 1)*range.numTemperatures + i] &&
+                validSample[(j + 1)*range.numTemperatures + i + 1];
+
+            Scalar rho = 0.0;
+            Scalar h = 0.0;
+            Scalar mu = 0.0;
+            if (!validCorners || !properties_<RawH2O>(temperature, pressure, rho, h, mu)) {
+                return false;
+            }
+
+            const auto deviation = [](const Scalar interpolated, const Scalar exact, const Scalar scale)
+            { return std::abs(interpolated - exact) / std::max(std::abs(exact), scale); };
+
+            // The enthalpy may be zero in the range, depending on its
+            // reference state; its deviation is taken relative to at
+            // least the enthalpy of heating water by one Kelvin.
+            const Scalar rhoDeviation = deviation(density_.eval(temperature, pressure, /*extrapolate=*/false), rho, 1e-30);
+            const Scalar hDeviation = deviation(enthalpy_.eval(temperature, pressure, /*extrapolate=*/false), h, 4.2e3);
+            const Scalar muDeviation = deviation(viscosity_.eval(temperature, pressure, /*extrapolate=*/false), mu, 1e-30);
+            if (std::max({rhoDeviation, hDeviation, muDeviation}) > range.tolerance) {
+                return false;
+            }
+
+            errorBounds_.density = std::max(errorBounds_.density, rhoDeviation);
+            errorBounds_.enthalpy = std::max(errorBounds_.enthalpy, hDeviation);
+            errorBounds_.viscosity = std::max(errorBounds_.viscosity, muDeviation);
+            return true;
+        });
+        errorBounds_.coverage = accurateCells_.coverage();
+    }
+
+    /*!
+     * \brief Remove all samples; the table then applies nowhere.
+     */
+    void clear()
+    {
+        density_ = TabulatedFunction{};
+        enthalpy_ = TabulatedFunction{};
+        viscosity_ = TabulatedFunction{};
+        accurateCells_.clear();
+        errorBounds_ = ErrorBounds{};
+    }
+
+    bool empty() const
+    { return accurateCells_.empty(); }
+
+    /*!
+     * \brief The deviations from the component found when the table was
+     *        built.
+     */
+    const ErrorBounds& errorBounds() const
+    { return errorBounds_; }
+
+    /*!
+     * \brief Returns true iff the state lies within the tabulated range and
+     *        the table is accurate there.
+     */
+    template <class Evaluation>
+    bool applies(const Evaluation& temperature, const Evaluation& pressure) const
+    { return accurateCells_.applies(density_, temperature, pressure); }
+
+    /*!
+     * \brief The density of liquid water [kg/m^3].
+     */
+    template <class Evaluation>
+    Evaluation liquidDensity(const Evaluation& temperature, const Evaluation& pressure) const
+    { return density_.eval(temperature, pressure, /*extrapolate=*/false); }
+
+    /*!
+     * \brief The specific enthalpy of liquid water [J/kg].
+     */
+    template <class Evaluation>
+    Evaluation liquidEnthalpy(const Evaluation& temperature, const Evaluation& pressure) const
+    { return enthalpy_.eval(temperature, pressure, /*extrapolate=*/false); }
+
+    /*!
+     * \brief The dynamic viscosity of liquid water [Pa s].
+     */
+    template <class Evaluation>
+    Evaluation liquidViscosity(const Evaluation& temperature, const Evaluation& pressure) const
+    { return viscosity_.eval(temperature, pressure, /*extrapolate=*/false); }
+
+private:
+    // Properties of the component at a state, or false if the component
+    // does not define them there.
+    template <class RawH2O>
+    static bool properties_(const Scalar temperature, const Scalar pressure,
+                            Scalar& rho, Scalar& h, Scalar& mu)
+    {
+        try {
+            rho = RawH2O::liquidDensity(temperature, pressure, /*extrapolate=*/false);
+            h = RawH2O::liquidEnthalpy(temperature, pressure);
+            mu = RawH2O::liquidViscosity(temperature, pressure, /*extrapolate=*/false);
+        }
+        catch (const std::exception&) {
+            return false;
+        }
+        return std::isfinite(rho) && std::isfinite(h) && std::isfinite(mu);
+    }
+
+    TabulatedFunction density_{};
+    TabulatedFunction enthalpy_{};
+    TabulatedFunction viscosity_{};
+    TableCellMask accurateCells_{};
+    ErrorBounds errorBounds_{};
+};
+
+} // namespace Opm
+
+#endif
@@ -45,11 +45,16 @@
 #include <dune/common/fmatrix.hh>
 #include <dune/common/classname.hh>
 
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <exception>
 #include <limits>
 #include <iostream>
 #include <iomanip>
 #include <stdexcept>
 #include <type_traits>
+#include <vector>
 
 #include <fmt/format.h>
 
@@ -85,38 +90,151 @@ public:
                       Scalar flash_tolerance,
                       const EOSType& eos_type,
                       int verbosity = 0)
+    {
+        auto fluid_state_scalar = scalarFluidState_(fluid_state);
+
+        const auto is_single_phase = flash_solve_scalar_(fluid_state_scalar, twoPhaseMethod, flash_tolerance, eos_type, verbosity);
+
+        assignFlashResult_(fluid_state_scalar, fluid_state, eos_type, is_single_phase);
+    } //end solve
+
+    /*!
+     * \brief Outcome of a cell's most recent stability test.
+     *
+     * Used by solveBatch() to decide whether a single-phase cell may skip
+     * the stability test.
+     */
+    struct StabilityHistory
+    {
+        Scalar pressure{0};
+        Scalar temperature{0};
+        std::array<Scalar, numComponents> z{};
+
+        /// Distance of the Michelsen tangent plane sums from the
+        /// instability limit at (pressure, temperature, z).  Zero if no
+        /// conclusive test has been performed.
+        Scalar margin{0};
+    };
+
+    /*!
+     * \brief Flash a batch of cells.
+     *
+     * Every fluid state holds the pressure, temperature and global mole
+     * fractions of its cell, and the K-values and L of the cell's previous
+     * solution as a warm start.  The results are those of solve() except
+     * that single-phase cells whose state has moved by less than
+     * shadow_factor times their stability margin since the last test
+     * ("shadow region") keep their phase state without a new test.  Pass
+     * zero to always test single-phase cells.
+     *
+     * The history is resized to the number of cells if needed and updated
+     * on return.  Cells are flashed concurrently if OpenMP is enabled.
+     */
+    template <class FluidState>
+    static void solveBatch(std::vector<FluidState>& fluid_states,
+                           std::vector<StabilityHistory>& history,
+                           const std::string& twoPhaseMethod,
+                           Scalar flash_tolerance,
+                           const EOSType& eos_type,
+                           Scalar shadow_factor = 0.1)
     {
         using ScalarFluidState = CompositionalFluidState<Scalar, FluidSystem>;
-        ScalarFluidState fluid_state_scalar;
+        using ScalarVector = Dune::FieldVector<Scalar, numComponents>;
 
-        for (unsigned compIdx = 0; compIdx < numComponents; ++compIdx) {
-            fluid_state_scalar.setKvalue(compIdx, Opm::getValue(fluid_state.K(compIdx) ) );
-            fluid_state_scalar.setMoleFraction(compIdx, Opm::getValue(fluid_state.moleFraction(compIdx) ) );
+        const auto num_cells = fluid_states.size();
+        if (history.size() != num_cells) {
+            history.resize(num_cells);
         }
 
-        fluid_state_scalar.setLvalue(Opm::getValue(fluid_state.L()));
-        // other values need to be Scalar, but I guess the fluidstate does not support it yet.
-        fluid_state_scalar.setPressure(FluidSystem::oilPhaseIdx,
-                                       Opm::getValue(fluid_state.pressure(FluidSystem::oilPhaseIdx)));
-        fluid_state_scalar.setPressure(FluidSystem::gasPhaseIdx,
-                                       Opm::getValue(fluid_state.pressure(FluidSystem::gasPhaseIdx)));
-
-        fluid_state_scalar.setTemperature(Opm::getValue(fluid_state.temperature(0)));
+        std::vector<ScalarFluidState> scalar_states(num_cells);
+        std::vector<ScalarVector> K(num_cells), z(num_cells);
+        std::vector<char> is_single_phase(num_cells, 0);
+        std::exception_ptr failure;
+
+        // Stability tests of previously single-phase cells outside their shadow region.
+        const auto num = static_cast<std::ptrdiff_t>(num_cells);
+#pragma omp parallel for schedule(dynamic, 64)
+        for (std::ptrdiff_t i = 0; i < num; ++i) {
+            try {
+                auto& fs = scalar_states[i];
+                fs = scalarFluidState_(fluid_states[i]);
+                for (unsigned compIdx = 0; compIdx < numComponents; ++compIdx) {
+                    K[i][compIdx] = fs.K(compIdx);
+                    z[i][compIdx] = fs.moleFraction(compIdx);
+                }
 
-        const auto is_single_phase = flash_solve_scalar_(fluid_state_scalar, twoPhaseMethod, flash_tolerance, eos_type, verbosity);
+                const auto L = fs.L();
+                if (L > 0 && L != 1) {
+                    continue;
+                }
 
-        // the flash solution process were performed in scalar form, after the flash calculation finishes,
-        // ensure that things in fluid_state_scalar is transformed to fluid_state
-        for (int compIdx=0; compIdx<numComponents; ++compIdx){
-                const auto x_i = fluid_state_scalar.moleFraction(oilPhaseIdx, compIdx);
-                fluid_state.setMoleFraction(oilPhaseIdx, compIdx, x_i);
-                const auto y_i = fluid_state_scalar.moleFraction(gasPhaseIdx, compIdx);
-                fluid_state.setMoleFraction(gasPhaseIdx, compIdx, y_i);
+                auto& hist = history[i];
+                bool is_stable = false;
+                if (inShadowRegion_(hist, fs, z[i], shadow_factor)) {
+                    is_stable = true;
+                    for (int compIdx = 0; compIdx < numComponents; ++compIdx) {
+                        fs.setMoleFraction(gasPhaseIdx, compIdx, z[i][compIdx]);
+                        fs.setMoleFraction(oilPhaseIdx, compIdx, z[i][compIdx]);
+                    }
+                }
+                else {
+                    Scalar margin = 0;
+                    phaseStabilityTest_(is_stable, K[i], fs, z[i], eos_type, 0, &margin);
+                    hist.pressure = fs.pressure(0);
+                    hist.temperature = fs.temperature(0);
+                    for (int compIdx = 0; compIdx < numComponents; ++compIdx) {
+                        hist.z[compIdx] = z[i][compIdx];
+                    }
+                    hist.margin = is_stable ? margin : Scalar{0};
+                }
+                is_single_phase[i] = is_stable;
+            }
+            catch (...) {
+#pragma omp critical
+                if (!failure) {
+                    failure = std::current_exception();
+                }
+            }
+        }
+        if (failure) {
+            std::rethrow_exception(failure);
         }
 
-        // we update the derivatives in fluid_state
-        updateDerivatives_(fluid_state_scalar, fluid_state, eos_type, is_single_phase);
-    } //end solve
+        // Initial L of all two-phase cells, solved together.
+        std::vector<std::size_t> two_phase_cells;
+        for (std::size_t i = 0; i < num_cells; ++i) {
+            if (!is_single_phase[i]) {
+                two_phase_cells.push_back(i);
+                history[i].margin = 0;
+            }
+        }
+        std::vector<Scalar> L(num_cells);
+        solveRachfordRiceBatch_(K, z, two_phase_cells, L);
+
+#pragma omp parallel for schedule(dynamic, 16)
+        for (std::ptrdiff_t i = 0; i < num; ++i) {
+            try {
+                auto& fs = scalar_states[i];
+                if (is_single_phase[i]) {
+                    L[i] = li_single_phase_label_(fs, z[i], 0);
+                }
+                else {
+                    flash_2ph(z[i], twoPhaseMethod, K[i], L[i], fs, flash_tolerance, eos_type, 0);
+                }
+                fs.setLvalue(L[i]);
+                assignFlashResult_(fs, fluid_states[i], eos_type, is_single_phase[i]);
+            }
+            catch (...) {
+#pragma omp critical
+                if (!failure) {
+                    failure = std::current_exception();
+                }
+            }
+        }
+        if (failure) {
+            std::rethrow_exception(failure);
+        }
+    }
 
     /*!
      * \brief Calculates the chemical equilibrium from the component
@@ -141,22 +259,12 @@ public:
     template <class Vector>
     static typename Vector::field_type solveRachfordRice_g_(const Vector& K, const Vector& z, int verbosity)
     {
-        // Find min and max K. Have to do a laborious for loop to avoid water component (where K=0)
-        // TODO: Replace loop with Dune::min_value() and Dune::max_value() when water component is properly handled
         using field_type = typename Vector::field_type;
-        constexpr field_type tol = 1e-12;
+        constexpr field_type tol = rachfordRiceTolerance_;
         constexpr int itmax = 10000;
-        field_type Kmin = K[0];
-        field_type Kmax = K[0];
-        for (int compIdx = 1; compIdx < numComponents; ++compIdx){
-            if (K[compIdx] < Kmin)
-                Kmin = K[compIdx];
-            else if (K[compIdx] >= Kmax)
-                Kmax = K[compIdx];
-        }
         // Lower and upper bound for solution
-        auto Vmin = 1 / (1 - Kmax);
-        auto Vmax = 1 / (1 - Kmin);
+        field_type Vmin, Vmax;
+        rachfordRiceBounds_(K, Vmin, Vmax);
         // Initial guess
         auto V = (Vmin + Vmax)/2;
         // Print initial guess and header
@@ -318,8 +426,8 @@ public:
         throw std::runtime_error(" Rachford-Rice bisection failed with " + std::to_string(max_it) + " iterations!");
     }
 
-    template <class Vector, class FlashFluidState>
-    static typename Vector::field_type li_single_phase_label_(const FlashFluidState& fluid_state, const Vector& z, int verbosity)
+    template <class Vector>
+    static typename Vector::field_type liPseudoCriticalTemperature_(const Vector& z)
     {
         // Calculate intermediate sum
         typename Vector::field_type sumVz = 0.0;
@@ -331,7 +439,6 @@ public:
             sumVz += (V_crit * z[compIdx]);
         }
 
-        // Calculate approximate (pseudo) critical temperature using Li's method
         typename Vector::field_type Tc_est = 0.0;
         for (int compIdx=0; compIdx<numComponents; ++compIdx){
             // Get component information
@@ -341,6 +448,14 @@ public:
             // Sum calculation
             Tc_est += (V_crit * T_crit * z[compIdx] / sumVz);
         }
+        return Tc_est;
+    }
+
+    template <class Vector, class FlashFluidState>
+    static typename Vector::field_type li_single_phase_label_(const FlashFluidState& fluid_state, const Vector& z, int verbosity)
+    {
+        // Calculate approximate (pseudo) critical temperature using Li's method
+        const auto Tc_est = liPseudoCriticalTemperature_(z);
 
         // Get temperature
         const auto& T = fluid_state.temperature(0);
@@ -371,7 +486,8 @@ public:
     }
 
     template <class FlashFluidState, class ComponentVector>
-    static void phaseStabilityTest_(bool& isStable, ComponentVector& K, FlashFluidState& fluid_state, const ComponentVector& z, const EOSType& eos_type, int verbosity)
+    static void phaseStabilityTest_(bool& isStable, ComponentVector& K, FlashFluidState& fluid_state, const ComponentVector& z, const EOSType& eos_type, int verbosity,
+                                    typename FlashFluidState::Scalar* margin = nullptr)
     {
         // Declarations
         bool isTrivialL, isTrivialV;
@@ -396,6 +512,16 @@ public:
 
         // L-stable means success in making liquid, V-unstable means no success in making vapour
         isStable = L_stable && V_unstable;
+        if (margin != nullptr) {
+            // A trial phase which collapses onto the feed only signals
+            // stability as far as the cell is away from the critical point.
+            const auto T = fluid_state.temperature(0);
+            const auto Tc_est = liPseudoCriticalTemperature_(z);
+            const auto critical_distance = Opm::abs(T - Tc_est) / Tc_est;
+            const auto margin_v = isTrivialV ? critical_distance : (1.0 + 1e-5) - S_v;
+            const auto margin_l = isTrivialL ? critical_distance : (1.0 + 1e-5) - S_l;
+            *margin = std::min(margin_v, margin_l);
+        }
         if (isStable) {
             // Single phase, i.e. phase composition is equivalent to the global composition
             // Update fluid_state with mole fraction
@@ -413,6 +539,155 @@ public:
     }
 
 protected:
+    static constexpr Scalar rachfordRiceTolerance_ = 1e-12;
+
+    template <class FluidState>
+    static CompositionalFluidState<Scalar, FluidSystem> scalarFluidState_(const FluidState& fluid_state)
+    {
+        CompositionalFluidState<Scalar, FluidSystem> fluid_state_scalar;
+
+        for (unsigned compIdx = 0; compIdx < numComponents; ++compIdx) {
+            fluid_state_scalar.setKvalue(compIdx, Opm::getValue(fluid_state.K(compIdx) ) );
+            fluid_state_scalar.setMoleFraction(compIdx, Opm::getValue(fluid_state.moleFraction(compIdx) ) );
+        }
+
+        fluid_state_scalar.setLvalue(Opm::getValue(fluid_state.L()));
+        // other values need to be Scalar, but I guess the fluidstate does not support it yet.
+        fluid_state_scalar.setPressure(FluidSystem::oilPhaseIdx,
+                                       Opm::getValue(fluid_state.pressure(FluidSystem::oilPhaseIdx)));
+        fluid_state_scalar.setPressure(FluidSystem::gasPhaseIdx,
+                                       Opm::getValue(fluid_state.pressure(FluidSystem::gasPhaseIdx)));
+
+        fluid_state_scalar.setTemperature(Opm::getValue(fluid_state.temperature(0)));
+
+        return fluid_state_scalar;
+    }
+
+    template <class FlashFluidStateScalar, class FluidState>
+    static void assignFlashResult_(const FlashFluidStateScalar& fluid_state_scalar,
+                                   FluidState& fluid_state,
+                                   const EOSType& eos_type,
+                                   bool is_single_phase)
+    {
+        // the flash solution process were performed in scalar form, after the flash calculation finishes,
+        // ensure that things in fluid_state_scalar is transformed to fluid_state
+        for (int compIdx=0; compIdx<numComponents; ++compIdx){
+                const auto x_i = fluid_state_scalar.moleFraction(oilPhaseIdx, compIdx);
+                fluid_state.setMoleFraction(oilPhaseIdx, compIdx, x_i);
+                const auto y_i = fluid_state_scalar.moleFraction(gasPhaseIdx, compIdx);
+                fluid_state.setMoleFraction(gasPhaseIdx, compIdx, y_i);
+        }
+
+        // we update the derivatives in fluid_state
+        updateDerivatives_(fluid_state_scalar, fluid_state, eos_type, is_single_phase);
+    }
+
+    // Whether a previously stable cell has moved so little since its last
+    // conclusive stability test that it must still be stable.
+    template <class FlashFluidState, class ComponentVector>
+    static bool inShadowRegion_(const StabilityHistory& history,
+                                const FlashFluidState& fluid_state,
+                                const ComponentVector& z,
+                                const Scalar shadow_factor)
+    {
+        if (!(history.margin > 0) || !(shadow_factor > 0)) {
+            return false;
+        }
+
+        const Scalar p = fluid_state.pressure(0);
+        const Scalar T = fluid_state.temperature(0);
+        Scalar change = Opm::abs(p - history.pressure) / p
+                      + Opm::abs(T - history.temperature) / T;
+        for (int compIdx = 0; compIdx < numComponents; ++compIdx) {
+            change += Opm::abs(z[compIdx] - history.z[compIdx]);
+        }
+
+        return change < shadow_factor * history.margin;
+    }
+
+    // Bracket [Vmin, Vmax] of the vapour fraction.  Have to do a laborious
+    // for loop to avoid water component (where K=0).
+    // TODO: Replace loop with Dune::min_value() and Dune::max_value() when water component is properly handled
+    template <class Vector>
+    static void rachfordRiceBounds_(const Vector& K,
+                                    typename Vector::field_type& Vmin,
+                                    typename Vector::field_type& Vmax)
+    {
+        using field_type = typename Vector::field_type;
+        field_type Kmin = K[0];
+        field_type Kmax = K[0];
+        for (int compIdx = 1; compIdx < numComponents; ++compIdx){
+            if (K[compIdx] < Kmin)
+                Kmin = K[compIdx];
+            else if (K[compIdx] >= Kmax)
+                Kmax = K[compIdx];
+        }
+        Vmin = 1 / (1 - Kmax);
+        Vmax = 1 / (1 - Kmin);
+    }
+
+    // Solve the Rachford-Rice equation of the given cells.  The Newton
+    // iterations of solveRachfordRice_g_() are run in lock-step over
+    // structure-of-arrays copies of K and z; cells which leave their bracket
+    // or do not converge within the lock-step budget are handed to the
+    // scalar solver, so every cell gets the same L as from
+    // solveRachfordRice_g_().
+    template <class ComponentVector>
+    static void solveRachfordRiceBatch_(const std::vector<ComponentVector>& K,
+                                        const std::vector<ComponentVector>& z,
+                                        const std::vector<std::size_t>& cells,
+                                        std::vector<Scalar>& L)
+    {
+        enum Status : unsigned char { Active, Converged, Fallback };
+        constexpr int max_lockstep_it = 100;
+
+        const auto n = cells.size();
+        std::vector<Scalar> dK(numComponents * n), zs(numComponents * n);
+        std::vector<Scalar> V(n), Vmin(n), Vmax(n);
+        std::vector<Status> status(n, Active);
+
+        for (std::size_t c = 0; c < n; ++c) {
+            const auto cell = cells[c];
+            rachfordRiceBounds_(K[cell], Vmin[c], Vmax[c]);
+            V[c] = (Vmin[c] + Vmax[c])/2;
+            for (int compIdx = 0; compIdx < numComponents; ++compIdx) {
+                dK[compIdx*n + c] = K[cell][compIdx] - 1.0;
+                zs[compIdx*n + c] = z[cell][compIdx];
+            }
+        }
+
+        std::size_t num_active = n;
+        for (int iteration = 1; iteration < max_lockstep_it && num_active > 0; ++iteration) {
+            num_active = 0;
+#pragma omp simd reduction(+:num_active)
+            for (std::size_t c = 0; c < n; ++c) {
+                Scalar denum = 0.0;
+                Scalar r = 0.0;
+                for (int compIdx = 0; compIdx < numComponents; ++compIdx) {
+                    const auto dKi = dK[compIdx*n + c];
+                    const auto a = zs[compIdx*n + c] * dKi;
+                    const auto b = (1 + V[c] * dKi);
+                    r += a/b;
+                    denum += zs[compIdx*n + c] * (dKi*dKi) / (b*b);
+                }
+                const auto V_new = V[c] + r / denum;
+                const bool outside = (V_new < Vmin[c]) || (V_new > Vmax[c]);
+                const bool active = status[c] == Active;
+
+                V[c] = (active && !outside) ? V_new : V[c];
+                status[c] = !active ? status[c]
+                          : outside ? Fallback
+                          : (Opm::abs(r) < rachfordRiceTolerance_) ? Converged : Active;
+                num_active += (status[c] == Active);
+            }
+        }
+
+        for (std::size_t c = 0; c < n; ++c) {
+            const auto cell = cells[c];
+            L[cell] = (status[c] == Converged)
+                ? 1 - V[c] : solveRachfordRice_g_(K[cell], z[cell], 0);
+        }
+    }
 
     template <class FlashFluidState>
     static typename FlashFluidState::Scalar wilsonK_(const FlashFluidState& fluid_state, int compIdx)
@@ -671,7 +946,7 @@ protected:
         // AD type
         using Eval = DenseAd::Evaluation<Scalar, num_primary_variables>;
         // TODO: we might need to use numMiscibleComponents here
-        std::vector<Eval> x(numComponents), y(numComponents);
+        std::array<Eval, numComponents> x, y;
         Eval l;
 
         // TODO: I might not need to set soln anything here.
@@ -792,7 +1067,7 @@ protected:
                                 Dune::FieldVector<double, num_equation>& res)
     {
         using Eval = DenseAd::Evaluation<double, num_primary>;
-        std::vector<Eval> x(numComponents), y(numComponents);
+        std::array<Eval, numComponents> x, y;
         for (unsigned compIdx = 0; compIdx < numComponents; ++compIdx) {
             x[compIdx] = fluid_state.moleFraction(oilPhaseIdx, compIdx);
             y[compIdx] = fluid_state.moleFraction(gasPhaseIdx, compIdx);
@@ -994,7 +1269,7 @@ protected:
 
         constexpr size_t num_deri = numComponents;
         for (unsigned compIdx = 0; compIdx < numComponents; ++compIdx) {
-            std::vector<double> deri(num_deri, 0.);
+            std::array<double, num_deri> deri{};
             // derivatives from P
             for (unsigned idx = 0; idx < num_deri; ++idx) {
                 deri[idx] = -sec_jac[compIdx][0] * p_l.derivative(idx);
@@ -1026,7 +1301,7 @@ protected:
             }
 
             // handling derivatives of L
-            std::vector<double> deriL(num_deri, 0.);
+            std::array<double, num_deri> deriL{};
             for (unsigned idx = 0; idx < num_deri; ++idx) {
                 deriL[idx] = -sec_jac[2 * numComponents][0] * p_v.derivative(idx);
             }
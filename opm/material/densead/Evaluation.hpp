@@ -122,7 +122,7 @@ public:
     // i.e., f(x) = c. this implies an evaluation with the given value and all
     // derivatives being zero.
     template <class RhsValueType>
-    OPM_HOST_DEVICE Evaluation(const RhsValueType& c, int varPos)
+    OPM_HOST_DEVICE Evaluation(const RhsValueType& c, int varPos) : data_{}
     {
         // The variable position must be in represented by the given variable descriptor
         assert(0 <= varPos && varPos < size());
@@ -41,6 +41,7 @@
 #include <stdexcept>
 
 #include <opm/common/utility/gpuDecorators.hpp>
+#include <opm/material/densead/SimdStorage.hpp>
 
 namespace Opm {
 namespace DenseAd {
@@ -113,7 +114,7 @@ public:
     // i.e., f(x) = c. this implies an evaluation with the given value and all
     // derivatives being zero.
     template <class RhsValueType>
-    OPM_HOST_DEVICE Evaluation(const RhsValueType& c, int varPos)
+    OPM_HOST_DEVICE Evaluation(const RhsValueType& c, int varPos) : data_{}
     {
         // The variable position must be in represented by the given variable descriptor
         assert(0 <= varPos && varPos < size());
@@ -223,17 +224,23 @@ public:
     {
         assert(size() == other.size());
 
-        data_[1] = other.data_[1];
-        data_[2] = other.data_[2];
-        data_[3] = other.data_[3];
-        data_[4] = other.data_[4];
-        data_[5] = other.data_[5];
-        data_[6] = other.data_[6];
-        data_[7] = other.data_[7];
-        data_[8] = other.data_[8];
-        data_[9] = other.data_[9];
-        data_[10] = other.data_[10];
-        data_[11] = other.data_[11];
+        if constexpr (Storage_::enabled) {
+            for (int i = dstart_(); i < Storage_::size; ++i)
+                data_[i] = other.data_[i];
+        }
+        else {
+            data_[1] = other.data_[1];
+            data_[2] = other.data_[2];
+            data_[3] = other.data_[3];
+            data_[4] = other.data_[4];
+            data_[5] = other.data_[5];
+            data_[6] = other.data_[6];
+            data_[7] = other.data_[7];
+            data_[8] = other.data_[8];
+            data_[9] = other.data_[9];
+            data_[10] = other.data_[10];
+            data_[11] = other.data_[11];
+        }
     }
 
 
@@ -242,18 +249,26 @@ public:
     {
         assert(size() == other.size());
 
-        data_[0] += other.data_[0];
-        data_[1] += other.data_[1];
-        data_[2] += other.data_[2];
-        data_[3] += other.data_[3];
-        data_[4] += other.data_[4];
-        data_[5] += other.data_[5];
-        data_[6] += other.data_[6];
-        data_[7] += other.data_[7];
-        data_[8] += other.data_[8];
-        data_[9] += other.data_[9];
-        data_[10] += other.data_[10];
-        data_[11] += other.data_[11];
+        if constexpr (Storage_::enabled) {
+            decltype(data_) result;
+            for (int i = 0; i < Storage_::size; ++i)
+                result[i] = data_[i] + other.data_[i];
+            data_ = result;
+        }
+        else {
+            data_[0] += other.data_[0];
+            data_[1] += other.data_[1];
+            data_[2] += other.data_[2];
+            data_[3] += other.data_[3];
+            data_[4] += other.data_[4];
+            data_[5] += other.data_[5];
+            data_[6] += other.data_[6];
+            data_[7] += other.data_[7];
+            data_[8] += other.data_[8];
+            data_[9] += other.data_[9];
+            data_[10] += other.data_[10];
+            data_[11] += other.data_[11];
+        }
 
         return *this;
     }
@@ -273,18 +288,26 @@ public:
     {
         assert(size() == other.size());
 
-        data_[0] -= other.data_[0];
-        data_[1] -= other.data_[1];
-        data_[2] -= other.data_[2];
-        data_[3] -= other.data_[3];
-        data_[4] -= other.data_[4];
-        data_[5] -= other.data_[5];
-        data_[6] -= other.data_[6];
-        data_[7] -= other.data_[7];
-        data_[8] -= other.data_[8];
-        data_[9] -= other.data_[9];
-        data_[10] -= other.data_[10];
-        data_[11] -= other.data_[11];
+        if constexpr (Storage_::enabled) {
+            decltype(data_) result;
+            for (int i = 0; i < Storage_::size; ++i)
+                result[i] = data_[i] - other.data_[i];
+            data_ = result;
+        }
+        else {
+            data_[0] -= other.data_[0];
+            data_[1] -= other.data_[1];
+            data_[2] -= other.data_[2];
+            data_[3] -= other.data_[3];
+            data_[4] -= other.data_[4];
+            data_[5] -= other.data_[5];
+            data_[6] -= other.data_[6];
+            data_[7] -= other.data_[7];
+            data_[8] -= other.data_[8];
+            data_[9] -= other.data_[9];
+            data_[10] -= other.data_[10];
+            data_[11] -= other.data_[11];
+        }
 
         return *this;
     }
@@ -309,6 +332,17 @@ public:
         const ValueType u = this->value();
         const ValueType v = other.value();
 
+        if constexpr (Storage_::enabled) {
+            // all lanes at once, where the value lane only gets u*v. The
+            // result is written at the end, as other may be this object.
+            decltype(data_) result;
+            for (int i = 0; i < Storage_::size; ++i)
+                result[i] = data_[i] * v + other.data_[i] * (i == valuepos_() ? 0.0 : u);
+            data_ = result;
+
+            return *this;
+        }
+
         // value
         data_[valuepos_()] *= v ;
 
@@ -332,18 +366,24 @@ public:
     template <class RhsValueType>
     OPM_HOST_DEVICE Evaluation& operator*=(const RhsValueType& other)
     {
-        data_[0] *= other;
-        data_[1] *= other;
-        data_[2] *= other;
-        data_[3] *= other;
-        data_[4] *= other;
-        data_[5] *= other;
-        data_[6] *= other;
-        data_[7] *= other;
-        data_[8] *= other;
-        data_[9] *= other;
-        data_[10] *= other;
-        data_[11] *= other;
+        if constexpr (Storage_::enabled) {
+            for (int i = 0; i < Storage_::size; ++i)
+                data_[i] *= other;
+        }
+        else {
+            data_[0] *= other;
+            data_[1] *= other;
+            data_[2] *= other;
+            data_[3] *= other;
+            data_[4] *= other;
+            data_[5] *= other;
+            data_[6] *= other;
+            data_[7] *= other;
+            data_[8] *= other;
+            data_[9] *= other;
+            data_[10] *= other;
+            data_[11] *= other;
+        }
 
         return *this;
     }
@@ -355,6 +395,20 @@ public:
 
         // values are divided, derivatives follow the rule for division, i.e., (u/v)' = (v'u -
         // u'v)/v^2.
+        if constexpr (Storage_::enabled) {
+            // (u/v)' = (u' - (u/v)v')/v for all lanes at once, with a single
+            // division, where the value lane gets u/v.
+            // The result is written at the end, as other may be this object.
+            const ValueType q = data_[valuepos_()] / other.value();
+            const ValueType vInv = 1.0 / other.value();
+            decltype(data_) result;
+            for (int i = 0; i < Storage_::size; ++i)
+                result[i] = (i == valuepos_()) ? q : (data_[i] - q * other.data_[i]) * vInv;
+            data_ = result;
+
+            return *this;
+        }
+
         ValueType& u = data_[valuepos_()];
         const ValueType& v = other.value();
         data_[1] = (v*data_[1] - u*other.data_[1])/(v*v);
@@ -379,18 +433,24 @@ public:
     {
         const ValueType tmp = 1.0/other;
 
-        data_[0] *= tmp;
-        data_[1] *= tmp;
-        data_[2] *= tmp;
-        data_[3] *= tmp;
-        data_[4] *= tmp;
-        data_[5] *= tmp;
-        data_[6] *= tmp;
-        data_[7] *= tmp;
-        data_[8] *= tmp;
-        data_[9] *= tmp;
-        data_[10] *= tmp;
-        data_[11] *= tmp;
+        if constexpr (Storage_::enabled) {
+            for (int i = 0; i < Storage_::size; ++i)
+                data_[i] *= tmp;
+        }
+        else {
+            data_[0] *= tmp;
+            data_[1] *= tmp;
+            data_[2] *= tmp;
+            data_[3] *= tmp;
+            data_[4] *= tmp;
+            data_[5] *= tmp;
+            data_[6] *= tmp;
+            data_[7] *= tmp;
+            data_[8] *= tmp;
+            data_[9] *= tmp;
+            data_[10] *= tmp;
+            data_[11] *= tmp;
+        }
 
         return *this;
     }
@@ -447,18 +507,24 @@ public:
         Evaluation result;
 
         // set value and derivatives to negative
-        result.data_[0] = - data_[0];
-        result.data_[1] = - data_[1];
-        result.data_[2] = - data_[2];
-        result.data_[3] = - data_[3];
-        result.data_[4] = - data_[4];
-        result.data_[5] = - data_[5];
-        result.data_[6] = - data_[6];
-        result.data_[7] = - data_[7];
-        result.data_[8] = - data_[8];
-        result.data_[9] = - data_[9];
-        result.data_[10] = - data_[10];
-        result.data_[11] = - data_[11];
+        if constexpr (Storage_::enabled) {
+            for (int i = 0; i < Storage_::size; ++i)
+                result.data_[i] = - data_[i];
+        }
+        else {
+            result.data_[0] = - data_[0];
+            result.data_[1] = - data_[1];
+            result.data_[2] = - data_[2];
+            result.data_[3] = - data_[3];
+            result.data_[4] = - data_[4];
+            result.data_[5] = - data_[5];
+            result.data_[6] = - data_[6];
+            result.data_[7] = - data_[7];
+            result.data_[8] = - data_[8];
+            result.data_[9] = - data_[9];
+            result.data_[10] = - data_[10];
+            result.data_[11] = - data_[11];
+        }
 
         return result;
     }
@@ -616,7 +682,9 @@ public:
     }
 
 private:
-    std::array<ValueT, 12> data_;
+    using Storage_ = SimdStorage<ValueT, 12>;
+
+    alignas(Storage_::alignment) std::array<ValueT, Storage_::size> data_;
 };
 
 } // namespace DenseAd
@@ -94,6 +94,17 @@ OPM_HOST_DEVICE Evaluation<ValueType, numVars, staticSize> max(const Evaluation<
                                                const Arg2ValueType& x2)
 { return max(x2, x1); }
 
+// apply the chain rule of a function with derivative df_dx to the derivatives
+// of result, keeping its value. All lanes are scaled at once.
+template <class ValueType, int numVars, unsigned staticSize>
+OPM_HOST_DEVICE void applyChainRule(Evaluation<ValueType, numVars, staticSize>& result,
+                                    const ValueType df_dx)
+{
+    const ValueType value = result.value();
+    result *= df_dx;
+    result.setValue(value);
+}
+
 template <class ValueType, int numVars, unsigned staticSize>
 OPM_HOST_DEVICE Evaluation<ValueType, numVars, staticSize> tan(const Evaluation<ValueType, numVars, staticSize>& x)
 {
@@ -106,8 +117,7 @@ OPM_HOST_DEVICE Evaluation<ValueType, numVars, staticSize> tan(const Evaluation<
 
     // derivatives use the chain rule
     const ValueType& df_dx = 1 + tmp*tmp;
-    for (int curVarIdx = 0; curVarIdx < result.size(); ++curVarIdx)
-        result.setDerivative(curVarIdx, df_dx*x.derivative(curVarIdx));
+    applyChainRule(result, df_dx);
 
     return result;
 }
@@ -123,8 +133,7 @@ OPM_HOST_DEVICE Evaluation<ValueType, numVars, staticSize> atan(const Evaluation
 
     // derivatives use the chain rule
     const ValueType& df_dx = 1/(1 + x.value()*x.value());
-    for (int curVarIdx = 0; curVarIdx < result.size(); ++curVarIdx)
-        result.setDerivative(curVarIdx, df_dx*x.derivative(curVarIdx));
+    applyChainRule(result, df_dx);
 
     return result;
 }
@@ -203,8 +212,7 @@ OPM_HOST_DEVICE Evaluation<ValueType, numVars, staticSize> sin(const Evaluation<
 
     // derivatives use the chain rule
     const ValueType& df_dx = ValueTypeToolbox::cos(x.value());
-    for (int curVarIdx = 0; curVarIdx < result.size(); ++curVarIdx)
-        result.setDerivative(curVarIdx, df_dx*x.derivative(curVarIdx));
+    applyChainRule(result, df_dx);
 
     return result;
 }
@@ -220,8 +228,7 @@ OPM_HOST_DEVICE Evaluation<ValueType, numVars, staticSize> asin(const Evaluation
 
     // derivatives use the chain rule
     const ValueType& df_dx = 1.0/ValueTypeToolbox::sqrt(1 - x.value()*x.value());
-    for (int curVarIdx = 0; curVarIdx < result.size(); ++curVarIdx)
-        result.setDerivative(curVarIdx, df_dx*x.derivative(curVarIdx));
+    applyChainRule(result, df_dx);
 
     return result;
 }
@@ -237,8 +244,7 @@ OPM_HOST_DEVICE Evaluation<ValueType, numVars, staticSize> sinh(const Evaluation
 
     // derivatives use the chain rule
     const ValueType& df_dx = ValueTypeToolbox::cosh(x.value());
-    for (int curVarIdx = 0; curVarIdx < result.size(); ++curVarIdx)
-        result.setDerivative(curVarIdx, df_dx*x.derivative(curVarIdx));
+    applyChainRule(result, df_dx);
 
     return result;
 }
@@ -254,8 +260,7 @@ OPM_HOST_DEVICE Evaluation<ValueType, numVars, staticSize> asinh(const Evaluatio
 
     // derivatives use the chain rule
     const ValueType& df_dx = 1.0/ValueTypeToolbox::sqrt(x.value()*x.value() + 1);
-    for (int curVarIdx = 0; curVarIdx < result.size(); ++curVarIdx)
-        result.setDerivative(curVarIdx, df_dx*x.derivative(curVarIdx));
+    applyChainRule(result, df_dx);
 
     return result;
 }
@@ -271,8 +276,7 @@ OPM_HOST_DEVICE Evaluation<ValueType, numVars, staticSize> cos(const Evaluation<
 
     // derivatives use the chain rule
     const ValueType& df_dx = -ValueTypeToolbox::sin(x.value());
-    for (int curVarIdx = 0; curVarIdx < result.size(); ++curVarIdx)
-        result.setDerivative(curVarIdx, df_dx*x.derivative(curVarIdx));
+    applyChainRule(result, df_dx);
 
     return result;
 }
@@ -288,8 +292,7 @@ OPM_HOST_DEVICE Evaluation<ValueType, numVars, staticSize> acos(const Evaluation
 
     // derivatives use the chain rule
     const ValueType& df_dx = - 1.0/ValueTypeToolbox::sqrt(1 - x.value()*x.value());
-    for (int curVarIdx = 0; curVarIdx < result.size(); ++curVarIdx)
-        result.setDerivative(curVarIdx, df_dx*x.derivative(curVarIdx));
+    applyChainRule(result, df_dx);
 
     return result;
 }
@@ -305,8 +308,7 @@ OPM_HOST_DEVICE Evaluation<ValueType, numVars, staticSize> cosh(const Evaluation
 
     // derivatives use the chain rule
     const ValueType& df_dx = ValueTypeToolbox::sinh(x.value());
-    for (int curVarIdx = 0; curVarIdx < result.size(); ++curVarIdx)
-        result.setDerivative(curVarIdx, df_dx*x.derivative(curVarIdx));
+    applyChainRule(result, df_dx);
 
     return result;
 }
@@ -322,8 +324,7 @@ OPM_HOST_DEVICE Evaluation<ValueType, numVars, staticSize> acosh(const Evaluatio
 
     // derivatives use the chain rule
     const ValueType& df_dx = 1.0/ValueTypeToolbox::sqrt(x.value()*x.value() - 1);
-    for (int curVarIdx = 0; curVarIdx < result.size(); ++curVarIdx)
-        result.setDerivative(curVarIdx, df_dx*x.derivative(curVarIdx));
+    applyChainRule(result, df_dx);
 
     return result;
 }
@@ -340,9 +341,7 @@ OPM_HOST_DEVICE Evaluation<ValueType, numVars, staticSize> sqrt(const Evaluation
 
     // derivatives use the chain rule
     ValueType df_dx = 0.5/sqrt_x;
-    for (int curVarIdx = 0; curVarIdx < result.size(); ++curVarIdx) {
-        result.setDerivative(curVarIdx, df_dx*x.derivative(curVarIdx));
-    }
+    applyChainRule(result, df_dx);
 
     return result;
 }
@@ -358,8 +357,7 @@ OPM_HOST_DEVICE Evaluation<ValueType, numVars, staticSize> exp(const Evaluation<
 
     // derivatives use the chain rule
     const ValueType& df_dx = exp_x;
-    for (int curVarIdx = 0; curVarIdx < result.size(); ++curVarIdx)
-        result.setDerivative(curVarIdx, df_dx*x.derivative(curVarIdx));
+    applyChainRule(result, df_dx);
 
     return result;
 }
@@ -383,8 +381,7 @@ OPM_HOST_DEVICE Evaluation<ValueType, numVars, staticSize> pow(const Evaluation<
     else {
         // derivatives use the chain rule
         const ValueType& df_dx = pow_x/base.value()*exp;
-        for (int curVarIdx = 0; curVarIdx < result.size(); ++curVarIdx)
-            result.setDerivative(curVarIdx, df_dx*base.derivative(curVarIdx));
+        applyChainRule(result, df_dx);
     }
 
     return result;
@@ -410,8 +407,7 @@ OPM_HOST_DEVICE Evaluation<ValueType, numVars, staticSize> pow(const BaseType& b
 
         // derivatives use the chain rule
         const ValueType& df_dx = lnBase*result.value();
-        for (int curVarIdx = 0; curVarIdx < result.size(); ++curVarIdx)
-            result.setDerivative(curVarIdx, df_dx*exp.derivative(curVarIdx));
+        applyChainRule(result, df_dx);
     }
 
     return result;
@@ -462,8 +458,7 @@ OPM_HOST_DEVICE Evaluation<ValueType, numVars, staticSize> log(const Evaluation<
 
     // derivatives use the chain rule
     const ValueType& df_dx = 1/x.value();
-    for (int curVarIdx = 0; curVarIdx < result.size(); ++curVarIdx)
-        result.setDerivative(curVarIdx, df_dx*x.derivative(curVarIdx));
+    applyChainRule(result, df_dx);
 
     return result;
 }
@@ -480,8 +475,7 @@ OPM_HOST_DEVICE Evaluation<ValueType, numVars, staticSize> log10(const Evaluatio
 
     // derivatives use the chain rule
     const ValueType& df_dx = 1/x.value() * ValueTypeToolbox::log10(ValueTypeToolbox::exp(1.0));
-    for (int curVarIdx = 0; curVarIdx < result.size(); ++curVarIdx)
-        result.setDerivative(curVarIdx, df_dx*x.derivative(curVarIdx));
+    applyChainRule(result, df_dx);
 
     return result;
 }
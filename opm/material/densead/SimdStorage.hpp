@@ -0,0 +1,116 @@
+// -*- mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-
+// vi: set et ts=4 sw=4 sts=4:
+/*
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 2 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+
+  Consult the COPYING file in the top-level source directory of this
+  module for the precise wording of the license and the list of
+  copyright holders.
+*/
+/*!
+ * \file
+ *
+ * \brief Layout of the value and derivatives of statically sized dense-AD
+ *        evaluations.
+ */
+#ifndef OPM_DENSEAD_SIMD_STORAGE_HPP
+#define OPM_DENSEAD_SIMD_STORAGE_HPP
+
+#include <opm/common/utility/gpuDecorators.hpp>
+
+#include <type_traits>
+
+namespace Opm {
+namespace DenseAd {
+
+//! Width in bytes of the SIMD registers used for the storage of evaluations.
+//!
+//! The SIMD storage is enabled by building with OPM_DENSEAD_SIMD. The width
+//! is determined when configuring the build, from the instruction set of the
+//! compiler flags, and given by OPM_DENSEAD_SIMD_BYTES in config.h, so that
+//! all translation units agree on the layout of the evaluations. AVX-512
+//! targets use 256 bit registers as well, which compilers prefer for
+//! arithmetic on them. Otherwise, and in code compiled for GPUs, the width is
+//! zero and evaluations keep the scalar layout.
+#if OPM_DENSEAD_SIMD && !OPM_IS_USING_GPU
+#ifndef OPM_DENSEAD_SIMD_BYTES
+#error "OPM_DENSEAD_SIMD requires the register width OPM_DENSEAD_SIMD_BYTES"
+#endif
+static constexpr int simdRegisterBytes = OPM_DENSEAD_SIMD_BYTES;
+#else
+static constexpr int simdRegisterBytes = 0;
+#endif
+
+static_assert(simdRegisterBytes == 0 || simdRegisterBytes == 16 || simdRegisterBytes == 32,
+              "Unsupported SIMD register width for dense AD evaluations");
+
+/*!
+ * \brief Storage size and alignment of \p length values of type \p ValueT.
+ *
+ * With SIMD storage, the length is padded to fill whole registers, using the
+ * narrowest register which holds all values for short evaluations. The
+ * padding lanes are kept zero, so that arithmetic may process all lanes.
+ * Lengths just above a single register which would need more than one lane
+ * of padding keep the scalar layout, as the padding costs more than the
+ * vectorization gains there.
+ */
+template <class ValueT, int length>
+struct SimdStorage
+{
+private:
+    static constexpr int lanes_ = std::is_arithmetic_v<ValueT>
+        ? simdRegisterBytes / static_cast<int>(sizeof(ValueT))
+        : 0;
+
+    // padded length, or zero for the scalar layout
+    static constexpr int padded_()
+    {
+        if (lanes_ < 2) {
+            return 0;
+        }
+        if (length <= lanes_) {
+            int width = 2;
+            while (width < length) {
+                width *= 2;
+            }
+            return width;
+        }
+        const int padded = (length + lanes_ - 1) / lanes_ * lanes_;
+        if (padded - length > 1 && padded == 2 * lanes_) {
+            return 0;
+        }
+        return padded;
+    }
+
+public:
+    //! true iff the storage is padded to SIMD registers
+    static constexpr bool enabled = padded_() > 0;
+
+    //! number of values stored, including padding
+    static constexpr int size = enabled ? padded_() : length;
+
+    //! alignment of the storage, such that no register or cache line is split
+    static constexpr int alignment = enabled
+        ? (size * static_cast<int>(sizeof(ValueT)) < 64
+           ? size * static_cast<int>(sizeof(ValueT))
+           : 64)
+        : static_cast<int>(alignof(ValueT));
+};
+
+} // namespace DenseAd
+} // namespace Opm
+
+#endif // OPM_DENSEAD_SIMD_STORAGE_HPP
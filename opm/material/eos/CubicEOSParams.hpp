@@ -31,6 +31,8 @@
 #include <opm/material/eos/RKParams.hpp>
 #include <opm/material/eos/SRKParams.hpp>
 
+#include <array>
+
 namespace Opm
 {
 
@@ -86,25 +88,26 @@ public:
     {
         using FlashEval = typename FluidState::Scalar;
         
+        std::array<FlashEval, numComponents> x;
+        for (unsigned compIdx = 0; compIdx < numComponents; ++compIdx) {
+            const FlashEval moleFrac = fs.moleFraction(phaseIdx, compIdx);
+            x[compIdx] = max(0.0, min(1.0, moleFrac));
+            Valgrind::CheckDefined(x[compIdx]);
+        }
+
         FlashEval newA = 0;
         FlashEval newB = 0;
         for (unsigned compIIdx = 0; compIIdx < numComponents; ++compIIdx) {
-            const FlashEval moleFracI = fs.moleFraction(phaseIdx, compIIdx);
-            FlashEval xi = max(0.0, min(1.0, moleFracI));
-            Valgrind::CheckDefined(xi);
-
+            // Calculate A
+            FlashEval sumA = 0;
             for (unsigned compJIdx = 0; compJIdx < numComponents; ++compJIdx) {
-                const FlashEval moleFracJ = fs.moleFraction(phaseIdx, compJIdx );
-                FlashEval xj = max(0.0, min(1.0, moleFracJ));
-                Valgrind::CheckDefined(xj);
-
-                // Calculate A 
-                newA +=  xi * xj * aCache_[compIIdx][compJIdx];
-                assert(std::isfinite(scalarValue(newA)));
+                sumA += x[compJIdx] * aCache_[compIIdx][compJIdx];
             }
+            newA += x[compIIdx] * sumA;
+            assert(std::isfinite(scalarValue(newA)));
 
             // Calculate B
-            newB += max(0.0, xi) * Bi(compIIdx);
+            newB += x[compIIdx] * Bi(compIIdx);
             assert(std::isfinite(scalarValue(newB)));
         }
 
@@ -209,12 +212,17 @@ protected:
 private:
     void updateACache_()
     {
+        std::array<Scalar, numComponents> sqrtAi;
+        for (unsigned compIdx = 0; compIdx < numComponents; ++compIdx) {
+            sqrtAi[compIdx] = sqrt(Ai(compIdx));
+        }
+
         for (unsigned compIIdx = 0; compIIdx < numComponents; ++ compIIdx) {
             for (unsigned compJIdx = 0; compJIdx < numComponents; ++ compJIdx) {
                 // interaction coefficient as given in SPE5
                 Scalar Psi = FluidSystem::interactionCoefficient(compIIdx, compJIdx);
 
-                aCache_[compIIdx][compJIdx] = sqrt(Ai(compIIdx) * Ai(compJIdx)) * (1 - Psi);
+                aCache_[compIIdx][compJIdx] = sqrtAi[compIIdx] * sqrtAi[compJIdx] * (1 - Psi);
             }
         }
     }
@@ -34,6 +34,11 @@
 #include <opm/material/fluidstates/SimpleModularFluidState.hpp>
 
 #include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <utility>
 
 namespace Opm {
 
@@ -157,7 +162,7 @@ applySwatinit(unsigned elemIdx,
         return {Sw, /*newSwatInit*/ true};
     }
 
-    auto& elemScaledEpsInfo = oilWaterScaledEpsInfoDrainage_[elemIdx];
+    auto& elemScaledEpsInfo = oilWaterScaledEpsInfoDrainage_[detachCompactParams_(elemIdx)];
     if (Sw <= elemScaledEpsInfo.Swl)
         Sw = elemScaledEpsInfo.Swl;
 
@@ -228,7 +233,7 @@ EclMaterialLawManager<TraitsT>::applyRestartSwatInit(const unsigned elemIdx,
     // Maximum capillary pressure adjusted from SWATINIT data.
 
     auto& elemScaledEpsInfo =
-        this->oilWaterScaledEpsInfoDrainage_[elemIdx];
+        this->oilWaterScaledEpsInfoDrainage_[this->detachCompactParams_(elemIdx)];
 
     elemScaledEpsInfo.maxPcow = maxPcow;
 
@@ -243,10 +248,34 @@ const typename EclMaterialLawManager<TraitsT>::MaterialLawParams&
 EclMaterialLawManager<TraitsT>::
 connectionMaterialLawParams(unsigned satRegionIdx, unsigned elemIdx) const
 {
-    MaterialLawParams& mlp = const_cast<MaterialLawParams&>(materialLawParams_[elemIdx]);
-
     if (enableHysteresis())
         OpmLog::warning("Warning: Using non-default satnum regions for connection is not tested in combination with hysteresis");
+
+    if (compactParamStorage()) {
+        // The element's parameter object is shared with other elements, so
+        // hand out a separate object pointing to the requested tables.
+        const auto paramsIdx = compactParamsIdx_[elemIdx];
+
+        std::lock_guard<std::mutex> lock { connectionMaterialLawParamsMutex_ };
+        auto [pos, inserted] = connectionMaterialLawParams_.try_emplace(std::pair { satRegionIdx, paramsIdx });
+        if (inserted) {
+            copyMaterialLawParams_(compactMaterialLawParams_[paramsIdx], pos->second);
+            setSatRegionTables_(pos->second, satRegionIdx);
+        }
+
+        return pos->second;
+    }
+
+    MaterialLawParams& mlp = const_cast<MaterialLawParams&>(materialLawParams_[elemIdx]);
+    setSatRegionTables_(mlp, satRegionIdx);
+
+    return mlp;
+}
+
+template<class TraitsT>
+void EclMaterialLawManager<TraitsT>::
+setSatRegionTables_(MaterialLawParams& mlp, unsigned satRegionIdx) const
+{
     // Currently we don't support COMPIMP. I.e. use the same table lookup for the hysteresis curves.
     // unsigned impRegionIdx = satRegionIdx;
 
@@ -325,7 +354,158 @@ connectionMaterialLawParams(unsigned satRegionIdx, unsigned elemIdx) const
         throw std::logic_error("Enum value for material approach unknown!");
     }
 
-    return mlp;
+}
+
+template<class TraitsT>
+void EclMaterialLawManager<TraitsT>::
+copyMaterialLawParams_(const MaterialLawParams& src, MaterialLawParams& dest) const
+{
+    // The three-phase parameter objects share their two-phase parameters
+    // through std::shared_ptr, so those must be copied explicitly.
+    dest.setApproach(src.approach());
+    switch (src.approach()) {
+    case EclMultiplexerApproach::Stone1: {
+        const auto& srcParams = src.template getRealParams<EclMultiplexerApproach::Stone1>();
+        auto& destParams = dest.template getRealParams<EclMultiplexerApproach::Stone1>();
+        destParams = srcParams;
+        destParams.setGasOilParams(std::make_shared<GasOilTwoPhaseHystParams>(srcParams.gasOilParams()));
+        destParams.setOilWaterParams(std::make_shared<OilWaterTwoPhaseHystParams>(srcParams.oilWaterParams()));
+        break;
+    }
+
+    case EclMultiplexerApproach::Stone2: {
+        const auto& srcParams = src.template getRealParams<EclMultiplexerApproach::Stone2>();
+        auto& destParams = dest.template getRealParams<EclMultiplexerApproach::Stone2>();
+        destParams = srcParams;
+        destParams.setGasOilParams(std::make_shared<GasOilTwoPhaseHystParams>(srcParams.gasOilParams()));
+        destParams.setOilWaterParams(std::make_shared<OilWaterTwoPhaseHystParams>(srcParams.oilWaterParams()));
+        break;
+    }
+
+    case EclMultiplexerApproach::Default:
+        dest.template getRealParams<EclMultiplexerApproach::Default>() =
+            src.template getRealParams<EclMultiplexerApproach::Default>();
+        break;
+
+    case EclMultiplexerApproach::TwoPhase: {
+        const auto& srcParams = src.template getRealParams<EclMultiplexerApproach::TwoPhase>();
+        auto& destParams = dest.template getRealParams<EclMultiplexerApproach::TwoPhase>();
+        destParams = srcParams;
+        destParams.setGasOilParams(std::make_shared<GasOilTwoPhaseHystParams>(srcParams.gasOilParams()));
+        destParams.setOilWaterParams(std::make_shared<OilWaterTwoPhaseHystParams>(srcParams.oilWaterParams()));
+        destParams.setGasWaterParams(std::make_shared<GasWaterTwoPhaseHystParams>(srcParams.gasWaterParams()));
+        break;
+    }
+
+    case EclMultiplexerApproach::OnePhase:
+        // Nothing to do, no parameters.
+        break;
+    }
+}
+
+template<class TraitsT>
+std::size_t EclMaterialLawManager<TraitsT>::
+detachCompactParams_(unsigned elemIdx)
+{
+    if (! compactParamStorage()) {
+        return elemIdx;
+    }
+
+    auto& paramsIdx = compactParamsIdx_[elemIdx];
+    if (compactParamsUseCount_[paramsIdx] > 1) {
+        const auto newIdx = static_cast<std::uint32_t>(compactMaterialLawParams_.size());
+
+        // Deque insertion does not invalidate references to existing elements.
+        copyMaterialLawParams_(compactMaterialLawParams_[paramsIdx],
+                               compactMaterialLawParams_.emplace_back());
+        oilWaterScaledEpsInfoDrainage_.push_back(oilWaterScaledEpsInfoDrainage_[paramsIdx]);
+        compactParamsUseCount_.push_back(1);
+
+        --compactParamsUseCount_[paramsIdx];
+        paramsIdx = newIdx;
+    }
+
+    return paramsIdx;
+}
+
+template<class TraitsT>
+void EclMaterialLawManager<TraitsT>::
+resizeCompactParams_(const std::size_t poolSize,
+                     const std::vector<std::uint32_t>& paramsIdx,
+                     const std::vector<std::uint32_t>& useCount)
+{
+    if ((paramsIdx.size() != compactParamsIdx_.size()) || (useCount.size() != poolSize)) {
+        throw std::runtime_error("Serialized material law parameters do not match the grid");
+    }
+
+    const auto oldSize = compactMaterialLawParams_.size();
+    if (poolSize < oldSize) {
+        while (compactMaterialLawParams_.size() > poolSize) {
+            compactMaterialLawParams_.pop_back();
+        }
+        oilWaterScaledEpsInfoDrainage_.resize(poolSize);
+    }
+    else if (poolSize > oldSize) {
+        // Copy the entry each new one was detached from in the other run.
+        auto source = std::vector<std::uint32_t>(poolSize - oldSize, 0);
+        for (std::size_t elemIdx = 0; elemIdx < paramsIdx.size(); ++elemIdx) {
+            if (paramsIdx[elemIdx] >= poolSize) {
+                throw std::runtime_error("Serialized material law parameters do not match the grid");
+            }
+            if (paramsIdx[elemIdx] >= oldSize) {
+                source[paramsIdx[elemIdx] - oldSize] = compactParamsIdx_[elemIdx];
+            }
+        }
+
+        for (const auto srcIdx : source) {
+            copyMaterialLawParams_(compactMaterialLawParams_[srcIdx],
+                                   compactMaterialLawParams_.emplace_back());
+            oilWaterScaledEpsInfoDrainage_.push_back(oilWaterScaledEpsInfoDrainage_[srcIdx]);
+        }
+    }
+
+    compactParamsIdx_ = paramsIdx;
+    compactParamsUseCount_ = useCount;
+
+    // Keyed by pool index.
+    std::lock_guard<std::mutex> lock { connectionMaterialLawParamsMutex_ };
+    connectionMaterialLawParams_.clear();
+}
+
+template<class TraitsT>
+std::vector<std::pair<typename TraitsT::Scalar, typename TraitsT::Scalar>>
+EclMaterialLawManager<TraitsT>::
+compactModifiedEps_() const
+{
+    auto eps = std::vector<std::pair<Scalar, Scalar>>{};
+    eps.reserve(compactMaterialLawParams_.size());
+    for (std::size_t paramsIdx = 0; paramsIdx < compactMaterialLawParams_.size(); ++paramsIdx) {
+        const auto& info = oilWaterScaledEpsInfoDrainage_[paramsIdx];
+        eps.emplace_back(info.Swl, info.maxPcow);
+    }
+
+    return eps;
+}
+
+template<class TraitsT>
+void EclMaterialLawManager<TraitsT>::
+setCompactModifiedEps_(const std::vector<std::pair<Scalar, Scalar>>& eps)
+{
+    if (eps.size() != compactMaterialLawParams_.size()) {
+        throw std::runtime_error("Serialized material law parameters do not match the grid");
+    }
+
+    for (std::size_t paramsIdx = 0; paramsIdx < eps.size(); ++paramsIdx) {
+        auto& info = oilWaterScaledEpsInfoDrainage_[paramsIdx];
+        if ((info.Swl == eps[paramsIdx].first) && (info.maxPcow == eps[paramsIdx].second)) {
+            continue;
+        }
+
+        info.Swl = eps[paramsIdx].first;
+        info.maxPcow = eps[paramsIdx].second;
+        oilWaterScaledEpsPointsDrainage_(compactMaterialLawParams_[paramsIdx])
+            .init(info, *oilWaterEclEpsConfig_, EclTwoPhaseSystemType::OilWater);
+    }
 }
 
 template<class TraitsT>
@@ -416,7 +596,15 @@ EclEpsScalingPoints<typename TraitsT::Scalar>&
 EclMaterialLawManager<TraitsT>::
 oilWaterScaledEpsPointsDrainage(unsigned elemIdx)
 {
-    auto& materialParams = materialLawParams_[elemIdx];
+    detachCompactParams_(elemIdx);
+    return oilWaterScaledEpsPointsDrainage_(materialLawParams(elemIdx));
+}
+
+template<class TraitsT>
+EclEpsScalingPoints<typename TraitsT::Scalar>&
+EclMaterialLawManager<TraitsT>::
+oilWaterScaledEpsPointsDrainage_(MaterialLawParams& materialParams) const
+{
     switch (materialParams.approach()) {
     case EclMultiplexerApproach::Stone1: {
         auto& realParams = materialParams.template getRealParams<EclMultiplexerApproach::Stone1>();
@@ -463,7 +651,7 @@ materialLawParamsFunc_(unsigned elemIdx, FaceDir::DirEnum facedir) const
         }
     }
     else {
-        return materialLawParams_[elemIdx];
+        return materialLawParams(elemIdx);
     }
 }
 
@@ -42,9 +42,15 @@
 #include <opm/material/fluidmatrixinteractions/DirectionalMaterialLawParams.hpp>
 
 #include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
 #include <functional>
+#include <map>
 #include <memory>
+#include <mutex>
 #include <tuple>
+#include <utility>
 #include <vector>
 
 namespace Opm {
@@ -170,8 +176,12 @@ private:
         void initThreePhaseParams_(
                                    HystParams &hystParams,
                                    MaterialLawParams& materialParams,
-                                   unsigned satRegionIdx,
-                                   unsigned elemIdx);
+                                   unsigned satRegionIdx);
+        // \brief Build the parameters of the main (non-directional) array
+        //        in compact mode, sharing one parameter object between all
+        //        cells with the same saturation region and scaled end points.
+        void runCompact_(const std::function<unsigned(unsigned)>& lookupIdxOnLevelZeroAssigner);
+        bool useCompactStorage_() const;
         void readEffectiveParameters_();
         void readUnscaledEpsPointsVectors_();
         template <class Container>
@@ -184,6 +194,8 @@ private:
         public:
             explicit HystParams(EclMaterialLawManager<TraitsT>::InitParams& init_params);
             void finalize();
+            const EclEpsScalingPointsInfo<Scalar>& oilWaterScaledInfo() const
+            { return oilWaterScaledInfo_; }
             std::shared_ptr<GasOilTwoPhaseHystParams> getGasOilParams();
             std::shared_ptr<OilWaterTwoPhaseHystParams> getOilWaterParams();
             std::shared_ptr<GasWaterTwoPhaseHystParams> getGasWaterParams();
@@ -225,6 +237,7 @@ private:
             std::shared_ptr<GasOilTwoPhaseHystParams> gasOilParams_;
             std::shared_ptr<OilWaterTwoPhaseHystParams> oilWaterParams_;
             std::shared_ptr<GasWaterTwoPhaseHystParams> gasWaterParams_;
+            EclEpsScalingPointsInfo<Scalar> oilWaterScaledInfo_{};
         };
 
         // This class' implementation is defined in "EclMaterialLawManagerReadEffectiveParams.cpp"
@@ -272,6 +285,39 @@ private:
 public:
     void initFromState(const EclipseState& eclState);
 
+    /*!
+     * \brief Request compact storage of the per-element material law parameters.
+     *
+     * Must be called before initParamsForElements().  In compact mode all
+     * elements which have the same saturation region and the same scaled end
+     * points share a single parameter object, and each element only stores an
+     * index into the pool of unique parameter objects.  This reduces the memory
+     * footprint considerably for models where the end points are not scaled per
+     * cell, or vary little between cells.
+     *
+     * Compact storage is only used when hysteresis is disabled and there are no
+     * directional relative permeabilities, since the parameter objects then hold
+     * per-element state.  The request is silently ignored otherwise.  Parameter
+     * objects returned by materialLawParams() are shared between elements in
+     * compact mode and must not be modified.
+     */
+    void setCompactParamStorage(bool enable)
+    { compactParamStorageRequested_ = enable; }
+
+    /*!
+     * \brief Whether or not the per-element parameters are stored in compact mode.
+     */
+    bool compactParamStorage() const
+    { return !compactParamsIdx_.empty(); }
+
+    /*!
+     * \brief Number of distinct material law parameter objects.
+     *
+     * Equals the number of elements unless compact storage is active.
+     */
+    std::size_t numMaterialLawParamObjects() const
+    { return compactParamStorage() ? compactMaterialLawParams_.size() : materialLawParams_.size(); }
+
     // \brief Function argument 'fieldPropIntOnLeadAssigner' needed to lookup
     //        field properties of cells on the leaf grid view for CpGrid with local grid refinement.
     //        Function argument 'lookupIdxOnLevelZeroAssigner' is added to lookup, for each
@@ -327,12 +373,22 @@ public:
 
     MaterialLawParams& materialLawParams(unsigned elemIdx)
     {
+        if (compactParamStorage()) {
+            assert(elemIdx < compactParamsIdx_.size());
+            return compactMaterialLawParams_[compactParamsIdx_[elemIdx]];
+        }
+
         assert(elemIdx <  materialLawParams_.size());
         return materialLawParams_[elemIdx];
     }
 
     const MaterialLawParams& materialLawParams(unsigned elemIdx) const
     {
+        if (compactParamStorage()) {
+            assert(elemIdx < compactParamsIdx_.size());
+            return compactMaterialLawParams_[compactParamsIdx_[elemIdx]];
+        }
+
         assert(elemIdx <  materialLawParams_.size());
         return materialLawParams_[elemIdx];
     }
@@ -419,7 +475,11 @@ public:
     EclEpsScalingPoints<Scalar>& oilWaterScaledEpsPointsDrainage(unsigned elemIdx);
 
     const EclEpsScalingPointsInfo<Scalar>& oilWaterScaledEpsInfoDrainage(size_t elemIdx) const
-    { return oilWaterScaledEpsInfoDrainage_[elemIdx]; }
+    {
+        return compactParamStorage()
+            ? oilWaterScaledEpsInfoDrainage_[compactParamsIdx_[elemIdx]]
+            : oilWaterScaledEpsInfoDrainage_[elemIdx];
+    }
 
     template<class Serializer>
     void serializeOp(Serializer& serializer)
@@ -431,11 +491,64 @@ public:
         for (auto& mat : materialLawParams_) {
             serializer(mat);
         }
+
+        if (compactParamStorage()) {
+            // Elements detached at run time own pool entries which the
+            // restarted run does not have, so the layout of the pool and the
+            // end points modified by SWATINIT are stored as well.
+            auto poolSize = compactMaterialLawParams_.size();
+            auto paramsIdx = compactParamsIdx_;
+            auto useCount = compactParamsUseCount_;
+            serializer(poolSize);
+            serializer(paramsIdx);
+            serializer(useCount);
+            if (!serializer.isSerializing()) {
+                resizeCompactParams_(poolSize, paramsIdx, useCount);
+            }
+
+            auto modifiedEps = compactModifiedEps_();
+            serializer(modifiedEps);
+            if (!serializer.isSerializing()) {
+                setCompactModifiedEps_(modifiedEps);
+            }
+
+            for (auto& mat : compactMaterialLawParams_) {
+                serializer(mat);
+            }
+        }
     }
 
 private:
     const MaterialLawParams& materialLawParamsFunc_(unsigned elemIdx, FaceDir::DirEnum facedir) const;
 
+    // Deep copy of a parameter object.  The copy constructor of
+    // EclMultiplexerMaterialParams does not copy the underlying parameters.
+    void copyMaterialLawParams_(const MaterialLawParams& src, MaterialLawParams& dest) const;
+
+    // Point the drainage curves of a parameter object to the tables of
+    // another saturation region.
+    void setSatRegionTables_(MaterialLawParams& mlp, unsigned satRegionIdx) const;
+
+    // Give an element its own parameter object in compact mode, so that it
+    // can be modified without affecting other elements.  Returns the index
+    // of the element's parameter object and end-point information.
+    std::size_t detachCompactParams_(unsigned elemIdx);
+
+    // Scaled oil-water drainage end points of a parameter object.
+    EclEpsScalingPoints<Scalar>& oilWaterScaledEpsPointsDrainage_(MaterialLawParams& params) const;
+
+    // Make the pool of compact mode match the layout of another run, when
+    // loading a serialized state.  Entries the other run has detached are
+    // created as copies of the elements' current entries.
+    void resizeCompactParams_(std::size_t poolSize,
+                              const std::vector<std::uint32_t>& paramsIdx,
+                              const std::vector<std::uint32_t>& useCount);
+
+    // The end points of the pool entries which SWATINIT and PPCWMAX may
+    // modify, as (Swl, maxPcow) pairs.
+    std::vector<std::pair<Scalar, Scalar>> compactModifiedEps_() const;
+    void setCompactModifiedEps_(const std::vector<std::pair<Scalar, Scalar>>& eps);
+
     void readGlobalEpsOptions_(const EclipseState& eclState);
 
     void readGlobalHysteresisOptions_(const EclipseState& state);
@@ -468,6 +581,19 @@ private:
     std::vector<MaterialLawParams> materialLawParams_;
     DirectionalMaterialLawParamsPtr dirMaterialLawParams_;
 
+    // Compact storage mode.  The pool is a deque since the parameter objects
+    // cannot be relocated (see copyMaterialLawParams_()) and may be appended
+    // to after initialisation when elements are detached.
+    bool compactParamStorageRequested_{false};
+    std::deque<MaterialLawParams> compactMaterialLawParams_;
+    std::vector<std::uint32_t> compactParamsIdx_;
+    std::vector<std::uint32_t> compactParamsUseCount_;
+
+    // Parameter objects handed out by connectionMaterialLawParams() in compact
+    // mode, keyed by saturation region and index into the pool.
+    mutable std::map<std::pair<unsigned, std::uint32_t>, MaterialLawParams> connectionMaterialLawParams_;
+    mutable std::mutex connectionMaterialLawParamsMutex_;
+
     std::vector<int> satnumRegionArray_;
     std::vector<int> krnumXArray_;
     std::vector<int> krnumYArray_;
@@ -143,11 +143,8 @@ setDrainageParamsOilWater(unsigned elemIdx, unsigned satRegionIdx,
     // Therefore, the below 7 lines should not be put inside the if(hasOilWater_){} below.
     auto [oilWaterScaledInfo, oilWaterScaledPoints]
         = readScaledEpsPointsDrainage_(elemIdx, EclTwoPhaseSystemType::OilWater, lookupIdxOnLevelZeroAssigner);
-    // TODO: This will reassign the same EclEpsScalingPointsInfo for each facedir
-    //  since we currently does not support facedir for the scaling points info
-    //  When such support is added, we need to extend the below vector which has info for each cell
-    //   to include three more vectors, one with info for each facedir of a cell
-    this->parent_.oilWaterScaledEpsInfoDrainage_[elemIdx] = oilWaterScaledInfo;
+    // The caller stores this in the parent's oilWaterScaledEpsInfoDrainage_.
+    this->oilWaterScaledInfo_ = oilWaterScaledInfo;
     if (hasOilWater_()) {
         OilWaterEpsTwoPhaseParams oilWaterDrainParams;
         oilWaterDrainParams.setConfig(this->parent_.oilWaterConfig_);
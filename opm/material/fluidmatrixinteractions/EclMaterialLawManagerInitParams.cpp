@@ -26,6 +26,51 @@
 #include <opm/material/fluidmatrixinteractions/EclMaterialLawManager.hpp>
 #include <opm/material/fluidmatrixinteractions/EclEpsGridProperties.hpp>
 
+#include <cstddef>
+#include <functional>
+#include <unordered_map>
+
+namespace {
+
+// Identifies a shareable parameter object in compact mode.  Without
+// hysteresis and directional relative permeabilities, the parameters of an
+// element are fully determined by its saturation region and its scaled
+// end points.
+template <class Scalar>
+struct CompactParamsKey
+{
+    unsigned satRegionIdx{};
+    Opm::EclEpsScalingPointsInfo<Scalar> info{};
+
+    bool operator==(const CompactParamsKey& that) const
+    {
+        return (this->satRegionIdx == that.satRegionIdx)
+            && (this->info == that.info);
+    }
+};
+
+template <class Scalar>
+struct CompactParamsKeyHash
+{
+    std::size_t operator()(const CompactParamsKey<Scalar>& key) const
+    {
+        const auto hashScalar = std::hash<Scalar>{};
+
+        auto seed = std::hash<unsigned>{}(key.satRegionIdx);
+        for (const auto& value : { key.info.Swl, key.info.Swcr, key.info.Swu,
+                                   key.info.Sgl, key.info.Sgcr, key.info.Sgu,
+                                   key.info.Sowcr, key.info.Sogcr,
+                                   key.info.maxPcow, key.info.maxPcgo })
+        {
+            seed ^= hashScalar(value) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+        }
+
+        return seed;
+    }
+};
+
+} // Anonymous namespace
+
 
 namespace Opm {
 
@@ -60,6 +105,13 @@ run(const std::function<std::vector<int>(const FieldPropsManager&, const std::st
     readEffectiveParameters_();
     initSatnumRegionArray_(fieldPropIntOnLeafAssigner);
     copySatnumArrays_(fieldPropIntOnLeafAssigner);
+    if (useCompactStorage_()) {
+        runCompact_(lookupIdxOnLevelZeroAssigner);
+        return;
+    }
+    this->parent_.compactMaterialLawParams_.clear();
+    this->parent_.compactParamsIdx_.clear();
+    this->parent_.compactParamsUseCount_.clear();
     initOilWaterScaledEpsInfo_();
     initMaterialLawParamVectors_();
     std::vector<std::vector<int>*> satnumArray;
@@ -76,6 +128,11 @@ run(const std::function<std::vector<int>(const FieldPropsManager&, const std::st
             hystParams.setDrainageParamsOilGas(elemIdx, satRegionIdx, lookupIdxOnLevelZeroAssigner);
             hystParams.setDrainageParamsOilWater(elemIdx, satRegionIdx, lookupIdxOnLevelZeroAssigner);
             hystParams.setDrainageParamsGasWater(elemIdx, satRegionIdx, lookupIdxOnLevelZeroAssigner);
+            // TODO: This will reassign the same EclEpsScalingPointsInfo for each facedir
+            //  since we currently does not support facedir for the scaling points info
+            //  When such support is added, we need to extend the below vector which has info for each cell
+            //   to include three more vectors, one with info for each facedir of a cell
+            this->parent_.oilWaterScaledEpsInfoDrainage_[elemIdx] = hystParams.oilWaterScaledInfo();
             if (this->parent_.enableHysteresis()) {
                 unsigned imbRegionIdx = imbRegion_(*imbnumArray[i], elemIdx);
                 hystParams.setImbibitionParamsOilGas(elemIdx, imbRegionIdx, lookupIdxOnLevelZeroAssigner);
@@ -83,11 +140,60 @@ run(const std::function<std::vector<int>(const FieldPropsManager&, const std::st
                 hystParams.setImbibitionParamsGasWater(elemIdx, imbRegionIdx, lookupIdxOnLevelZeroAssigner);
             }
             hystParams.finalize();
-            initThreePhaseParams_(hystParams, (*mlpArray[i])[elemIdx], satRegionIdx, elemIdx);
+            initThreePhaseParams_(hystParams, (*mlpArray[i])[elemIdx], satRegionIdx);
         }
     }
 }
 
+template <class Traits>
+void
+EclMaterialLawManager<Traits>::InitParams::
+runCompact_(const std::function<unsigned(unsigned)>& lookupIdxOnLevelZeroAssigner)
+{
+    auto& pool = this->parent_.compactMaterialLawParams_;
+    auto& paramsIdx = this->parent_.compactParamsIdx_;
+    auto& useCount = this->parent_.compactParamsUseCount_;
+    auto& scaledInfo = this->parent_.oilWaterScaledEpsInfoDrainage_;
+
+    pool.clear();
+    scaledInfo.clear();
+    useCount.clear();
+    paramsIdx.assign(this->numCompressedElems_, 0);
+
+    using Key = CompactParamsKey<Scalar>;
+    auto poolIndex = std::unordered_map<Key, std::uint32_t, CompactParamsKeyHash<Scalar>>{};
+
+    for (unsigned elemIdx = 0; elemIdx < this->numCompressedElems_; ++elemIdx) {
+        const unsigned satRegionIdx = satRegion_(this->parent_.satnumRegionArray_, elemIdx);
+
+        HystParams hystParams {*this};
+        hystParams.setConfig(satRegionIdx);
+        hystParams.setDrainageParamsOilGas(elemIdx, satRegionIdx, lookupIdxOnLevelZeroAssigner);
+        hystParams.setDrainageParamsOilWater(elemIdx, satRegionIdx, lookupIdxOnLevelZeroAssigner);
+        hystParams.setDrainageParamsGasWater(elemIdx, satRegionIdx, lookupIdxOnLevelZeroAssigner);
+
+        auto [pos, inserted] = poolIndex
+            .try_emplace(Key { satRegionIdx, hystParams.oilWaterScaledInfo() },
+                         static_cast<std::uint32_t>(pool.size()));
+
+        if (inserted) {
+            hystParams.finalize();
+            initThreePhaseParams_(hystParams, pool.emplace_back(), satRegionIdx);
+            scaledInfo.push_back(hystParams.oilWaterScaledInfo());
+            useCount.push_back(0);
+        }
+
+        paramsIdx[elemIdx] = pos->second;
+        ++useCount[pos->second];
+    }
+
+    // Release the per-element parameter storage of the regular mode.
+    this->parent_.materialLawParams_.clear();
+    this->parent_.materialLawParams_.shrink_to_fit();
+    scaledInfo.shrink_to_fit();
+    useCount.shrink_to_fit();
+}
+
 /* private methods alphabetically sorted*/
 
 template <class Traits>
@@ -200,10 +306,9 @@ void
 EclMaterialLawManager<Traits>::InitParams::
 initThreePhaseParams_(HystParams &hystParams,
                       MaterialLawParams& materialParams,
-                      unsigned satRegionIdx,
-                      unsigned elemIdx)
+                      unsigned satRegionIdx)
 {
-    const auto& epsInfo = this->parent_.oilWaterScaledEpsInfoDrainage_[elemIdx];
+    const auto& epsInfo = hystParams.oilWaterScaledInfo();
 
     auto oilWaterParams = hystParams.getOilWaterParams();
     auto gasOilParams = hystParams.getGasOilParams();
@@ -321,6 +426,17 @@ satRegion_(std::vector<int>& array, unsigned elemIdx)
     return satOrImbRegion_(array, default_vec, elemIdx);
 }
 
+template <class Traits>
+bool
+EclMaterialLawManager<Traits>::InitParams::
+useCompactStorage_() const
+{
+    return this->parent_.compactParamStorageRequested_
+        && !this->parent_.enableHysteresis()
+        && !this->parent_.hasDirectionalRelperms()
+        && !this->parent_.hasDirectionalImbnum();
+}
+
 template <class Traits>
 unsigned
 EclMaterialLawManager<Traits>::InitParams::
@@ -38,7 +38,10 @@
 #include <opm/material/fluidsystems/BaseFluidSystem.hpp>
 #include <opm/material/fluidsystems/PTFlashParameterCache.hpp> // TODO: this is something else need to check
 #include <opm/material/viscositymodels/LBC.hpp>
+#include <opm/material/viscositymodels/LBCComponentParams.hpp>
 
+#include <algorithm>
+#include <array>
 #include <cassert>
 #include <cstddef>
 #include <string>
@@ -123,6 +126,9 @@ namespace Opm {
             // Check if the current size is less than the maximum allowed components.
             if (component_param_.size() < numComponents) {
                 component_param_.push_back(param);
+                if (isConsistent()) {
+                    updateComponentConstants_();
+                }
             } else {
                 // Adding another component would exceed the limit.
                 const std::string msg = fmt::format("The fluid system has reached its maximum capacity of {} components,"
@@ -161,6 +167,7 @@ namespace Opm {
             }
             FluidSystem::printComponentParams();
             interaction_coefficients_ = comp_config.binaryInteractionCoefficient(0);
+            updateComponentConstants_();
 
             // Init. water pvt from deck
             waterPvt_->initFromState(eclState, schedule);
@@ -247,13 +254,16 @@ namespace Opm {
             assert(isConsistent());
             assert(comp1Idx < numComponents);
             assert(comp2Idx < numComponents);
-            if (interaction_coefficients_.empty() || comp2Idx == comp1Idx) {
-                return 0.0;
-            }
-            // make sure row is the bigger value compared to column number
-            const auto [column, row] = std::minmax(comp1Idx, comp2Idx);
-            const unsigned index = (row * (row - 1) / 2 + column); // it is the current understanding
-            return interaction_coefficients_[index];
+            return interaction_matrix_[comp1Idx][comp2Idx];
+        }
+
+        /*!
+         * \brief Per-component constants of the LBC viscosity model.
+         */
+        static const LBCComponentParams<Scalar, NumComp>& lbcComponentParams()
+        {
+            assert(isConsistent());
+            return lbc_params_;
         }
 
         //! \copydoc BaseFluidSystem::phaseName
@@ -445,8 +455,30 @@ namespace Opm {
             return component_param_.size() == NumComp;
         }
 
+        // Precompute the quantities which only depend on the component
+        // parameters once all components have been added.
+        static void updateComponentConstants_()
+        {
+            for (unsigned comp1Idx = 0; comp1Idx < numComponents; ++comp1Idx) {
+                for (unsigned comp2Idx = 0; comp2Idx < numComponents; ++comp2Idx) {
+                    Scalar coefficient = 0.0;
+                    if (!interaction_coefficients_.empty() && comp1Idx != comp2Idx) {
+                        // make sure row is the bigger value compared to column number
+                        const auto [column, row] = std::minmax(comp1Idx, comp2Idx);
+                        const unsigned index = (row * (row - 1) / 2 + column); // it is the current understanding
+                        coefficient = interaction_coefficients_[index];
+                    }
+                    interaction_matrix_[comp1Idx][comp2Idx] = coefficient;
+                }
+            }
+
+            lbc_params_.template update<GenericOilGasWaterFluidSystem<Scalar, NumComp, enableWater>>();
+        }
+
         static std::vector<ComponentParam> component_param_;
         static std::vector<Scalar> interaction_coefficients_;
+        static std::array<std::array<Scalar, NumComp>, NumComp> interaction_matrix_;
+        static LBCComponentParams<Scalar, NumComp> lbc_params_;
         static std::shared_ptr<WaterPvt> waterPvt_;
 
     public:
@@ -473,6 +505,14 @@ namespace Opm {
     std::vector<Scalar>
     GenericOilGasWaterFluidSystem<Scalar, NumComp, enableWater>::interaction_coefficients_;
     
+    template <class Scalar, int NumComp, bool enableWater>
+    std::array<std::array<Scalar, NumComp>, NumComp>
+    GenericOilGasWaterFluidSystem<Scalar, NumComp, enableWater>::interaction_matrix_{};
+
+    template <class Scalar, int NumComp, bool enableWater>
+    LBCComponentParams<Scalar, NumComp>
+    GenericOilGasWaterFluidSystem<Scalar, NumComp, enableWater>::lbc_params_{};
+
     template <class Scalar, int NumComp, bool enableWater>
     std::shared_ptr<WaterPvtMultiplexer<Scalar> > 
     GenericOilGasWaterFluidSystem<Scalar, NumComp, enableWater>::waterPvt_;
@@ -30,6 +30,8 @@
 #include <opm/input/eclipse/EclipseState/EclipseState.hpp>
 #include <opm/input/eclipse/EclipseState/Tables/TableManager.hpp>
 
+#include <algorithm>
+
 namespace Opm {
 
 template<class Scalar, class Params, class ContainerT>
@@ -147,6 +149,8 @@ initFromState(const EclipseState& eclState, const Schedule&)
             + "Pa) and the reference temperature (" +  std::to_string(T_ref) + "K)."
             + ezrokhi_msg
             );
+
+    updateSolubilityTable_();
 }
 #endif
 
@@ -177,9 +181,14 @@ setActivityModelSalt(int activityModel)
     switch (activityModel) {
     case 1:
     case 2:
-    case 3:  activityModel_ = activityModel; break;
+    case 3:  break;
     default: OPM_THROW(std::runtime_error, "The salt activity model options are 1, 2 or 3");
     }
+
+    if (activityModel != activityModel_) {
+        activityModel_ = activityModel;
+        updateSolubilityTable_();
+    }
 }
 
 template<class Scalar, class Params, class ContainerT>
@@ -200,6 +209,55 @@ setThermalMixingModel(int thermalMixingModelSalt, int thermalMixingModelLiquid)
     }
 }
 
+template<class Scalar, class Params, class ContainerT>
+void BrineCo2Pvt<Scalar, Params, ContainerT>::
+setTabulatedSolubility(bool yesno, const SolubilityTableRange& range)
+{
+    tabulateSolubility_ = yesno;
+    solubilityTableRange_ = range;
+    updateSolubilityTable_();
+}
+
+template<class Scalar, class Params, class ContainerT>
+void BrineCo2Pvt<Scalar, Params, ContainerT>::
+setTabulatedWater(bool yesno, const WaterTableRange& range)
+{
+    if (!yesno) {
+        waterTable_.clear();
+        return;
+    }
+
+    waterTable_.template init<H2O>(range);
+    const auto& bounds = waterTable_.errorBounds();
+    OpmLog::info("Tabulated water properties cover " + std::to_string(100*bounds.coverage)
+                 + "% of the range " + std::to_string(range.temperatureMin) + "-" + std::to_string(range.temperatureMax)
+                 + "K, " + std::to_string(range.pressureMin) + "-" + std::to_string(range.pressureMax) + "Pa."
+                 + "\n Largest relative deviations: density " + std::to_string(bounds.density)
+                 + ", enthalpy " + std::to_string(bounds.enthalpy)
+                 + ", viscosity " + std::to_string(bounds.viscosity));
+}
+
+template<class Scalar, class Params, class ContainerT>
+void BrineCo2Pvt<Scalar, Params, ContainerT>::
+updateSolubilityTable_()
+{
+    if (!tabulateSolubility_ || salinity_.empty()) {
+        solubilityTable_.reset();
+        return;
+    }
+
+    // Unless a salinity axis is given, tabulate at the region salinities.
+    auto range = solubilityTableRange_;
+    if (range.numSalinities == 0) {
+        const auto [minSalinity, maxSalinity] = std::minmax_element(salinity_.begin(), salinity_.end());
+        range.salinityMin = *minSalinity;
+        range.salinityMax = *maxSalinity;
+        range.numSalinities = (*minSalinity == *maxSalinity) ? 1 : 11;
+    }
+
+    solubilityTable_ = SolubilityTable::template shared<BinaryCoeffBrineCO2>(co2Tables_, activityModel_, range);
+}
+
 template<class Scalar, class Params, class ContainerT>
 void BrineCo2Pvt<Scalar, Params, ContainerT>::
 setEzrokhiDenCoeff(const std::vector<EzrokhiTable>& denaqa)
@@ -35,6 +35,7 @@
 #include <opm/material/Constants.hpp>
 
 #include <opm/material/components/BrineDynamic.hpp>
+#include <opm/material/components/H2OTable.hpp>
 #include <opm/material/components/SimpleHuDuanH2O.hpp>
 #include <opm/material/components/CO2.hpp>
 #include <opm/material/common/UniformTabulated2DFunction.hpp>
@@ -42,10 +43,12 @@
 #include <opm/material/components/CO2Tables.hpp>
 #include <opm/material/binarycoefficients/H2O_CO2.hpp>
 #include <opm/material/binarycoefficients/Brine_CO2.hpp>
+#include <opm/material/binarycoefficients/Brine_CO2SolubilityTable.hpp>
 
 #include <opm/input/eclipse/EclipseState/Co2StoreConfig.hpp>
 
 #include <cstddef>
+#include <memory>
 #include <vector>
 
 namespace Opm {
@@ -90,6 +93,10 @@ public:
 
     //! The binary coefficients for brine and CO2 used by this fluid system
     using BinaryCoeffBrineCO2 = BinaryCoeff::Brine_CO2<Scalar, H2O, CO2>;
+    using SolubilityTable = BinaryCoeff::Brine_CO2SolubilityTable<Scalar>;
+    using SolubilityTableRange = typename SolubilityTable::Range;
+    using WaterTable = H2OTable<Scalar>;
+    using WaterTableRange = typename WaterTable::Range;
 
     BrineCo2Pvt() = default;
 
@@ -166,6 +173,8 @@ public:
 
     /*!
     * \brief Set activity coefficient model for salt in solubility model
+    *
+    * A tabulated solubility is rebuilt for the new model.
     */
     void setActivityModelSalt(int activityModel);
 
@@ -174,6 +183,41 @@ public:
     */
     void setThermalMixingModel(int thermalMixingModelSalt, int thermalMixingModelLiquid);
 
+    /*!
+     * \brief Specify whether the solubility of CO2 in brine is interpolated in a
+     *        table instead of solving the solubility model for each query
+     *
+     * Tabulation trades accuracy for speed. The table is built from the current
+     * activity model and salinities, and rebuilt by initFromState(). It is shared
+     * with all other PVT objects, including Co2GasPvt, which tabulate the same
+     * range. States outside of the table, and evaluations on GPUs, use the
+     * solubility model. By default, the solubility model is used everywhere.
+     */
+    void setTabulatedSolubility(bool yesno, const SolubilityTableRange& range = {});
+
+    bool tabulatedSolubility() const
+    { return tabulateSolubility_; }
+
+    /*!
+     * \brief Specify whether the density, enthalpy and viscosity of pure water
+     *        are interpolated in a table instead of evaluating the water model
+     *
+     * The deviations of the table from the water model are reported when it is
+     * built. States outside of the table, and evaluations on GPUs, use the water
+     * model. By default, the water model is used everywhere.
+     */
+    void setTabulatedWater(bool yesno, const WaterTableRange& range = {});
+
+    bool tabulatedWater() const
+    { return !waterTable_.empty(); }
+
+    /*!
+     * \brief Deviations of the water table from the water model, and the
+     *        fraction of the table where it is used.
+     */
+    const typename WaterTable::ErrorBounds& tabulatedWaterErrorBounds() const
+    { return waterTable_.errorBounds(); }
+
     void setEzrokhiDenCoeff(const std::vector<EzrokhiTable>& denaqa);
 
     void setEzrokhiViscCoeff(const std::vector<EzrokhiTable>& viscaqa);
@@ -250,7 +294,7 @@ public:
         OPM_TIMEFUNCTION_LOCAL();
         const Evaluation salinity = salinityFromConcentration(regionIdx, temperature, pressure, saltConcentration);
         if (enableEzrokhiViscosity_) {
-            const Evaluation& mu_pure = H2O::liquidViscosity(temperature, pressure, extrapolate);
+            const Evaluation& mu_pure = waterViscosity_(temperature, pressure);
             const Evaluation& nacl_exponent = ezrokhiExponent_(temperature, ezrokhiViscNaClCoeff_);
             return mu_pure * pow(10.0, nacl_exponent * salinity);
         }
@@ -284,7 +328,7 @@ public:
     {
         OPM_TIMEFUNCTION_LOCAL();
         if (enableEzrokhiViscosity_) {
-            const Evaluation& mu_pure = H2O::liquidViscosity(temperature, pressure, extrapolate);
+            const Evaluation& mu_pure = waterViscosity_(temperature, pressure);
             const Evaluation& nacl_exponent = ezrokhiExponent_(temperature, ezrokhiViscNaClCoeff_);
             return mu_pure * pow(10.0, nacl_exponent * Evaluation(salinity_[regionIdx]));
         }
@@ -484,7 +528,7 @@ public:
         // (Ratcliff and Holdcroft,1963 and Al-Rawajfeh, 2004)
 
         // Water viscosity
-        const Evaluation& mu_H20 = H2O::liquidViscosity(temperature, pressure, extrapolate);
+        const Evaluation& mu_H20 = waterViscosity_(temperature, pressure);
         Evaluation mu_Brine;
         if (enableEzrokhiViscosity_) {
             const Evaluation& nacl_exponent = ezrokhiExponent_(temperature,
@@ -531,17 +575,25 @@ public:
 
         // calulate the equilibrium composition for the given
         // temperature and pressure.
-        Evaluation xgH2O;
         Evaluation xlCO2;
-        BinaryCoeffBrineCO2::calculateMoleFractions(co2Tables_,
-                                                    temperature,
-                                                    pressure,
-                                                    salinity,
-                                                    /*knownPhaseIdx=*/-1,
-                                                    xlCO2,
-                                                    xgH2O,
-                                                    activityModel_,
-                                                    extrapolate);
+#if !OPM_IS_INSIDE_DEVICE_FUNCTION
+        if (solubilityTable_ && solubilityTable_->applies(temperature, pressure, salinity)) {
+            xlCO2 = solubilityTable_->liquidMoleFractionCO2(temperature, pressure, salinity);
+        }
+        else
+#endif
+        {
+            Evaluation xgH2O;
+            BinaryCoeffBrineCO2::calculateMoleFractions(co2Tables_,
+                                                        temperature,
+                                                        pressure,
+                                                        salinity,
+                                                        /*knownPhaseIdx=*/-1,
+                                                        xlCO2,
+                                                        xgH2O,
+                                                        activityModel_,
+                                                        extrapolate);
+        }
 
         // normalize the phase compositions
         xlCO2 = max(0.0, min(1.0, xlCO2));
@@ -550,6 +602,46 @@ public:
     }
 
 private:
+    void updateSolubilityTable_();
+
+    // Properties of pure water, from the table where it applies.
+    template <class LhsEval>
+    OPM_HOST_DEVICE LhsEval waterDensity_(const LhsEval& temperature,
+                                          const LhsEval& pressure,
+                                          bool extrapolateModel = extrapolate) const
+    {
+#if !OPM_IS_INSIDE_DEVICE_FUNCTION
+        if (waterTable_.applies(temperature, pressure)) {
+            return waterTable_.liquidDensity(temperature, pressure);
+        }
+#endif
+        return H2O::liquidDensity(temperature, pressure, extrapolateModel);
+    }
+
+    template <class LhsEval>
+    OPM_HOST_DEVICE LhsEval waterEnthalpy_(const LhsEval& temperature,
+                                           const LhsEval& pressure) const
+    {
+#if !OPM_IS_INSIDE_DEVICE_FUNCTION
+        if (waterTable_.applies(temperature, pressure)) {
+            return waterTable_.liquidEnthalpy(temperature, pressure);
+        }
+#endif
+        return H2O::liquidEnthalpy(temperature, pressure);
+    }
+
+    template <class LhsEval>
+    OPM_HOST_DEVICE LhsEval waterViscosity_(const LhsEval& temperature,
+                                            const LhsEval& pressure) const
+    {
+#if !OPM_IS_INSIDE_DEVICE_FUNCTION
+        if (waterTable_.applies(temperature, pressure)) {
+            return waterTable_.liquidViscosity(temperature, pressure);
+        }
+#endif
+        return H2O::liquidViscosity(temperature, pressure, extrapolate);
+    }
+
     template <class LhsEval>
     OPM_HOST_DEVICE LhsEval ezrokhiExponent_(const LhsEval& temperature,
                              const ContainerT& ezrokhiCoeff) const
@@ -592,7 +684,7 @@ private:
 #endif
         }
 
-        const LhsEval& rho_pure = H2O::liquidDensity(T, pl, extrapolate);
+        const LhsEval& rho_pure = waterDensity_(T, pl);
         if (enableEzrokhiDensity_) {
             const LhsEval& nacl_exponent = ezrokhiExponent_(T, ezrokhiDenNaClCoeff_);
             const LhsEval& co2_exponent = ezrokhiExponent_(T, ezrokhiDenCo2Coeff_);
@@ -600,8 +692,8 @@ private:
             return rho_pure * pow(10.0, nacl_exponent * salinity + co2_exponent * XCO2);
         }
         else {
-            const LhsEval& rho_brine = Brine::liquidDensity(T, pl, salinity, extrapolate);
-            const LhsEval& rho_lCO2 = liquidDensityWaterCO2_(T, pl, xlCO2);
+            const LhsEval& rho_brine = Brine::liquidDensityFromWater(T, pl, salinity, rho_pure);
+            const LhsEval& rho_lCO2 = liquidDensityWaterCO2_(T, pl, xlCO2, rho_pure);
             const LhsEval& contribCO2 = rho_lCO2 - rho_pure;
             return rho_brine + contribCO2;
         }
@@ -610,14 +702,14 @@ private:
     template <class LhsEval>
     OPM_HOST_DEVICE LhsEval liquidDensityWaterCO2_(const LhsEval& temperature,
                                           const LhsEval& pl,
-                                          const LhsEval& xlCO2) const
+                                          const LhsEval& xlCO2,
+                                          const LhsEval& rho_pure) const
     {
         OPM_TIMEFUNCTION_LOCAL();
         Scalar M_CO2 = CO2::molarMass();
         Scalar M_H2O = H2O::molarMass();
 
         const LhsEval& tempC = temperature - 273.15;        /* tempC : temperature in °C */
-        const LhsEval& rho_pure = H2O::liquidDensity(temperature, pl, extrapolate);
         // calculate the mole fraction of CO2 in the liquid. note that xlH2O is available
         // as a function parameter, but in the case of a pure gas phase the value of M_T
         // for the virtual liquid phase can become very large
@@ -693,10 +785,10 @@ private:
         if (liquidMixType_ == Co2StoreConfig::LiquidMixingType::NONE 
             && saltMixType_ == Co2StoreConfig::SaltMixingType::NONE)
         {
-            return H2O::liquidEnthalpy(T, p);
+            return waterEnthalpy_(T, p);
         }
 
-        LhsEval hw = H2O::liquidEnthalpy(T, p) /1E3; /* kJ/kg */
+        LhsEval hw = waterEnthalpy_(T, p) /1E3; /* kJ/kg */
         LhsEval h_ls1 = hw;
         // Use mixing model for salt by MICHAELIDES
         if (saltMixType_ == Co2StoreConfig::SaltMixingType::MICHAELIDES) {
@@ -780,7 +872,7 @@ private:
                                             const LhsEval& saltConcentration) const
     {
         if (enableSaltConcentration_) {
-            return saltConcentration/H2O::liquidDensity(T, P, true);
+            return saltConcentration/waterDensity_(T, P, /*extrapolateModel=*/true);
         }
 
         return salinity(regionIdx);
@@ -804,6 +896,12 @@ private:
     Co2StoreConfig::LiquidMixingType liquidMixType_{};
     Co2StoreConfig::SaltMixingType saltMixType_{};
     Params co2Tables_;
+
+    // Host only, GPU copies always use the solubility model.
+    bool tabulateSolubility_ = false;
+    SolubilityTableRange solubilityTableRange_{};
+    std::shared_ptr<const SolubilityTable> solubilityTable_{};
+    WaterTable waterTable_{};
 };
 
 } // namespace Opm
@@ -31,6 +31,8 @@
 #include <opm/input/eclipse/EclipseState/EclipseState.hpp>
 #include <opm/input/eclipse/EclipseState/Tables/TableManager.hpp>
 
+#include <algorithm>
+
 namespace Opm {
 
 template<class Scalar, class Params, class ContainerT>
@@ -106,6 +108,7 @@ initFromState(const EclipseState& eclState, const Schedule&)
         gasReferenceDensity_[regionIdx] = CO2::gasDensity(co2Tables, T_ref, P_ref, extrapolate);
     }
 
+    updateSolubilityTable_();
     initEnd();
 }
 #endif
@@ -137,12 +140,19 @@ setActivityModelSalt(int activityModel)
     switch (activityModel) {
     case 1:
     case 2:
-    case 3: activityModel_ = activityModel; break;
+    case 3: break;
     default:
 #if OPM_IS_INSIDE_DEVICE_FUNCTION
         assert(false && "The salt activity model options are 1, 2 or 3");
 #else
         OPM_THROW(std::runtime_error, "The salt activity model options are 1, 2 or 3");
+#endif
+    }
+
+    if (activityModel != activityModel_) {
+        activityModel_ = activityModel;
+#if !OPM_IS_INSIDE_DEVICE_FUNCTION
+        updateSolubilityTable_();
 #endif
     }
 }
@@ -165,6 +175,36 @@ setThermalMixingModel(int thermalMixingModel)
     }
 }
 
+template<class Scalar, class Params, class ContainerT>
+void Co2GasPvt<Scalar, Params, ContainerT>::
+setTabulatedSolubility(bool yesno, const SolubilityTableRange& range)
+{
+    tabulateSolubility_ = yesno;
+    solubilityTableRange_ = range;
+    updateSolubilityTable_();
+}
+
+template<class Scalar, class Params, class ContainerT>
+void Co2GasPvt<Scalar, Params, ContainerT>::
+updateSolubilityTable_()
+{
+    if (!tabulateSolubility_ || salinity_.empty()) {
+        solubilityTable_.reset();
+        return;
+    }
+
+    // Unless a salinity axis is given, tabulate at the region salinities.
+    auto range = solubilityTableRange_;
+    if (range.numSalinities == 0) {
+        const auto [minSalinity, maxSalinity] = std::minmax_element(salinity_.begin(), salinity_.end());
+        range.salinityMin = *minSalinity;
+        range.salinityMax = *maxSalinity;
+        range.numSalinities = (*minSalinity == *maxSalinity) ? 1 : 11;
+    }
+
+    solubilityTable_ = SolubilityTable::template shared<BinaryCoeffBrineCO2>(co2Tables, activityModel_, range);
+}
+
 template<class Scalar, class Params, class ContainerT>
 void Co2GasPvt<Scalar, Params, ContainerT>::
 setEzrokhiDenCoeff(const std::vector<EzrokhiTable>& denaqa)
@@ -37,12 +37,14 @@
 #include <opm/material/components/SimpleHuDuanH2O.hpp>
 #include <opm/material/common/UniformTabulated2DFunction.hpp>
 #include <opm/material/binarycoefficients/Brine_CO2.hpp>
+#include <opm/material/binarycoefficients/Brine_CO2SolubilityTable.hpp>
 #include <opm/input/eclipse/EclipseState/Co2StoreConfig.hpp>
 #include <opm/material/components/CO2Tables.hpp>
 #include <opm/input/eclipse/EclipseState/EclipseState.hpp>
 #include <opm/input/eclipse/EclipseState/Tables/TableManager.hpp>
 
 #include <cstddef>
+#include <memory>
 #include <vector>
 
 namespace Opm {
@@ -78,6 +80,8 @@ class Co2GasPvt
 public:
     //! The binary coefficients for brine and CO2 used by this fluid system
     using BinaryCoeffBrineCO2 = BinaryCoeff::Brine_CO2<Scalar, H2O, CO2>;
+    using SolubilityTable = BinaryCoeff::Brine_CO2SolubilityTable<Scalar>;
+    using SolubilityTableRange = typename SolubilityTable::Range;
 
     Co2GasPvt() = default;
 
@@ -136,9 +140,23 @@ public:
 
     /*!
     * \brief Set activity coefficient model for salt in solubility model
+    *
+    * A tabulated solubility is rebuilt for the new model.
     */
     OPM_HOST_DEVICE void setActivityModelSalt(int activityModel);
 
+    /*!
+     * \brief Specify whether the solubility of water in the gas phase is
+     *        interpolated in a table instead of solving the solubility model for
+     *        each query
+     *
+     * \copydetails BrineCo2Pvt::setTabulatedSolubility()
+     */
+    void setTabulatedSolubility(bool yesno, const SolubilityTableRange& range = {});
+
+    bool tabulatedSolubility() const
+    { return tabulateSolubility_; }
+
    /*!
     * \brief Set thermal mixing model for co2 in brine
     */
@@ -361,6 +379,8 @@ public:
     { return co2Tables; }
 
 private:
+    void updateSolubilityTable_();
+
     template <class LhsEval>
     LhsEval ezrokhiExponent_(const LhsEval& temperature,
                              const ContainerT& ezrokhiCoeff) const
@@ -383,16 +403,24 @@ private:
         // calulate the equilibrium composition for the given
         // temperature and pressure.
         LhsEval xgH2O;
-        LhsEval xlCO2;
-        BinaryCoeffBrineCO2::calculateMoleFractions(co2Tables,
-                                                    temperature,
-                                                    pressure,
-                                                    salinity,
-                                                    /*knownPhaseIdx=*/-1,
-                                                    xlCO2,
-                                                    xgH2O,
-                                                    activityModel_,
-                                                    extrapolate);
+#if !OPM_IS_INSIDE_DEVICE_FUNCTION
+        if (solubilityTable_ && solubilityTable_->applies(temperature, pressure, salinity)) {
+            xgH2O = solubilityTable_->gasMoleFractionH2O(temperature, pressure, salinity);
+        }
+        else
+#endif
+        {
+            LhsEval xlCO2;
+            BinaryCoeffBrineCO2::calculateMoleFractions(co2Tables,
+                                                        temperature,
+                                                        pressure,
+                                                        salinity,
+                                                        /*knownPhaseIdx=*/-1,
+                                                        xlCO2,
+                                                        xgH2O,
+                                                        activityModel_,
+                                                        extrapolate);
+        }
 
         // normalize the phase compositions
         xgH2O = max(0.0, min(1.0, xgH2O));
@@ -459,6 +487,11 @@ private:
     int activityModel_{};
     Co2StoreConfig::GasMixingType gastype_{};
     Params co2Tables;
+
+    // Host only, GPU copies always use the solubility model.
+    bool tabulateSolubility_ = false;
+    SolubilityTableRange solubilityTableRange_{};
+    std::shared_ptr<const SolubilityTable> solubilityTable_{};
 };
 
 } // namespace Opm
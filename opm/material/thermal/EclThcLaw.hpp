@@ -55,6 +55,13 @@ public:
     template <class FluidState, class Evaluation = typename FluidState::Scalar>
     static Evaluation thermalConductivity(const Params& params,
                                           const FluidState&)
+    { return thermalConductivity(params); }
+
+    /*!
+     * \brief Return the total thermal conductivity [W/m^2 / (K/m)] of the porous
+     *        medium, which does not depend on the state of the fluids.
+     */
+    static Scalar thermalConductivity(const Params& params)
     {
         // The thermal conductivity approach based on the THC* keywords.
 
@@ -130,6 +130,8 @@ initHeatcr_(const EclipseState& eclState, size_t numElems,
     const std::vector<double>& heatcrData = fieldPropsDoubleOnLeafAssigner(eclState.fieldProps(), "HEATCR");
     const std::vector<double>& heatcrtData = fieldPropsDoubleOnLeafAssigner(eclState.fieldProps(), "HEATCRT");
     solidEnergyLawParams_.resize(numElems);
+    rockHeatCapacity_.resize(numElems);
+    dRockHeatCapacity_dT_.resize(numElems);
     for (unsigned elemIdx = 0; elemIdx < numElems; ++elemIdx) {
         auto& elemParam = solidEnergyLawParams_[elemIdx];
         elemParam.setSolidEnergyApproach(EclSolidEnergyApproach::Heatcr);
@@ -139,6 +141,9 @@ initHeatcr_(const EclipseState& eclState, size_t numElems,
         heatcrElemParams.setDRockHeatCapacity_dT(heatcrtData[elemIdx]);
         heatcrElemParams.finalize();
         elemParam.finalize();
+
+        rockHeatCapacity_[elemIdx] = heatcrElemParams.referenceRockHeatCapacity();
+        dRockHeatCapacity_dT_[elemIdx] = heatcrElemParams.dRockHeatCapacity_dT();
     }
 }
 
@@ -201,6 +206,8 @@ initThconr_(const EclipseState& eclState, size_t numElems,
         thconsfData =  fieldPropsDoubleOnLeafAssigner(fp, "THCONSF");
 
     thermalConductionLawParams_.resize(numElems);
+    totalThermalConductivity_.resize(numElems);
+    dTotalThermalConductivity_dSg_.resize(numElems);
     for (unsigned elemIdx = 0; elemIdx < numElems; ++elemIdx) {
         auto& elemParams = thermalConductionLawParams_[elemIdx];
         elemParams.setThermalConductionApproach(EclThermalConductionApproach::Thconr);
@@ -213,6 +220,9 @@ initThconr_(const EclipseState& eclState, size_t numElems,
 
         thconrElemParams.finalize();
         elemParams.finalize();
+
+        totalThermalConductivity_[elemIdx] = thconrElemParams.referenceTotalThermalConductivity();
+        dTotalThermalConductivity_dSg_[elemIdx] = thconrElemParams.dTotalThermalConductivity_dSg();
     }
 }
 
@@ -244,6 +254,7 @@ initThc_(const EclipseState& eclState, size_t numElems,
     const std::vector<double>& poroData = fieldPropsDoubleOnLeafAssigner(fp, "PORO");
 
     thermalConductionLawParams_.resize(numElems);
+    totalThermalConductivity_.resize(numElems);
     for (unsigned elemIdx = 0; elemIdx < numElems; ++elemIdx) {
         auto& elemParams = thermalConductionLawParams_[elemIdx];
         elemParams.setThermalConductionApproach(EclThermalConductionApproach::Thc);
@@ -261,6 +272,10 @@ initThc_(const EclipseState& eclState, size_t numElems,
 
         thcElemParams.finalize();
         elemParams.finalize();
+
+        // The conductivity does not depend on the fluids, so it is evaluated once.
+        totalThermalConductivity_[elemIdx] =
+            EclThcLaw<Scalar, typename ThermalConductionLawParams::ThcLawParams>::thermalConductivity(thcElemParams);
     }
 }
 
@@ -37,7 +37,12 @@
 #include "EclThermalConductionLawMultiplexer.hpp"
 #include "EclThermalConductionLawMultiplexerParams.hpp"
 
+#include <opm/common/ErrorMacros.hpp>
+
+#include <cassert>
+#include <cstddef>
 #include <functional>
+#include <stdexcept>
 #include <vector>
 
 namespace Opm {
@@ -73,6 +78,38 @@ public:
 
     const ThermalConductionLawParams& thermalConductionLawParams(unsigned elemIdx) const;
 
+    /*!
+     * \brief Compute the volumetric internal energy of the rock [J/m^3] of the
+     *        elements [firstElemIdx, firstElemIdx + n).
+     *
+     * This gives the same results as SolidEnergyLaw::solidInternalEnergy() for
+     * each element, but the approach is resolved once for the range, and the
+     * parameters are read from arrays of the whole grid instead of the parameter
+     * object of each element.
+     *
+     * \param temperature The temperatures of the elements [K]
+     * \param energy The volumetric internal energies of the elements
+     */
+    template <class Evaluation>
+    void solidInternalEnergies(unsigned firstElemIdx, std::size_t n,
+                               const Evaluation* temperature,
+                               Evaluation* energy) const;
+
+    /*!
+     * \brief Compute the total thermal conductivity [W/m^2 / (K/m)] of the
+     *        elements [firstElemIdx, firstElemIdx + n).
+     *
+     * This is the batched counterpart of ThermalConductionLaw::thermalConductivity().
+     *
+     * \param gasSaturation The gas saturations of the elements. Only used for
+     *                      THCONR if the gas phase is active, may be null otherwise.
+     * \param conductivity The total thermal conductivities of the elements
+     */
+    template <class Evaluation>
+    void thermalConductivities(unsigned firstElemIdx, std::size_t n,
+                               const Evaluation* gasSaturation,
+                               Evaluation* conductivity) const;
+
 private:
     /*!
      * \brief Initialize the parameters for the solid energy law using using HEATCR and friends.
@@ -120,7 +157,111 @@ private:
 
     std::vector<SolidEnergyLawParams> solidEnergyLawParams_;
     std::vector<ThermalConductionLawParams> thermalConductionLawParams_;
+
+    // Parameters of all elements for the batched evaluation, depending on the
+    // approach. SPECROCK uses the tables of the SATNUM regions above.
+    std::vector<Scalar> rockHeatCapacity_; // HEATCR
+    std::vector<Scalar> dRockHeatCapacity_dT_; // HEATCRT
+    std::vector<Scalar> totalThermalConductivity_; // THCONR, or the average of THC*
+    std::vector<Scalar> dTotalThermalConductivity_dSg_; // THCONSF
 };
+
+template <class Scalar, class FluidSystem>
+template <class Evaluation>
+void EclThermalLawManager<Scalar, FluidSystem>::
+solidInternalEnergies(unsigned firstElemIdx, std::size_t n,
+                      const Evaluation* temperature,
+                      Evaluation* energy) const
+{
+    switch (solidEnergyApproach_) {
+    case EclSolidEnergyApproach::Heatcr:
+    {
+        assert(firstElemIdx + n <= rockHeatCapacity_.size());
+        const Scalar referenceTemperature = HeatcrLawParams::referenceTemperature();
+        const Scalar* C0 = rockHeatCapacity_.data() + firstElemIdx;
+        const Scalar* C1 = dRockHeatCapacity_dT_.data() + firstElemIdx;
+        for (std::size_t i = 0; i < n; ++i) {
+            const Evaluation deltaT = temperature[i] - referenceTemperature;
+            energy[i] = deltaT*(C0[i] + deltaT*C1[i] / 2.0);
+        }
+        return;
+    }
+
+    case EclSolidEnergyApproach::Specrock:
+    {
+        assert(firstElemIdx + n <= elemToSatnumIdx_.size());
+        const unsigned* satnumIdx = elemToSatnumIdx_.data() + firstElemIdx;
+        for (std::size_t i = 0; i < n; ++i) {
+            const auto& specrockParams =
+                solidEnergyLawParams_[satnumIdx[i]].template getRealParams<EclSolidEnergyApproach::Specrock>();
+            energy[i] = specrockParams.internalEnergyFunction().eval(temperature[i], /*extrapolate=*/true);
+        }
+        return;
+    }
+
+    case EclSolidEnergyApproach::Null:
+        for (std::size_t i = 0; i < n; ++i) {
+            energy[i] = 0.0;
+        }
+        return;
+
+    default:
+        OPM_THROW(std::runtime_error,
+                  "Attempting to evaluate the solid energy storage "
+                  "without a known approach being defined by the deck.");
+    }
+}
+
+template <class Scalar, class FluidSystem>
+template <class Evaluation>
+void EclThermalLawManager<Scalar, FluidSystem>::
+thermalConductivities(unsigned firstElemIdx, std::size_t n,
+                      const Evaluation* gasSaturation,
+                      Evaluation* conductivity) const
+{
+    switch (thermalConductivityApproach_) {
+    case EclThermalConductionApproach::Thconr:
+    {
+        assert(firstElemIdx + n <= totalThermalConductivity_.size());
+        const Scalar* lambdaRef = totalThermalConductivity_.data() + firstElemIdx;
+        if (FluidSystem::phaseIsActive(FluidSystem::gasPhaseIdx)) {
+            assert(gasSaturation != nullptr);
+            const Scalar* alpha = dTotalThermalConductivity_dSg_.data() + firstElemIdx;
+            for (std::size_t i = 0; i < n; ++i) {
+                conductivity[i] = lambdaRef[i]*(1.0 - alpha[i]*gasSaturation[i]);
+            }
+        }
+        else {
+            for (std::size_t i = 0; i < n; ++i) {
+                conductivity[i] = lambdaRef[i];
+            }
+        }
+        return;
+    }
+
+    case EclThermalConductionApproach::Thc:
+    {
+        assert(firstElemIdx + n <= totalThermalConductivity_.size());
+        const Scalar* lambda = totalThermalConductivity_.data() + firstElemIdx;
+        for (std::size_t i = 0; i < n; ++i) {
+            conductivity[i] = lambda[i];
+        }
+        return;
+    }
+
+    case EclThermalConductionApproach::Null:
+        for (std::size_t i = 0; i < n; ++i) {
+            conductivity[i] = 0.0;
+        }
+        return;
+
+    default:
+        OPM_THROW(std::runtime_error,
+                  "Attempting to evaluate the thermal conduction "
+                  "without a known approach being defined by the deck.");
+    }
+}
+
 } // namespace Opm
 
 #endif
@@ -30,8 +30,9 @@
 #ifndef LBC_HPP
 #define LBC_HPP
 
+#include <opm/material/viscositymodels/LBCComponentParams.hpp>
+
 #include <cmath>
-#include <vector>
 
 namespace Opm
 {
@@ -48,75 +49,63 @@ public:
                       const Params& /*paramCache*/,
                       unsigned phaseIdx)
     {
-        const Scalar MPa_atm = 0.101325;
+        return visitLBCComponentParams<Scalar, FluidSystem>([&](const auto& compParams)
+        {
+            return LBC_<LhsEval>(fluidState, compParams, phaseIdx);
+        });
+    }
+
+private:
+    template <class LhsEval, class FluidState, class ComponentParams>
+    static LhsEval LBC_(const FluidState& fluidState,
+                        const ComponentParams& compParams,
+                        unsigned phaseIdx)
+    {
         const Scalar R = Opm::Constants<Scalar>::R;
         const auto& T = Opm::decay<LhsEval>(fluidState.temperature(phaseIdx));
         const auto& P = Opm::decay<LhsEval>(fluidState.pressure(phaseIdx));
         const auto& Z = Opm::decay<LhsEval>(fluidState.compressFactor(phaseIdx));
 
         LhsEval sumVolume = 0.0;
-        for (unsigned compIdx = 0; compIdx < FluidSystem::numComponents; ++compIdx) {
-            const auto& x = Opm::decay<LhsEval>(fluidState.moleFraction(phaseIdx, compIdx));
-            const Scalar v_c = FluidSystem::criticalVolume(compIdx) / 1000;  // converting to m3/mol from m3/kmol
-            sumVolume += x*v_c;
-        }
-
-        LhsEval rho_pc = 1.0 / sumVolume;
-        LhsEval V = (R * T * Z)/P;
-        LhsEval rho = 1.0 / V;
-        LhsEval rho_r = rho / rho_pc;
-
         LhsEval xsum_T_c = 0.0; // mixture pseudocritical temperature
         LhsEval xsum_Mm = 0.0; // mixture molar mass
         LhsEval xsum_p_ca = 0.0;  // mixture pseudocritical pressure
-        for (unsigned compIdx = 0; compIdx < FluidSystem::numComponents; ++compIdx) {
-            const Scalar& p_c = FluidSystem::criticalPressure(compIdx) / 1e6; // converting to Mpa from pascal
-            const Scalar& T_c = FluidSystem::criticalTemperature(compIdx);
-            const Scalar Mm = FluidSystem::molarMass(compIdx) * 1000; // converting to kg/kmol from kg/mol;
-            const auto& x = Opm::decay<LhsEval>(fluidState.moleFraction(phaseIdx, compIdx));
-            Scalar p_ca = p_c / MPa_atm;
-            xsum_T_c += x * T_c;
-            xsum_Mm += x * Mm;
-            xsum_p_ca += x * p_ca;
-        }
-        LhsEval zeta_tot = Opm::pow(xsum_T_c / (Opm::pow(xsum_Mm,3.0) * Opm::pow(xsum_p_ca,4.0)),1./6);
-
         LhsEval my0 = 0.0;
         LhsEval sumxrM = 0.0;
         for (unsigned compIdx = 0; compIdx < FluidSystem::numComponents; ++compIdx) {
-            const Scalar& p_c = FluidSystem::criticalPressure(compIdx) / 1e6; // converting to Mpa from pa;
-            const Scalar& T_c = FluidSystem::criticalTemperature(compIdx);
-            const Scalar Mm = FluidSystem::molarMass(compIdx) * 1000; // converting to kg/kmol from kg/mol;
             const auto& x = Opm::decay<LhsEval>(fluidState.moleFraction(phaseIdx, compIdx));
-            Scalar p_ca = p_c / MPa_atm;
-            Scalar zeta = std::pow(T_c / (std::pow(Mm,3.0) * std::pow(p_ca,4.0)),1./6);
+            const Scalar T_c = compParams.criticalTemperature[compIdx];
+            sumVolume += x*compParams.criticalVolume[compIdx];
+            xsum_T_c += x * T_c;
+            xsum_Mm += x * compParams.molarMass[compIdx];
+            xsum_p_ca += x * compParams.criticalPressure[compIdx];
+
             LhsEval T_r = T/T_c;
-            LhsEval xrM = x * std::pow(Mm,0.5);
+            LhsEval xrM = x * compParams.sqrtMolarMass[compIdx];
             LhsEval mys = 0.0;
             if (T_r <= 1.5) {
-                mys = 34.0e-5*Opm::pow(T_r,0.94)/zeta;
+                mys = 34.0e-5*Opm::pow(T_r,0.94)*compParams.invZeta[compIdx];
             } else {
-                mys = 17.78e-5*Opm::pow(4.58*T_r - 1.67, 0.625)/zeta;
+                mys = 17.78e-5*Opm::pow(4.58*T_r - 1.67, 0.625)*compParams.invZeta[compIdx];
             }
             my0 += xrM*mys;
             sumxrM += xrM;
         }
         my0 /= sumxrM;
 
-        std::vector<Scalar> LBC = {0.10230,
-                                   0.023364,
-                                   0.058533,
-                                   -0.040758,  // typo in 1964-paper: -0.40758
-                                   0.0093324};
+        LhsEval rho_pc = 1000.0 / sumVolume; // converting to mol/m3 from kmol/m3
+        LhsEval V = (R * T * Z)/P;
+        LhsEval rho = 1.0 / V;
+        LhsEval rho_r = rho / rho_pc;
 
-        LhsEval sumLBC = 0.0;
-        for (int i = 0; i < 5; ++i) {
-            sumLBC += Opm::pow(rho_r,i)*LBC[i];
-        }
+        const LhsEval xsum_p_ca2 = xsum_p_ca * xsum_p_ca;
+        LhsEval zeta_tot = Opm::pow(xsum_T_c / (xsum_Mm * xsum_Mm * xsum_Mm * xsum_p_ca2 * xsum_p_ca2), 1./6);
 
-        return (my0 + (Opm::pow(sumLBC,4.0) - 1e-4)/zeta_tot)/1e3; // mPas-> Pas
-    }
+        const LhsEval sumLBC = lbcReducedDensityPolynomial(rho_r);
+        const LhsEval sumLBC2 = sumLBC * sumLBC;
 
+        return (my0 + (sumLBC2 * sumLBC2 - 1e-4)/zeta_tot)/1e3; // mPas-> Pas
+    }
 };
 
 } // namespace Opm
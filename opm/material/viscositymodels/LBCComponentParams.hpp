@@ -0,0 +1,141 @@
+// -*- mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-
+// vi: set et ts=4 sw=4 sts=4:
+/*
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 2 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+
+  Consult the COPYING file in the top-level source directory of this
+  module for the precise wording of the license and the list of
+  copyright holders.
+*/
+/*!
+ * \file
+ * \copydoc Opm::LBCComponentParams
+ */
+
+#ifndef OPM_LBC_COMPONENT_PARAMS_HPP
+#define OPM_LBC_COMPONENT_PARAMS_HPP
+
+#include <array>
+#include <cmath>
+#include <type_traits>
+
+namespace Opm
+{
+
+/*!
+ * \brief Per-component constants of the LBC viscosity correlations.
+ *
+ * The constants only depend on the critical properties and molar masses
+ * of the components.  Fluid systems with runtime configured components
+ * keep an instance up to date and provide it through a static
+ * lbcComponentParams() function; for other fluid systems the constants
+ * are computed on each viscosity evaluation.
+ */
+template <class Scalar, int numComponents>
+struct LBCComponentParams
+{
+    std::array<Scalar, numComponents> molarMass{}; // kg/kmol
+    std::array<Scalar, numComponents> sqrtMolarMass{};
+    std::array<Scalar, numComponents> criticalTemperature{}; // K
+    std::array<Scalar, numComponents> criticalPressure{}; // atm
+    std::array<Scalar, numComponents> criticalVolume{}; // m3/kmol
+
+    // Reciprocal of the viscosity reducing parameter of each component.
+    std::array<Scalar, numComponents> invZeta{};
+
+    // Pseudocritical temperature T_c_ij and ratio T_c_ij / p_c_ij [K/MPa]
+    // of each component pair, as used by the CO2 rich correlation.
+    std::array<std::array<Scalar, numComponents>, numComponents> pairTemperature{};
+    std::array<std::array<Scalar, numComponents>, numComponents> pairTemperatureOverPressure{};
+
+    template <class FluidSystem>
+    void update()
+    {
+        static_assert(FluidSystem::numComponents == numComponents,
+                      "Number of components does not match the fluid system");
+
+        const Scalar MPa_atm = 0.101325;
+        std::array<Scalar, numComponents> cbrtTOverP{};
+        for (unsigned compIdx = 0; compIdx < numComponents; ++compIdx) {
+            const Scalar p_c = FluidSystem::criticalPressure(compIdx) / 1e6; // converting to MPa from pascal
+            const Scalar T_c = FluidSystem::criticalTemperature(compIdx);
+            const Scalar Mm = FluidSystem::molarMass(compIdx) * 1000; // converting to kg/kmol from kg/mol
+            const Scalar p_ca = p_c / MPa_atm;
+
+            molarMass[compIdx] = Mm;
+            sqrtMolarMass[compIdx] = std::sqrt(Mm);
+            criticalTemperature[compIdx] = T_c;
+            criticalPressure[compIdx] = p_ca;
+            criticalVolume[compIdx] = FluidSystem::criticalVolume(compIdx);
+            invZeta[compIdx] = 1.0 / std::pow(T_c / (std::pow(Mm, 3.0) * std::pow(p_ca, 4.0)), 1./6);
+            cbrtTOverP[compIdx] = std::cbrt(T_c / p_c);
+        }
+
+        for (unsigned i = 0; i < numComponents; ++i) {
+            for (unsigned j = 0; j < numComponents; ++j) {
+                const Scalar sum = cbrtTOverP[i] + cbrtTOverP[j];
+                pairTemperature[i][j] = std::sqrt(criticalTemperature[i] * criticalTemperature[j]);
+                pairTemperatureOverPressure[i][j] = sum * sum * sum / 8.0;
+            }
+        }
+    }
+};
+
+/*!
+ * \brief The polynomial in reduced density of the LBC correlations.
+ */
+template <class LhsEval>
+LhsEval lbcReducedDensityPolynomial(const LhsEval& rho_r)
+{
+    constexpr std::array<double, 5> LBC = {0.10230,
+                                           0.023364,
+                                           0.058533,
+                                           -0.040758,  // typo in 1964-paper: -0.40758
+                                           0.0093324};
+
+    LhsEval sumLBC = LBC[4];
+    for (int i = 3; i >= 0; --i) {
+        sumLBC = sumLBC*rho_r + LBC[i];
+    }
+    return sumLBC;
+}
+
+template <class FluidSystem, class = void>
+struct HasLBCComponentParams : std::false_type {};
+
+template <class FluidSystem>
+struct HasLBCComponentParams<FluidSystem, std::void_t<decltype(FluidSystem::lbcComponentParams())>>
+    : std::true_type {};
+
+/*!
+ * \brief Call \p f with the LBC component constants of \p FluidSystem.
+ */
+template <class Scalar, class FluidSystem, class Function>
+decltype(auto) visitLBCComponentParams(Function&& f)
+{
+    if constexpr (HasLBCComponentParams<FluidSystem>::value) {
+        return f(FluidSystem::lbcComponentParams());
+    }
+    else {
+        LBCComponentParams<Scalar, FluidSystem::numComponents> params;
+        params.template update<FluidSystem>();
+        return f(params);
+    }
+}
+
+} // namespace Opm
+
+#endif // OPM_LBC_COMPONENT_PARAMS_HPP
@@ -20,14 +20,22 @@
 
 #include <fmt/format.h>
 
+#include <array>
 #include <cmath>
+#include <cstdint>
 #include <cstdio>
+#include <cstring>
 #include <fstream>
 #include <limits>
 #include <opm/common/ErrorMacros.hpp>
 #include <opm/ml/ml_model.hpp>
 #include <utility>
 
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
 namespace Opm
 {
 
@@ -48,12 +56,172 @@ namespace ML
         return !file.fail();
     }
 
+    // Binary model format: a header followed by the layers in the order of
+    // the Kerasify format, each given by its type and data. Arrays start at
+    // multiples of binary_alignment bytes, so that they can be used in place
+    // from a memory mapping of the file shared by all processes on a node.
+    constexpr char binary_magic[8] = {'O', 'P', 'M', 'N', 'N', 'B', 'I', 'N'};
+    constexpr std::uint32_t binary_version = 1;
+    constexpr std::uint32_t binary_byte_order = 0x01020304;
+    constexpr std::size_t binary_alignment = 64;
+
+    struct BinaryHeader {
+        char magic[8];
+        std::uint32_t version;
+        std::uint32_t byte_order;
+        std::uint32_t alignment;
+        std::uint32_t num_layers;
+    };
+
+    template <typename T>
+    bool NNBinaryReader::read(T& value)
+    {
+        if (offset_ + sizeof(T) > size_) {
+            return false;
+        }
+        std::memcpy(&value, mapping_.get() + offset_, sizeof(T));
+        offset_ += sizeof(T);
+        return true;
+    }
+
+    const float* NNBinaryReader::readArray(std::size_t n)
+    {
+        offset_ = (offset_ + binary_alignment - 1) / binary_alignment * binary_alignment;
+        if (offset_ + n * sizeof(float) > size_) {
+            return nullptr;
+        }
+        const float* data = reinterpret_cast<const float*>(mapping_.get() + offset_);
+        offset_ += n * sizeof(float);
+        return data;
+    }
+
+    template <typename T>
+    bool NNBinaryWriter::write(const T& value)
+    {
+        file_.write(reinterpret_cast<const char*>(&value), sizeof(T));
+        offset_ += sizeof(T);
+        return !file_.fail();
+    }
+
+    bool NNBinaryWriter::writeArray(const float* data, std::size_t n)
+    {
+        constexpr char padding[binary_alignment] = {};
+        const std::size_t aligned = (offset_ + binary_alignment - 1) / binary_alignment * binary_alignment;
+        file_.write(padding, aligned - offset_);
+        file_.write(reinterpret_cast<const char*>(data), n * sizeof(float));
+        offset_ = aligned + n * sizeof(float);
+        return !file_.fail();
+    }
+
+    template <class Evaluation>
+    bool NNLayer<Evaluation>::loadLayer(NNBinaryReader&)
+    {
+        return false;
+    }
+
+    template <class Evaluation>
+    bool NNLayer<Evaluation>::saveLayer(NNBinaryWriter&) const
+    {
+        return false;
+    }
+
+    // Access to the value (lane 0) and the derivatives (lanes 1, 2, ...)
+    // of an evaluation, which all transform alike in linear layers.
+    template <class Evaluation>
+    struct Lanes
+    {
+        using Scalar = typename MathToolbox<Evaluation>::Scalar;
+
+        static constexpr int size = 1 + Evaluation::numVars;
+
+        static Scalar get(const Evaluation& x, int lane)
+        {
+            return lane == 0 ? x.value() : x.derivative(lane - 1);
+        }
+
+        static void set(Evaluation& x, int lane, Scalar value)
+        {
+            if (lane == 0) {
+                x.setValue(value);
+            } else {
+                x.setDerivative(lane - 1, value);
+            }
+        }
+    };
+
+    template <>
+    struct Lanes<float>
+    {
+        using Scalar = float;
+        static constexpr int size = 1;
+        static float get(float x, int) { return x; }
+        static void set(float& x, int, float value) { x = value; }
+    };
+
+    template <>
+    struct Lanes<double>
+    {
+        using Scalar = double;
+        static constexpr int size = 1;
+        static double get(double x, int) { return x; }
+        static void set(double& x, int, double value) { x = value; }
+    };
+
+    template <class Evaluation>
+    bool NNLayer<Evaluation>::applyBatch(const Tensor<Evaluation>& in, Tensor<Evaluation>& out)
+    {
+        OPM_ERROR_IF(in.dims_.size() != 2, "Expected a (batch size x features) tensor");
+
+        const int batch_size = in.dims_[0];
+        const int num_in = in.dims_[1];
+        Tensor<Evaluation> sample_in(num_in);
+        Tensor<Evaluation> sample_out;
+        for (int n = 0; n < batch_size; n++) {
+            std::copy_n(in.data_.begin() + n * num_in, num_in, sample_in.data_.begin());
+            if (!apply(sample_in, sample_out)) {
+                return false;
+            }
+
+            if (n == 0) {
+                out.resizeI(std::vector<int>{batch_size, static_cast<int>(sample_out.data_.size())});
+            }
+            std::copy(sample_out.data_.begin(),
+                      sample_out.data_.end(),
+                      out.data_.begin() + n * sample_out.data_.size());
+        }
+
+        return true;
+    }
+
     template <class Evaluation>
     bool NNLayerActivation<Evaluation>::loadLayer(std::ifstream& file)
     {
         unsigned int activation = 0;
         OPM_ERROR_IF(!readFile<unsigned int>(file, activation), "Failed to read activation type");
+        setActivation_(activation);
 
+        return true;
+    }
+
+    template <class Evaluation>
+    bool NNLayerActivation<Evaluation>::loadLayer(NNBinaryReader& reader)
+    {
+        std::uint32_t activation = 0;
+        OPM_ERROR_IF(!reader.read(activation), "Failed to read activation type");
+        setActivation_(activation);
+
+        return true;
+    }
+
+    template <class Evaluation>
+    bool NNLayerActivation<Evaluation>::saveLayer(NNBinaryWriter& writer) const
+    {
+        return writer.write(static_cast<std::uint32_t>(activation_type_));
+    }
+
+    template <class Evaluation>
+    void NNLayerActivation<Evaluation>::setActivation_(unsigned int activation)
+    {
         switch (static_cast<ActivationType>(activation)) {
         case ActivationType::kLinear:
             activation_type_ = ActivationType::kLinear;
@@ -79,8 +247,6 @@ namespace ML
                                      "{}",
                                      activation));
         }
-
-        return true;
     }
 
     template <class Evaluation>
@@ -151,6 +317,24 @@ namespace ML
         return true;
     }
 
+    template <class Evaluation>
+    bool NNLayerScaling<Evaluation>::loadLayer(NNBinaryReader& reader)
+    {
+        OPM_ERROR_IF(!reader.read(data_min), "Failed to read data min");
+        OPM_ERROR_IF(!reader.read(data_max), "Failed to read data max");
+        OPM_ERROR_IF(!reader.read(feat_inf), "Failed to read feat inf");
+        OPM_ERROR_IF(!reader.read(feat_sup), "Failed to read feat sup");
+
+        return true;
+    }
+
+    template <class Evaluation>
+    bool NNLayerScaling<Evaluation>::saveLayer(NNBinaryWriter& writer) const
+    {
+        return writer.write(data_min) && writer.write(data_max)
+            && writer.write(feat_inf) && writer.write(feat_sup);
+    }
+
     template <class Evaluation>
     bool NNLayerScaling<Evaluation>::apply(const Tensor<Evaluation>& in, Tensor<Evaluation>& out)
     {
@@ -173,6 +357,24 @@ namespace ML
         return true;
     }
 
+    template <class Evaluation>
+    bool NNLayerUnScaling<Evaluation>::loadLayer(NNBinaryReader& reader)
+    {
+        OPM_ERROR_IF(!reader.read(data_min), "Failed to read data min");
+        OPM_ERROR_IF(!reader.read(data_max), "Failed to read data max");
+        OPM_ERROR_IF(!reader.read(feat_inf), "Failed to read feat inf");
+        OPM_ERROR_IF(!reader.read(feat_sup), "Failed to read feat sup");
+
+        return true;
+    }
+
+    template <class Evaluation>
+    bool NNLayerUnScaling<Evaluation>::saveLayer(NNBinaryWriter& writer) const
+    {
+        return writer.write(data_min) && writer.write(data_max)
+            && writer.write(feat_inf) && writer.write(feat_sup);
+    }
+
     template <class Evaluation>
     bool NNLayerUnScaling<Evaluation>::apply(const Tensor<Evaluation>& in, Tensor<Evaluation>& out)
     {
@@ -198,7 +400,7 @@ namespace ML
 
         unsigned int biases_shape = 0;
         OPM_ERROR_IF(!readFile<unsigned int>(file, biases_shape), "Expected biases shape");
-        OPM_ERROR_IF(!(biases_shape > 0), "Invalid biases shape");
+        OPM_ERROR_IF(biases_shape != weights_cols, "Invalid biases shape");
 
         weights_.resizeI<std::vector<unsigned int>>({weights_rows, weights_cols});
         OPM_ERROR_IF(!readFile<float>(file, weights_.data_.data(), weights_rows * weights_cols),
@@ -209,25 +411,157 @@ namespace ML
 
         OPM_ERROR_IF(!activation_.loadLayer(file), "Failed to load activation");
 
+        num_in_ = weights_rows;
+        num_out_ = weights_cols;
+        weights_data_ = weights_.data_.data();
+        biases_data_ = biases_.data_.data();
+
         return true;
     }
 
     template <class Evaluation>
-    bool NNLayerDense<Evaluation>::apply(const Tensor<Evaluation>& in, Tensor<Evaluation>& out)
+    bool NNLayerDense<Evaluation>::loadLayer(NNBinaryReader& reader)
     {
-        Tensor<Evaluation> tmp(weights_.dims_[1]);
-        Tensor<Evaluation> temp_in(in);
-        for (int i = 0; i < weights_.dims_[0]; i++) {
-            for (int j = 0; j < weights_.dims_[1]; j++) {
-                tmp(j) += (temp_in)(i)*weights_(i, j);
+        std::uint32_t weights_rows = 0;
+        OPM_ERROR_IF(!reader.read(weights_rows), "Expected weight rows");
+        OPM_ERROR_IF(!(weights_rows > 0), "Invalid weights # rows");
+
+        std::uint32_t weights_cols = 0;
+        OPM_ERROR_IF(!reader.read(weights_cols), "Expected weight cols");
+        OPM_ERROR_IF(!(weights_cols > 0), "Invalid weights shape");
+
+        std::uint32_t biases_shape = 0;
+        OPM_ERROR_IF(!reader.read(biases_shape), "Expected biases shape");
+        OPM_ERROR_IF(biases_shape != weights_cols, "Invalid biases shape");
+
+        weights_data_ = reader.readArray(static_cast<std::size_t>(weights_rows) * weights_cols);
+        OPM_ERROR_IF(!weights_data_, "Expected weights");
+
+        biases_data_ = reader.readArray(biases_shape);
+        OPM_ERROR_IF(!biases_data_, "Expected biases");
+
+        OPM_ERROR_IF(!activation_.loadLayer(reader), "Failed to load activation");
+
+        // The weights are used in place
+        mapping_ = reader.mapping();
+        num_in_ = weights_rows;
+        num_out_ = weights_cols;
+
+        return true;
+    }
+
+    template <class Evaluation>
+    bool NNLayerDense<Evaluation>::saveLayer(NNBinaryWriter& writer) const
+    {
+        OPM_ERROR_IF(!weights_data_, "Layer not loaded");
+
+        return writer.write(static_cast<std::uint32_t>(num_in_))
+            && writer.write(static_cast<std::uint32_t>(num_out_))
+            && writer.write(static_cast<std::uint32_t>(num_out_))
+            && writer.writeArray(weights_data_, static_cast<std::size_t>(num_in_) * num_out_)
+            && writer.writeArray(biases_data_, num_out_)
+            && activation_.saveLayer(writer);
+    }
+
+    template <class Evaluation>
+    void NNLayerDense<Evaluation>::multiply_(const Evaluation* in, int batch_size, Evaluation* out) const
+    {
+        // Rows of samples and columns of inputs are processed in blocks which
+        // keep the corresponding rows of the weights in cache.
+        constexpr int row_block = 16;
+        constexpr int in_block = 64;
+
+        using L = Lanes<Evaluation>;
+        const int num_in = num_in_;
+        const int num_out = num_out_;
+        const int num_rows = batch_size * L::size;
+
+        // Values and derivatives of the samples, one row per sample and
+        // derivative.  The scratch space is reused between calls, per thread
+        // so that the layers of a model may be applied concurrently.
+        thread_local std::vector<Scalar> lanes_in;
+        thread_local std::vector<Scalar> lanes_out;
+        lanes_in.resize(static_cast<std::size_t>(num_rows) * num_in);
+        lanes_out.resize(static_cast<std::size_t>(num_rows) * num_out);
+
+        for (int n = 0; n < batch_size; n++) {
+            for (int lane = 0; lane < L::size; lane++) {
+                Scalar* x = lanes_in.data() + static_cast<std::size_t>(n * L::size + lane) * num_in;
+                for (int i = 0; i < num_in; i++) {
+                    x[i] = L::get(in[n * num_in + i], lane);
+                }
+
+                // Only the value is shifted by the biases
+                Scalar* y = lanes_out.data() + static_cast<std::size_t>(n * L::size + lane) * num_out;
+                for (int j = 0; j < num_out; j++) {
+                    y[j] = (lane == 0) ? biases_data_[j] : 0.0f;
+                }
             }
         }
 
-        for (int i = 0; i < biases_.dims_[0]; i++) {
-            tmp(i) += biases_(i);
+        for (int r0 = 0; r0 < num_rows; r0 += row_block) {
+            const int r1 = std::min(r0 + row_block, num_rows);
+            for (int i0 = 0; i0 < num_in; i0 += in_block) {
+                const int i1 = std::min(i0 + in_block, num_in);
+                for (int r = r0; r < r1; r++) {
+                    const Scalar* x = lanes_in.data() + static_cast<std::size_t>(r) * num_in;
+                    Scalar* y = lanes_out.data() + static_cast<std::size_t>(r) * num_out;
+                    for (int i = i0; i < i1; i++) {
+                        // Derivative lanes and rectified inputs are often zero
+                        if (x[i] == 0) {
+                            continue;
+                        }
+
+                        const Scalar xi = x[i];
+                        const float* w = weights_data_ + static_cast<std::size_t>(i) * num_out;
+#pragma omp simd
+                        for (int j = 0; j < num_out; j++) {
+                            y[j] += xi * w[j];
+                        }
+                    }
+                }
+            }
+        }
+
+        for (int n = 0; n < batch_size; n++) {
+            for (int lane = 0; lane < L::size; lane++) {
+                const Scalar* y = lanes_out.data() + static_cast<std::size_t>(n * L::size + lane) * num_out;
+                for (int j = 0; j < num_out; j++) {
+                    L::set(out[n * num_out + j], lane, y[j]);
+                }
+            }
         }
+    }
+
+    template <class Evaluation>
+    bool NNLayerDense<Evaluation>::apply(const Tensor<Evaluation>& in, Tensor<Evaluation>& out)
+    {
+        OPM_ERROR_IF(static_cast<int>(in.data_.size()) != num_in_,
+                     fmt::format("\n Expected "
+                                 "{}"
+                                 " inputs, got "
+                                 "{}",
+                                 num_in_,
+                                 in.data_.size()));
+
+        out.resizeI(std::vector<int>{num_out_});
+        multiply_(in.data_.data(), 1, out.data_.data());
 
-        OPM_ERROR_IF(!activation_.apply(tmp, out), "Failed to apply activation");
+        OPM_ERROR_IF(!activation_.apply(out, out), "Failed to apply activation");
+
+        return true;
+    }
+
+    template <class Evaluation>
+    bool NNLayerDense<Evaluation>::applyBatch(const Tensor<Evaluation>& in, Tensor<Evaluation>& out)
+    {
+        OPM_ERROR_IF(in.dims_.size() != 2 || in.dims_[1] != num_in_,
+                     "Expected a (batch size x input size) tensor");
+
+        out.resizeI(std::vector<int>{in.dims_[0], num_out_});
+        multiply_(in.data_.data(), in.dims_[0], out.data_.data());
+
+        OPM_ERROR_IF(!activation_.apply(out, out), "Failed to apply activation");
 
         return true;
     }
@@ -270,6 +604,25 @@ namespace ML
         return true;
     }
 
+    template <class Evaluation>
+    std::unique_ptr<NNLayer<Evaluation>> makeLayer(unsigned int layer_type)
+    {
+        using LayerType = typename NNModel<Evaluation>::LayerType;
+
+        switch (static_cast<LayerType>(layer_type)) {
+        case LayerType::kScaling:
+            return std::make_unique<NNLayerScaling<Evaluation>>();
+        case LayerType::kUnScaling:
+            return std::make_unique<NNLayerUnScaling<Evaluation>>();
+        case LayerType::kDense:
+            return std::make_unique<NNLayerDense<Evaluation>>();
+        case LayerType::kActivation:
+            return std::make_unique<NNLayerActivation<Evaluation>>();
+        default:
+            return nullptr;
+        }
+    }
+
     template <class Evaluation>
     bool NNModel<Evaluation>::loadModel(const std::string& filename)
     {
@@ -279,6 +632,15 @@ namespace ML
                                  "{}",
                                  filename.c_str()));
 
+        char magic[sizeof(binary_magic)] = {};
+        if (readFile<char>(file, magic, sizeof(magic))
+            && std::memcmp(magic, binary_magic, sizeof(magic)) == 0) {
+            file.close();
+            return loadBinaryModel_(filename);
+        }
+        file.clear();
+        file.seekg(0);
+
         unsigned int num_layers = 0;
         OPM_ERROR_IF(!readFile<unsigned int>(file, num_layers), "Expected number of layers");
 
@@ -286,24 +648,7 @@ namespace ML
             unsigned int layer_type = 0;
             OPM_ERROR_IF(!readFile<unsigned int>(file, layer_type), "Expected layer type");
 
-            std::unique_ptr<NNLayer<Evaluation>> layer = nullptr;
-
-            switch (static_cast<LayerType>(layer_type)) {
-            case LayerType::kScaling:
-                layer = std::make_unique<NNLayerScaling<Evaluation>>();
-                break;
-            case LayerType::kUnScaling:
-                layer = std::make_unique<NNLayerUnScaling<Evaluation>>();
-                break;
-            case LayerType::kDense:
-                layer = std::make_unique<NNLayerDense<Evaluation>>();
-                break;
-            case LayerType::kActivation:
-                layer = std::make_unique<NNLayerActivation<Evaluation>>();
-                break;
-            default:
-                break;
-            }
+            std::unique_ptr<NNLayer<Evaluation>> layer = makeLayer<Evaluation>(layer_type);
 
             OPM_ERROR_IF(!layer,
                          fmt::format("\n Unknown layer type "
@@ -315,6 +660,94 @@ namespace ML
                                      i));
 
             layers_.emplace_back(std::move(layer));
+            layer_types_.push_back(static_cast<LayerType>(layer_type));
+        }
+
+        return true;
+    }
+
+    template <class Evaluation>
+    bool NNModel<Evaluation>::loadBinaryModel_(const std::string& filename)
+    {
+        const int fd = ::open(filename.c_str(), O_RDONLY);
+        OPM_ERROR_IF(fd < 0,
+                     fmt::format("\n Unable to open file "
+                                 "{}",
+                                 filename));
+
+        struct stat status;
+        const bool has_size = ::fstat(fd, &status) == 0;
+        const std::size_t size = has_size ? static_cast<std::size_t>(status.st_size) : 0;
+        void* address = (size > 0) ? ::mmap(nullptr, size, PROT_READ, MAP_SHARED, fd, 0) : MAP_FAILED;
+        ::close(fd);
+        OPM_ERROR_IF(address == MAP_FAILED,
+                     fmt::format("\n Unable to map file "
+                                 "{}",
+                                 filename));
+
+        // Read only shared pages, so processes loading the same model share
+        // the physical memory of the weights.
+        std::shared_ptr<const char> mapping(static_cast<const char*>(address),
+                                            [size](const char* p)
+                                            { ::munmap(const_cast<char*>(p), size); });
+        NNBinaryReader reader(mapping, size);
+
+        BinaryHeader header;
+        OPM_ERROR_IF(!reader.read(header), "Expected binary model header");
+        OPM_ERROR_IF(header.byte_order != binary_byte_order,
+                     "Binary model written with a different byte order");
+        OPM_ERROR_IF(header.version != binary_version || header.alignment != binary_alignment,
+                     fmt::format("\n Unsupported binary model version "
+                                 "{}",
+                                 header.version));
+
+        for (std::uint32_t i = 0; i < header.num_layers; i++) {
+            std::uint32_t layer_type = 0;
+            OPM_ERROR_IF(!reader.read(layer_type), "Expected layer type");
+
+            std::unique_ptr<NNLayer<Evaluation>> layer = makeLayer<Evaluation>(layer_type);
+
+            OPM_ERROR_IF(!layer,
+                         fmt::format("\n Unknown layer type "
+                                     "{}",
+                                     layer_type));
+            OPM_ERROR_IF(!layer->loadLayer(reader),
+                         fmt::format("\n Failed to load layer "
+                                     "{}",
+                                     i));
+
+            layers_.emplace_back(std::move(layer));
+            layer_types_.push_back(static_cast<LayerType>(layer_type));
+        }
+
+        return true;
+    }
+
+    template <class Evaluation>
+    bool NNModel<Evaluation>::saveModel(const std::string& filename) const
+    {
+        std::ofstream file(filename.c_str(), std::ios::binary);
+        OPM_ERROR_IF(!file.is_open(),
+                     fmt::format("\n Unable to open file "
+                                 "{}",
+                                 filename));
+
+        BinaryHeader header;
+        std::memcpy(header.magic, binary_magic, sizeof(binary_magic));
+        header.version = binary_version;
+        header.byte_order = binary_byte_order;
+        header.alignment = binary_alignment;
+        header.num_layers = layers_.size();
+
+        NNBinaryWriter writer(file);
+        OPM_ERROR_IF(!writer.write(header), "Failed to write binary model header");
+
+        for (unsigned int i = 0; i < layers_.size(); i++) {
+            OPM_ERROR_IF(!writer.write(static_cast<std::uint32_t>(layer_types_[i]))
+                         || !layers_[i]->saveLayer(writer),
+                         fmt::format("\n Failed to write layer "
+                                     "{}",
+                                     i));
         }
 
         return true;
@@ -339,6 +772,34 @@ namespace ML
         return true;
     }
 
+    template <class Evaluation>
+    bool NNModel<Evaluation>::applyBatch(const Tensor<Evaluation>& in, Tensor<Evaluation>& out)
+    {
+        OPM_ERROR_IF(in.dims_.size() != 2, "Expected a (batch size x input size) tensor");
+
+        if (layers_.empty()) {
+            out = in;
+            return true;
+        }
+
+        // Intermediate results, reused between calls, per thread so that a
+        // model may be applied concurrently.
+        thread_local std::array<Tensor<Evaluation>, 2> buffers;
+
+        const Tensor<Evaluation>* layer_in = &in;
+        for (unsigned int i = 0; i < layers_.size(); i++) {
+            Tensor<Evaluation>& layer_out = (i + 1 == layers_.size()) ? out : buffers[i % 2];
+
+            OPM_ERROR_IF(!(layers_[i]->applyBatch(*layer_in, layer_out)),
+                         fmt::format("\n Failed to apply layer "
+                                     "{}",
+                                     i));
+
+            layer_in = &layer_out;
+        }
+        return true;
+    }
+
     template class NNModel<float>;
 
     template class NNModel<double>;
@@ -26,11 +26,15 @@
 #include <algorithm>
 #include <chrono>
 #include <cmath>
+#include <cstddef>
 #include <cstdio>
+#include <fstream>
+#include <memory>
 #include <numeric>
 #include <opm/common/ErrorMacros.hpp>
 #include <opm/material/densead/Math.hpp>
 #include <string>
+#include <utility>
 #include <vector>
 
 namespace Opm
@@ -354,6 +358,59 @@ namespace ML
         std::vector<T> data_;
     };
 
+    /** \class Binary model reader
+     * Reads the records of a binary model file mapped into memory. Arrays are
+     * aligned in the file and returned as pointers into the mapping, which
+     * layers referencing them keep alive through mapping().
+     */
+    class NNBinaryReader
+    {
+    public:
+        NNBinaryReader(std::shared_ptr<const char> mapping, std::size_t size)
+            : mapping_(std::move(mapping))
+            , size_(size)
+        {
+        }
+
+        template <typename T>
+        bool read(T& value);
+
+        // Returns nullptr if the file is too short
+        const float* readArray(std::size_t n);
+
+        const std::shared_ptr<const char>& mapping() const
+        {
+            return mapping_;
+        }
+
+    private:
+        std::shared_ptr<const char> mapping_;
+        std::size_t size_;
+        std::size_t offset_ = 0;
+    };
+
+    /** \class Binary model writer
+     * Writes the records of a binary model file, padding arrays to the
+     * alignment of the format.
+     */
+    class NNBinaryWriter
+    {
+    public:
+        explicit NNBinaryWriter(std::ofstream& file)
+            : file_(file)
+        {
+        }
+
+        template <typename T>
+        bool write(const T& value);
+
+        bool writeArray(const float* data, std::size_t n);
+
+    private:
+        std::ofstream& file_;
+        std::size_t offset_ = 0;
+    };
+
     // NN layer
     // ---------------------
     /** \class Neural Network  Layer base class.
@@ -374,8 +431,14 @@ namespace ML
 
         // Loads the ML trained file, returns true if the file exists
         virtual bool loadLayer(std::ifstream& file) = 0;
+        // Loads the layer from a binary model, returns true on success
+        virtual bool loadLayer(NNBinaryReader& reader);
+        // Writes the layer to a binary model, returns true on success
+        virtual bool saveLayer(NNBinaryWriter& writer) const;
         // Apply the NN layers
         virtual bool apply(const Tensor<Evaluation>& in, Tensor<Evaluation>& out) = 0;
+        // Apply the NN layer to each row of a (batch size x features) tensor
+        virtual bool applyBatch(const Tensor<Evaluation>& in, Tensor<Evaluation>& out);
     };
 
     /** \class Activation  Layer class
@@ -400,10 +463,19 @@ namespace ML
         }
 
         bool loadLayer(std::ifstream& file) override;
+        bool loadLayer(NNBinaryReader& reader) override;
+        bool saveLayer(NNBinaryWriter& writer) const override;
 
         bool apply(const Tensor<Evaluation>& in, Tensor<Evaluation>& out) override;
 
+        bool applyBatch(const Tensor<Evaluation>& in, Tensor<Evaluation>& out) override
+        {
+            return apply(in, out);
+        }
+
     private:
+        void setActivation_(unsigned int activation);
+
         ActivationType activation_type_;
     };
 
@@ -423,9 +495,17 @@ namespace ML
         }
 
         bool loadLayer(std::ifstream& file) override;
+        bool loadLayer(NNBinaryReader& reader) override;
+        bool saveLayer(NNBinaryWriter& writer) const override;
 
         bool apply(const Tensor<Evaluation>& in, Tensor<Evaluation>& out) override;
 
+        bool applyBatch(const Tensor<Evaluation>& in, Tensor<Evaluation>& out) override
+        {
+            out.resizeI(in.dims_);
+            return apply(in, out);
+        }
+
     private:
         Tensor<float> weights_;
         Tensor<float> biases_;
@@ -451,9 +531,17 @@ namespace ML
         }
 
         bool loadLayer(std::ifstream& file) override;
+        bool loadLayer(NNBinaryReader& reader) override;
+        bool saveLayer(NNBinaryWriter& writer) const override;
 
         bool apply(const Tensor<Evaluation>& in, Tensor<Evaluation>& out) override;
 
+        bool applyBatch(const Tensor<Evaluation>& in, Tensor<Evaluation>& out) override
+        {
+            out.resizeI(in.dims_);
+            return apply(in, out);
+        }
+
     private:
         Tensor<float> weights_;
         Tensor<float> biases_;
@@ -470,11 +558,34 @@ namespace ML
     class NNLayerDense : public NNLayer<Evaluation>
     {
     public:
+        NNLayerDense() = default;
+
+        // The weights may point into the layer's own tensors.
+        NNLayerDense(const NNLayerDense&) = delete;
+        NNLayerDense& operator=(const NNLayerDense&) = delete;
+
         bool loadLayer(std::ifstream& file) override;
+        bool loadLayer(NNBinaryReader& reader) override;
+        bool saveLayer(NNBinaryWriter& writer) const override;
 
         bool apply(const Tensor<Evaluation>& in, Tensor<Evaluation>& out) override;
 
+        bool applyBatch(const Tensor<Evaluation>& in, Tensor<Evaluation>& out) override;
+
     private:
+        using Scalar = typename MathToolbox<Evaluation>::Scalar;
+
+        // out = in * weights + biases for batchSize samples, without activation
+        void multiply_(const Evaluation* in, int batchSize, Evaluation* out) const;
+
+        // Weights (num_in_ x num_out_, row major) and biases, either owned by
+        // the tensors or mapped from a binary model.
+        int num_in_ = 0;
+        int num_out_ = 0;
+        const float* weights_data_ = nullptr;
+        const float* biases_data_ = nullptr;
+        std::shared_ptr<const char> mapping_;
+
         Tensor<float> weights_;
         Tensor<float> biases_;
 
@@ -507,13 +618,23 @@ namespace ML
 
         virtual ~NNModel() = default;
 
-        // loads models (.model files) generated by Kerasify
+        // loads models (.model files) generated by Kerasify, or binary models
+        // written by saveModel() which are mapped into memory
         virtual bool loadModel(const std::string& filename);
 
+        // writes the model in the binary format
+        bool saveModel(const std::string& filename) const;
+
         virtual bool apply(const Tensor<Evaluation>& in, Tensor<Evaluation>& out);
 
+        // Applies the model to each row of a (batch size x input size) tensor.
+        virtual bool applyBatch(const Tensor<Evaluation>& in, Tensor<Evaluation>& out);
+
     private:
+        bool loadBinaryModel_(const std::string& filename);
+
         std::vector<std::unique_ptr<NNLayer<Evaluation>>> layers_;
+        std::vector<LayerType> layer_types_;
     };
 
     /** \class Neural Network Timer class
@@ -0,0 +1,466 @@
+/*
+  Copyright 2026 Equinor ASA
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#if HAVE_CONFIG_H
+#include <config.h>
+#endif // HAVE_CONFIG_H
+
+#include <opm/output/data/FlatWells.hpp>
+
+#include <opm/output/data/Wells.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+static_assert(static_cast<std::uint32_t>(Opm::data::Rates::opt::mass_gas) ==
+              (std::uint32_t{1} << (Opm::data::FlatWells::NumRateItems - 1)),
+              "FlatWells::NumRateItems must match the last Rates::opt item");
+
+static_assert(std::is_trivially_copyable_v<Opm::data::FlatWells::WellRecord>);
+static_assert(std::is_trivially_copyable_v<Opm::data::FlatWells::ConnectionRecord>);
+static_assert(std::is_trivially_copyable_v<Opm::data::FlatWells::SegmentRecord>);
+static_assert(std::is_trivially_copyable_v<Opm::data::FlatWells::TracerRecord>);
+
+namespace {
+
+    /// Element counts at start of packed buffer.
+    enum class Count : std::size_t {
+        Wells, Connections, Segments, TracerRates, TracerNames,
+
+        // -- Must be last enumerator --
+        NumCounts,
+    };
+
+    using Header = std::array<std::uint64_t, static_cast<std::size_t>(Count::NumCounts)>;
+
+    std::uint64_t& count(Header& header, const Count c)
+    {
+        return header[static_cast<std::size_t>(c)];
+    }
+
+    class PackBuffer
+    {
+    public:
+        explicit PackBuffer(std::vector<char>& bytes)
+            : bytes_(bytes)
+        {}
+
+        template <typename T>
+        void write(const T* data, const std::size_t n)
+        {
+            static_assert(std::is_trivially_copyable_v<T>);
+
+            const auto nbytes = n * sizeof(T);
+            const auto start = this->bytes_.size();
+
+            this->bytes_.resize(start + nbytes);
+            if (nbytes > 0) {
+                std::memcpy(this->bytes_.data() + start, data, nbytes);
+            }
+        }
+
+        void write(const std::vector<std::string>& names)
+        {
+            for (const auto& name : names) {
+                const auto len = static_cast<std::uint64_t>(name.size());
+                this->write(&len, 1);
+                this->write(name.data(), name.size());
+            }
+        }
+
+    private:
+        std::vector<char>& bytes_;
+    };
+
+    class UnpackBuffer
+    {
+    public:
+        UnpackBuffer(const char* data, const std::size_t size)
+            : data_(data), size_(size)
+        {}
+
+        template <typename T>
+        void read(T* data, const std::size_t n)
+        {
+            static_assert(std::is_trivially_copyable_v<T>);
+
+            const auto nbytes = n * sizeof(T);
+            if (nbytes > this->size_ - this->pos_) {
+                throw std::invalid_argument {
+                    "Buffer too small to unpack FlatWells object"
+                };
+            }
+
+            if (nbytes > 0) {
+                std::memcpy(data, this->data_ + this->pos_, nbytes);
+            }
+
+            this->pos_ += nbytes;
+        }
+
+        template <typename T>
+        void read(std::vector<T>& vec, const std::size_t n)
+        {
+            vec.resize(n);
+            this->read(vec.data(), n);
+        }
+
+        void read(std::vector<std::string>& names, const std::size_t n)
+        {
+            names.resize(n);
+            for (auto& name : names) {
+                auto len = std::uint64_t{0};
+                this->read(&len, 1);
+
+                name.resize(len);
+                this->read(name.data(), len);
+            }
+        }
+
+        bool exhausted() const
+        {
+            return this->pos_ == this->size_;
+        }
+
+    private:
+        const char* data_{nullptr};
+        std::size_t size_{0};
+        std::size_t pos_{0};
+    };
+
+} // Anonymous namespace
+
+namespace Opm { namespace data {
+
+std::size_t FlatWells::RateValues::index(const Rates::opt m)
+{
+    auto bits = static_cast<std::uint32_t>(m);
+
+    auto i = std::size_t{0};
+    while ((bits >>= 1) != 0) {
+        ++i;
+    }
+
+    return i;
+}
+
+FlatWells::FlatWells(const Wells& wells)
+{
+    auto tracerIndex = std::unordered_map<std::string, std::uint32_t>{};
+
+    this->wellNames_.reserve(wells.size());
+    this->wells_.reserve(wells.size());
+
+    for (const auto& [name, well] : wells) {
+        const auto slot = this->wells_.size();
+
+        this->wellNames_.push_back(name);
+        auto& rec = this->wells_.emplace_back();
+
+        rec.rates = this->flatten(well.rates, Owner::Well, slot, tracerIndex);
+        rec.bhp = well.bhp;
+        rec.thp = well.thp;
+        rec.temperature = well.temperature;
+        rec.control = well.control;
+        rec.efficiency_scaling_factor = well.efficiency_scaling_factor;
+        rec.filtrate = well.filtrate;
+        rec.dynamicStatus = well.dynamicStatus;
+        rec.current_control = well.current_control;
+        rec.guide_rates = well.guide_rates;
+        rec.limits = well.limits;
+
+        rec.firstConnection = this->connections_.size();
+        rec.numConnections = well.connections.size();
+        for (const auto& conn : well.connections) {
+            const auto connIx = this->connections_.size();
+            auto& crec = this->connections_.emplace_back();
+
+            crec.index = conn.index;
+            crec.rates = this->flatten(conn.rates, Owner::Connection, connIx, tracerIndex);
+            crec.pressure = conn.pressure;
+            crec.reservoir_rate = conn.reservoir_rate;
+            crec.cell_pressure = conn.cell_pressure;
+            crec.cell_saturation_water = conn.cell_saturation_water;
+            crec.cell_saturation_gas = conn.cell_saturation_gas;
+            crec.effective_Kh = conn.effective_Kh;
+            crec.trans_factor = conn.trans_factor;
+            crec.d_factor = conn.d_factor;
+            crec.compact_mult = conn.compact_mult;
+            crec.filtrate = conn.filtrate;
+            crec.fract = conn.fract;
+        }
+
+        auto segKeys = std::vector<std::size_t>{};
+        segKeys.reserve(well.segments.size());
+        for (const auto& segment : well.segments) {
+            segKeys.push_back(segment.first);
+        }
+        std::sort(segKeys.begin(), segKeys.end());
+
+        rec.firstSegment = this->segments_.size();
+        rec.numSegments = segKeys.size();
+        for (const auto& key : segKeys) {
+            const auto& seg = well.segments.at(key);
+            const auto segIx = this->segments_.size();
+            auto& srec = this->segments_.emplace_back();
+
+            srec.key = key;
+            srec.rates = this->flatten(seg.rates, Owner::Segment, segIx, tracerIndex);
+            srec.pressures = seg.pressures;
+            srec.velocity = seg.velocity;
+            srec.holdup = seg.holdup;
+            srec.viscosity = seg.viscosity;
+            srec.density = seg.density;
+            srec.segNumber = seg.segNumber;
+        }
+    }
+
+    this->indexWellNames();
+}
+
+Wells FlatWells::toWells() const
+{
+    auto wells = Wells{};
+
+    for (auto slot = 0*this->wells_.size(); slot < this->wells_.size(); ++slot) {
+        const auto& rec = this->wells_[slot];
+        auto& well = wells[this->wellNames_[slot]];
+
+        this->restore(rec.rates, well.rates);
+        well.bhp = rec.bhp;
+        well.thp = rec.thp;
+        well.temperature = rec.temperature;
+        well.control = rec.control;
+        well.efficiency_scaling_factor = rec.efficiency_scaling_factor;
+        well.filtrate = rec.filtrate;
+        well.dynamicStatus = rec.dynamicStatus;
+        well.current_control = rec.current_control;
+        well.guide_rates = rec.guide_rates;
+        well.limits = rec.limits;
+
+        well.connections.resize(rec.numConnections);
+        for (auto c = 0*rec.numConnections; c < rec.numConnections; ++c) {
+            const auto& crec = this->connections_[rec.firstConnection + c];
+            auto& conn = well.connections[c];
+
+            conn.index = crec.index;
+            this->restore(crec.rates, conn.rates);
+            conn.pressure = crec.pressure;
+            conn.reservoir_rate = crec.reservoir_rate;
+            conn.cell_pressure = crec.cell_pressure;
+            conn.cell_saturation_water = crec.cell_saturation_water;
+            conn.cell_saturation_gas = crec.cell_saturation_gas;
+            conn.effective_Kh = crec.effective_Kh;
+            conn.trans_factor = crec.trans_factor;
+            conn.d_factor = crec.d_factor;
+            conn.compact_mult = crec.compact_mult;
+            conn.filtrate = crec.filtrate;
+            conn.fract = crec.fract;
+        }
+
+        well.segments.reserve(rec.numSegments);
+        for (auto s = 0*rec.numSegments; s < rec.numSegments; ++s) {
+            const auto& srec = this->segments_[rec.firstSegment + s];
+            auto& seg = well.segments[srec.key];
+
+            this->restore(srec.rates, seg.rates);
+            seg.pressures = srec.pressures;
+            seg.velocity = srec.velocity;
+            seg.holdup = srec.holdup;
+            seg.viscosity = srec.viscosity;
+            seg.density = srec.density;
+            seg.segNumber = srec.segNumber;
+        }
+    }
+
+    // Tracer rates refer to the owning entity by position, so map
+    // connection and segment indices back to their wells.
+    auto connWell = std::vector<std::size_t>(this->connections_.size());
+    auto segWell = std::vector<std::size_t>(this->segments_.size());
+    for (auto slot = 0*this->wells_.size(); slot < this->wells_.size(); ++slot) {
+        const auto& rec = this->wells_[slot];
+        std::fill_n(connWell.begin() + rec.firstConnection, rec.numConnections, slot);
+        std::fill_n(segWell.begin() + rec.firstSegment, rec.numSegments, slot);
+    }
+
+    for (const auto& tr : this->tracerRates_) {
+        const auto& name = this->tracerNames_[tr.tracer];
+
+        switch (tr.owner) {
+        case Owner::Well:
+            wells[this->wellNames_[tr.entity]].rates.tracer.emplace(name, tr.rate);
+            break;
+
+        case Owner::Connection: {
+            const auto slot = connWell[tr.entity];
+            auto& well = wells[this->wellNames_[slot]];
+            well.connections[tr.entity - this->wells_[slot].firstConnection]
+                .rates.tracer.emplace(name, tr.rate);
+        }
+            break;
+
+        case Owner::Segment: {
+            auto& well = wells[this->wellNames_[segWell[tr.entity]]];
+            well.segments[this->segments_[tr.entity].key]
+                .rates.tracer.emplace(name, tr.rate);
+        }
+            break;
+        }
+    }
+
+    return wells;
+}
+
+std::optional<std::size_t>
+FlatWells::wellSlot(const std::string& name) const
+{
+    auto pos = this->wellSlots_.find(name);
+    if (pos == this->wellSlots_.end()) {
+        return std::nullopt;
+    }
+
+    return pos->second;
+}
+
+double FlatWells::get(const std::string& well_name, const Rates::opt m) const
+{
+    const auto slot = this->wellSlot(well_name);
+    if (! slot.has_value()) {
+        return 0.0;
+    }
+
+    return this->wells_[*slot].rates.get(m, 0.0);
+}
+
+std::vector<char> FlatWells::pack() const
+{
+    auto header = Header{};
+    count(header, Count::Wells) = this->wells_.size();
+    count(header, Count::Connections) = this->connections_.size();
+    count(header, Count::Segments) = this->segments_.size();
+    count(header, Count::TracerRates) = this->tracerRates_.size();
+    count(header, Count::TracerNames) = this->tracerNames_.size();
+
+    auto bytes = std::vector<char>{};
+    auto buffer = PackBuffer { bytes };
+
+    buffer.write(header.data(), header.size());
+    buffer.write(this->wells_.data(), this->wells_.size());
+    buffer.write(this->connections_.data(), this->connections_.size());
+    buffer.write(this->segments_.data(), this->segments_.size());
+    buffer.write(this->tracerRates_.data(), this->tracerRates_.size());
+    buffer.write(this->wellNames_);
+    buffer.write(this->tracerNames_);
+
+    return bytes;
+}
+
+void FlatWells::unpack(const char* data, const std::size_t size)
+{
+    auto buffer = UnpackBuffer { data, size };
+
+    auto header = Header{};
+    buffer.read(header.data(), header.size());
+
+    buffer.read(this->wells_, count(header, Count::Wells));
+    buffer.read(this->connections_, count(header, Count::Connections));
+    buffer.read(this->segments_, count(header, Count::Segments));
+    buffer.read(this->tracerRates_, count(header, Count::TracerRates));
+    buffer.read(this->wellNames_, count(header, Count::Wells));
+    buffer.read(this->tracerNames_, count(header, Count::TracerNames));
+
+    if (! buffer.exhausted()) {
+        throw std::invalid_argument {
+            "Trailing data in packed FlatWells buffer"
+        };
+    }
+
+    this->indexWellNames();
+}
+
+void FlatWells::clear()
+{
+    this->wellNames_.clear();
+    this->wellSlots_.clear();
+    this->wells_.clear();
+    this->connections_.clear();
+    this->segments_.clear();
+    this->tracerNames_.clear();
+    this->tracerRates_.clear();
+}
+
+FlatWells::RateValues
+FlatWells::flatten(const Rates& rates,
+                   const Owner owner,
+                   const std::size_t entity,
+                   std::unordered_map<std::string, std::uint32_t>& tracerIndex)
+{
+    auto values = RateValues{};
+    values.mask = static_cast<std::uint32_t>(rates.mask);
+
+    for (auto i = 0*NumRateItems; i < NumRateItems; ++i) {
+        const auto m = static_cast<Rates::opt>(std::uint32_t{1} << i);
+        if (m != Rates::opt::tracer) {
+            values.value[i] = rates.get_ref(m);
+        }
+    }
+
+    for (const auto& [name, rate] : rates.tracer) {
+        const auto newIx = static_cast<std::uint32_t>(this->tracerNames_.size());
+        const auto [pos, inserted] = tracerIndex.emplace(name, newIx);
+        if (inserted) {
+            this->tracerNames_.push_back(name);
+        }
+
+        this->tracerRates_.push_back({ owner, pos->second, entity, rate });
+    }
+
+    return values;
+}
+
+void FlatWells::restore(const RateValues& values, Rates& rates) const
+{
+    rates.mask = static_cast<Rates::opt>(values.mask);
+
+    for (auto i = 0*NumRateItems; i < NumRateItems; ++i) {
+        const auto m = static_cast<Rates::opt>(std::uint32_t{1} << i);
+        if (m != Rates::opt::tracer) {
+            rates.get_ref(m) = values.value[i];
+        }
+    }
+}
+
+void FlatWells::indexWellNames()
+{
+    this->wellSlots_.clear();
+    for (auto slot = 0*this->wellNames_.size(); slot < this->wellNames_.size(); ++slot) {
+        this->wellSlots_.emplace(this->wellNames_[slot], slot);
+    }
+}
+
+}} // namespace Opm::data
@@ -0,0 +1,289 @@
+/*
+  Copyright 2026 Equinor ASA
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef OPM_OUTPUT_DATA_FLATWELLS_HPP
+#define OPM_OUTPUT_DATA_FLATWELLS_HPP
+
+#include <opm/output/data/Wells.hpp>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+/// \file
+///
+/// Index based, contiguous representation of a data::Wells collection.
+/// Intended for bulk consumers such as summary evaluation and for
+/// transferring dynamic well results between MPI ranks as a single
+/// byte buffer.
+
+namespace Opm { namespace data {
+
+    /// Flat representation of a data::Wells collection.
+    ///
+    /// Well names are interned into a table of well slots.  Well level
+    /// data, connections and segments are stored in contiguous arrays of
+    /// trivially copyable records, with each well referring to its
+    /// connections and segments as ranges of those arrays.  Tracer rates,
+    /// which are keyed by name in the Rates object, are stored in a
+    /// separate array referring to an interned tracer name table.
+    class FlatWells
+    {
+    public:
+        /// Number of non-tracer rate items.  One per bit of Rates::opt.
+        static constexpr std::size_t NumRateItems = 23;
+
+        /// Rate values of a single entity.  Entry i corresponds to rate
+        /// item (1 << i) of Rates::opt.  The tracer entry is unused.
+        struct RateValues
+        {
+            /// Rates::opt bit mask of set items, including the tracer bit.
+            std::uint32_t mask{};
+
+            /// Rate values.
+            std::array<double, NumRateItems> value{};
+
+            /// Whether or not a single rate item is set.
+            bool has(const Rates::opt m) const
+            {
+                return (this->mask & static_cast<std::uint32_t>(m)) != 0;
+            }
+
+            /// Value of a single rate item, or \p default_value if unset.
+            double get(const Rates::opt m, const double default_value) const
+            {
+                return this->has(m) ? this->value[index(m)] : default_value;
+            }
+
+            /// Position of rate item in value array.
+            static std::size_t index(Rates::opt m);
+        };
+
+        /// Well level quantities of a single well.
+        struct WellRecord
+        {
+            RateValues rates{};
+
+            double bhp{0.0};
+            double thp{0.0};
+            double temperature{0.0};
+            int control{0};
+            double efficiency_scaling_factor{1.0};
+
+            WellFiltrate filtrate{};
+
+            ::Opm::WellStatus dynamicStatus { ::Opm::WellStatus::OPEN };
+
+            CurrentControl current_control{};
+
+            GuideRateValue guide_rates{};
+
+            WellControlLimits limits{};
+
+            /// Range of well's connections in connections().
+            std::size_t firstConnection{};
+            std::size_t numConnections{};
+
+            /// Range of well's segments in segments().
+            std::size_t firstSegment{};
+            std::size_t numSegments{};
+        };
+
+        /// Dynamic quantities of a single well connection.
+        struct ConnectionRecord
+        {
+            Connection::global_index index{};
+            RateValues rates{};
+            double pressure{};
+            double reservoir_rate{};
+            double cell_pressure{};
+            double cell_saturation_water{};
+            double cell_saturation_gas{};
+            double effective_Kh{};
+            double trans_factor{};
+            double d_factor{};
+            double compact_mult{1.0};
+            ConnectionFiltrate filtrate{};
+            ConnectionFracturing fract{};
+        };
+
+        /// Dynamic quantities of a single well segment.
+        struct SegmentRecord
+        {
+            /// Key of segment in the Well::segments map.
+            std::size_t key{};
+
+            RateValues rates{};
+            SegmentPressures pressures{};
+            SegmentPhaseQuantity velocity{};
+            SegmentPhaseQuantity holdup{};
+            SegmentPhaseQuantity viscosity{};
+            SegmentPhaseDensity density{};
+            std::size_t segNumber{};
+        };
+
+        /// Kind of entity to which a tracer rate belongs.
+        enum class Owner : std::uint32_t { Well, Connection, Segment };
+
+        /// Single named tracer rate.
+        struct TracerRecord
+        {
+            Owner owner{Owner::Well};
+
+            /// Index into tracer name table.
+            std::uint32_t tracer{};
+
+            /// Well slot, or index into connections() or segments().
+            std::size_t entity{};
+
+            double rate{};
+        };
+
+        /// Default constructor.  Creates an empty collection.
+        FlatWells() = default;
+
+        /// Constructor.
+        ///
+        /// Flatten a collection of dynamic well results.  Well slots are
+        /// assigned in the iteration order of \p wells, i.e., in
+        /// alphabetical order of well names.  Segments are stored in
+        /// increasing order of their keys.
+        ///
+        /// \param[in] wells Dynamic well results.
+        explicit FlatWells(const Wells& wells);
+
+        /// Reconstitute map based collection of dynamic well results.
+        Wells toWells() const;
+
+        /// Number of wells in collection.
+        std::size_t numWells() const
+        {
+            return this->wells_.size();
+        }
+
+        /// Look up well slot by name.
+        ///
+        /// \return Well slot.  Nullopt if no well named \p name exists.
+        std::optional<std::size_t> wellSlot(const std::string& name) const;
+
+        /// Name of well in given slot.
+        const std::string& wellName(const std::size_t slot) const
+        {
+            return this->wellNames_[slot];
+        }
+
+        /// Well level quantities of well in given slot.
+        const WellRecord& well(const std::size_t slot) const
+        {
+            return this->wells_[slot];
+        }
+
+        /// Connection records of all wells.
+        const std::vector<ConnectionRecord>& connections() const
+        {
+            return this->connections_;
+        }
+
+        /// Segment records of all wells.
+        const std::vector<SegmentRecord>& segments() const
+        {
+            return this->segments_;
+        }
+
+        /// Tracer rates of all wells, connections and segments.
+        const std::vector<TracerRecord>& tracerRates() const
+        {
+            return this->tracerRates_;
+        }
+
+        /// Name of tracer referenced by TracerRecord::tracer.
+        const std::string& tracerName(const std::uint32_t tracer) const
+        {
+            return this->tracerNames_[tracer];
+        }
+
+        /// Well level rate of named well.  Counterpart to Wells::get().
+        ///
+        /// \return Rate value.  Zero if the well does not exist or if the
+        ///   rate is not set.
+        double get(const std::string& well_name, const Rates::opt m) const;
+
+        /// Serialise collection into a single byte buffer.
+        ///
+        /// The buffer consists of a header of element counts, the record
+        /// arrays copied verbatim, and the name tables.  It is intended
+        /// for transfer between processes of the same executable, e.g.,
+        /// MPI ranks, and is not a portable file format.
+        std::vector<char> pack() const;
+
+        /// Replace contents by those of a buffer created by pack().
+        ///
+        /// \param[in] data Start of buffer.
+        ///
+        /// \param[in] size Number of bytes in buffer.
+        void unpack(const char* data, const std::size_t size);
+
+        // MessageBufferType API should be similar to Dune::MessageBufferIF
+        template <class MessageBufferType>
+        void write(MessageBufferType& buffer) const
+        {
+            const auto bytes = this->pack();
+            buffer.write(std::string(bytes.begin(), bytes.end()));
+        }
+
+        // MessageBufferType API should be similar to Dune::MessageBufferIF
+        template <class MessageBufferType>
+        void read(MessageBufferType& buffer)
+        {
+            auto bytes = std::string{};
+            buffer.read(bytes);
+            this->unpack(bytes.data(), bytes.size());
+        }
+
+        /// Clear all internal buffers, but preserve allocated capacity.
+        void clear();
+
+    private:
+        std::vector<std::string> wellNames_{};
+        std::unordered_map<std::string, std::size_t> wellSlots_{};
+
+        std::vector<WellRecord> wells_{};
+        std::vector<ConnectionRecord> connections_{};
+        std::vector<SegmentRecord> segments_{};
+
+        std::vector<std::string> tracerNames_{};
+        std::vector<TracerRecord> tracerRates_{};
+
+        RateValues flatten(const Rates& rates,
+                           const Owner owner,
+                           const std::size_t entity,
+                           std::unordered_map<std::string, std::uint32_t>& tracerIndex);
+
+        void restore(const RateValues& values, Rates& rates) const;
+
+        void indexWellNames();
+    };
+
+}} // namespace Opm::data
+
+#endif // OPM_OUTPUT_DATA_FLATWELLS_HPP
@@ -38,6 +38,8 @@
 
 namespace Opm { namespace data {
 
+    class FlatWells;
+
     class Rates {
         /* Methods are defined inline for performance, as the actual *work* done
          * is trivial, but somewhat frequent (typically once per time step per
@@ -166,6 +168,8 @@ namespace Opm { namespace data {
             }
 
         private:
+            friend class FlatWells;
+
             double& get_ref( opt );
             double& get_ref( opt, const std::string& tracer_name );
             const double& get_ref( opt ) const;
@@ -34,27 +34,6 @@ namespace {
 static const std::string FIELD_NAME = std::string{"FIELD"};
 static const std::size_t FIELD_ID   = 0;
 
-std::size_t region_max(const std::unordered_map<std::size_t, double>& region_map)
-{
-    return std::accumulate(region_map.begin(), region_map.end(), std::size_t{0},
-                           [](const std::size_t max, const auto& elm)
-                           {
-                               return std::max(max, elm.first);
-                           });
-}
-
-std::size_t
-phase_region_max(const std::unordered_map<Opm::Inplace::Phase, std::unordered_map<std::size_t, double>>& phase_map)
-{
-    return std::accumulate(phase_map.begin(),
-                           phase_map.end(),
-                           std::size_t{0},
-        [](const std::size_t max, const auto& region_map)
-    {
-        return std::max(max, region_max(region_map.second));
-    });
-}
-
 template <typename Vector>
 Vector append(Vector first, const Vector& second)
 {
@@ -128,7 +107,8 @@ void Inplace::add(const std::string&   region,
                   const std::size_t    region_id,
                   const double         value)
 {
-    this->phase_values[region][phase][region_id] = value;
+    this->regionSet(region).columns[static_cast<std::size_t>(phase)]
+        .set(region_id, value);
 }
 
 void Inplace::add(Inplace::Phase phase, double value)
@@ -140,30 +120,29 @@ double Inplace::get(const std::string&   region,
                     const Inplace::Phase phase,
                     const std::size_t    region_id) const
 {
-    auto region_iter = this->phase_values.find(region);
-    if (region_iter == this->phase_values.end()) {
+    const auto* rset = this->findRegionSet(region);
+    if (rset == nullptr) {
         throw std::logic_error {
             fmt::format("No such region: {}", region)
         };
     }
 
-    auto phase_iter = region_iter->second.find(phase);
-    if (phase_iter == region_iter->second.end()) {
+    const auto& col = rset->columns[static_cast<std::size_t>(phase)];
+    if (col.empty()) {
         throw std::logic_error {
             fmt::format("No such phase: {}:{}",
                         region, static_cast<int>(phase))
         };
     }
 
-    auto value_iter = phase_iter->second.find(region_id);
-    if (value_iter == phase_iter->second.end()) {
+    if (! col.has(region_id)) {
         throw std::logic_error {
             fmt::format("No such region id: {}:{}:{}",
                         region, static_cast<int>(phase), region_id)
         };
     }
 
-    return value_iter->second;
+    return col.value[region_id];
 }
 
 double Inplace::get(Inplace::Phase phase) const
@@ -175,18 +154,10 @@ bool Inplace::has(const std::string& region,
                   const Phase        phase,
                   const std::size_t  region_id) const
 {
-    auto region_iter = this->phase_values.find(region);
-    if (region_iter == this->phase_values.end()) {
-        return false;
-    }
-
-    auto phase_iter = region_iter->second.find(phase);
-    if (phase_iter == region_iter->second.end()) {
-        return false;
-    }
+    const auto* rset = this->findRegionSet(region);
 
-    return phase_iter->second.find(region_id)
-        != phase_iter->second.end();
+    return (rset != nullptr)
+        && rset->columns[static_cast<std::size_t>(phase)].has(region_id);
 }
 
 bool Inplace::has(Phase phase) const
@@ -196,53 +167,94 @@ bool Inplace::has(Phase phase) const
 
 std::size_t Inplace::max_region() const
 {
-    return std::accumulate(this->phase_values.begin(),
-                           this->phase_values.end(),
+    return std::accumulate(this->region_sets_.begin(),
+                           this->region_sets_.end(),
                            std::size_t{0},
-        [](const std::size_t max, const auto& phase_map)
+        [](const std::size_t max, const RegionSet& rset)
     {
-        return std::max(max, phase_region_max(phase_map.second));
+        return std::max(max, rset.max_region());
     });
 }
 
 std::size_t Inplace::max_region(const std::string& region_name) const
 {
-    auto region_iter = this->phase_values.find(region_name);
-    if (region_iter == this->phase_values.end()) {
+    const auto* rset = this->findRegionSet(region_name);
+    if (rset == nullptr) {
         throw std::logic_error {
             fmt::format("No such region: {}", region_name)
         };
     }
 
-    return phase_region_max(region_iter->second);
+    return rset->max_region();
 }
 
 std::vector<double>
 Inplace::get_vector(const std::string& region,
                     const Phase        phase) const
 {
+    const auto& col = this->column(region, phase);
+
     std::vector<double> v(this->max_region(region), 0.0);
+    for (auto region_id = std::size_t{1}; region_id < col.value.size(); ++region_id) {
+        if (col.present[region_id]) {
+            v[region_id - 1] = col.value[region_id];
+        }
+    }
 
-    auto region_iter = this->phase_values.find(region);
-    if (region_iter == this->phase_values.end()) {
-        throw std::logic_error {
-            fmt::format("No such region: {}", region)
-        };
+    return v;
+}
+
+void Inplace::add_vector(const std::string&         region,
+                         const Phase                phase,
+                         const std::vector<double>& values)
+{
+    if (values.empty()) {
+        return;
+    }
+
+    auto& col = this->regionSet(region).columns[static_cast<std::size_t>(phase)];
+
+    if (col.value.size() < values.size() + 1) {
+        col.value.resize(values.size() + 1, 0.0);
+        col.present.resize(values.size() + 1, false);
+    }
+
+    std::copy(values.begin(), values.end(), col.value.begin() + 1);
+    std::fill_n(col.present.begin() + 1, values.size(), true);
+}
+
+double Inplace::sum(const std::string& region, const Phase phase) const
+{
+    const auto& col = this->column(region, phase);
+
+    auto total = 0.0;
+    for (auto region_id = std::size_t{1}; region_id < col.value.size(); ++region_id) {
+        if (col.present[region_id]) {
+            total += col.value[region_id];
+        }
     }
 
-    auto phase_iter = region_iter->second.find(phase);
-    if (phase_iter == region_iter->second.end()) {
+    return total;
+}
+
+std::vector<double>
+Inplace::sum(const std::string& region, const std::vector<Phase>& phases) const
+{
+    const auto* rset = this->findRegionSet(region);
+    if (rset == nullptr) {
         throw std::logic_error {
-            fmt::format("Phase {} does not exist in region {}",
-                        static_cast<int>(phase), region)
+            fmt::format("No such region: {}", region)
         };
     }
 
-    for (const auto& [region_id, value] : phase_iter->second) {
-        v[region_id - 1] = value;
+    auto totals = std::vector<double>(phases.size(), 0.0);
+    for (auto i = 0*phases.size(); i < phases.size(); ++i) {
+        if (! rset->columns[static_cast<std::size_t>(phases[i])].empty()) {
+            totals[i] = this->sum(region, phases[i]);
+        }
     }
 
-    return v;
+    return totals;
 }
 
 const std::vector<Inplace::Phase>& Inplace::phases()
@@ -293,7 +305,111 @@ const std::vector<Inplace::Phase>& Inplace::mixingPhases()
 
 bool Inplace::operator==(const Inplace& rhs) const
 {
-    return this->phase_values == rhs.phase_values;
+    if (this->region_sets_.size() != rhs.region_sets_.size()) {
+        return false;
+    }
+
+    return std::all_of(this->region_sets_.begin(), this->region_sets_.end(),
+                       [&rhs](const RegionSet& rset)
+                       {
+                           const auto* other = rhs.findRegionSet(rset.name);
+                           return (other != nullptr)
+                               && (rset.columns == other->columns);
+                       });
+}
+
+void Inplace::Column::set(const std::size_t region_id, const double x)
+{
+    if (region_id >= this->value.size()) {
+        this->value.resize(region_id + 1, 0.0);
+        this->present.resize(region_id + 1, false);
+    }
+
+    this->value[region_id] = x;
+    this->present[region_id] = true;
+}
+
+bool Inplace::Column::operator==(const Column& that) const
+{
+    const auto n = std::max(this->value.size(), that.value.size());
+    for (auto region_id = 0*n; region_id < n; ++region_id) {
+        const auto has = this->has(region_id);
+        if (has != that.has(region_id)) {
+            return false;
+        }
+
+        if (has && (this->value[region_id] != that.value[region_id])) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+std::size_t Inplace::RegionSet::max_region() const
+{
+    // Columns only grow through assignment, so the last entry of a
+    // non-empty column is always present.
+    return std::accumulate(this->columns.begin(), this->columns.end(),
+                           std::size_t{0},
+                           [](const std::size_t max, const Column& col)
+                           {
+                               return col.empty()
+                                   ? max : std::max(max, col.value.size() - 1);
+                           });
+}
+
+Inplace::RegionSet& Inplace::regionSet(const std::string& region)
+{
+    const auto [pos, inserted] =
+        this->region_set_index_.emplace(region, this->region_sets_.size());
+
+    if (inserted) {
+        auto& rset = this->region_sets_.emplace_back();
+        rset.name = region;
+        rset.columns.resize(NumPhases);
+    }
+
+    return this->region_sets_[pos->second];
+}
+
+const Inplace::RegionSet*
+Inplace::findRegionSet(const std::string& region) const
+{
+    auto pos = this->region_set_index_.find(region);
+
+    return (pos == this->region_set_index_.end())
+        ? nullptr
+        : &this->region_sets_[pos->second];
+}
+
+const Inplace::Column&
+Inplace::column(const std::string& region, const Phase phase) const
+{
+    const auto* rset = this->findRegionSet(region);
+    if (rset == nullptr) {
+        throw std::logic_error {
+            fmt::format("No such region: {}", region)
+        };
+    }
+
+    const auto& col = rset->columns[static_cast<std::size_t>(phase)];
+    if (col.empty()) {
+        throw std::logic_error {
+            fmt::format("Phase {} does not exist in region {}",
+                        static_cast<int>(phase), region)
+        };
+    }
+
+    return col;
+}
+
+void Inplace::rebuildRegionSetIndex()
+{
+    this->region_set_index_.clear();
+    for (auto i = 0*this->region_sets_.size(); i < this->region_sets_.size(); ++i) {
+        this->region_set_index_.emplace(this->region_sets_[i].name, i);
+    }
 }
 
 } // namespace Opm
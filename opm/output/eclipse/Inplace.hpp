@@ -189,6 +189,47 @@ public:
     std::vector<double>
     get_vector(const std::string& region, Phase phase) const;
 
+    /// Assign values of particular quantity in a range of regions of a
+    /// named region set.
+    ///
+    /// Bulk counterpart to add().  Equivalent to calling add() for each
+    /// region ID 1..values.size(), but without per-value lookups.
+    ///
+    /// \param[in] region Region set name such as FIPNUM or FIPABC.
+    ///
+    /// \param[in] phase In-place quantity.
+    ///
+    /// \param[in] values Numerical values of \p phase quantity indexed by
+    ///   (region_number - 1).
+    void add_vector(const std::string&         region,
+                    Phase                      phase,
+                    const std::vector<double>& values);
+
+    /// Total of particular quantity across all regions of a named region
+    /// set.
+    ///
+    /// \param[in] region Region set name, e.g., "FIPNUM" or "FIPABC".
+    ///
+    /// \param[in] phase In-place quantity.
+    ///
+    /// \return Sum of all values of \p phase quantity in region set \p
+    ///   region.  Throws an exception if the region set or quantity does
+    ///   not exist.
+    double sum(const std::string& region, Phase phase) const;
+
+    /// Totals of multiple quantities across all regions of a named region
+    /// set.
+    ///
+    /// \param[in] region Region set name, e.g., "FIPNUM" or "FIPABC".
+    ///
+    /// \param[in] phases In-place quantities.
+    ///
+    /// \return Sum of all values of each quantity in \p phases in region
+    ///   set \p region.  Quantities which have not been assigned in this
+    ///   region set contribute a total of zero.
+    std::vector<double>
+    sum(const std::string& region, const std::vector<Phase>& phases) const;
+
     /// Get iterable list of all quantities which can be handled/updated in
     /// a generic way.
     static const std::vector<Phase>& phases();
@@ -205,7 +246,11 @@ public:
     template<class Serializer>
     void serializeOp(Serializer& serializer)
     {
-        serializer(phase_values);
+        serializer(region_sets_);
+
+        if (! serializer.isSerializing()) {
+            this->rebuildRegionSetIndex();
+        }
     }
 
     /// Equality predicate.
@@ -217,13 +262,68 @@ public:
     bool operator==(const Inplace& rhs) const;
 
 private:
-    using ValueMap = std::unordered_map<std::size_t, double>;
-    using PhaseMap = std::unordered_map<Phase, ValueMap>;
-    using RegionMap = std::unordered_map<std::string, PhaseMap>;
+    /// Number of Phase enumerators.
+    static constexpr std::size_t NumPhases =
+        static_cast<std::size_t>(Phase::CO2MassInGasPhaseMaximumUnTrapped) + 1;
+
+    /// Values of a single quantity in all regions of a single region set.
+    /// Dense storage indexed by region ID.
+    struct Column
+    {
+        /// Numerical values.  Meaningful only where 'present' is set.
+        std::vector<double> value{};
+
+        /// Whether or not a value has been assigned for each region ID.
+        std::vector<bool> present{};
+
+        bool empty() const { return this->value.empty(); }
+
+        bool has(const std::size_t region_id) const
+        {
+            return (region_id < this->present.size()) && this->present[region_id];
+        }
+
+        void set(const std::size_t region_id, const double x);
+
+        bool operator==(const Column& that) const;
+
+        template <class Serializer>
+        void serializeOp(Serializer& serializer)
+        {
+            serializer(this->value);
+            serializer(this->present);
+        }
+    };
+
+    /// All quantities of a single region set, indexed by Phase.
+    struct RegionSet
+    {
+        std::string name{};
+        std::vector<Column> columns{};
+
+        /// Maximum region ID across all quantities.
+        std::size_t max_region() const;
+
+        template <class Serializer>
+        void serializeOp(Serializer& serializer)
+        {
+            serializer(this->name);
+            serializer(this->columns);
+        }
+    };
 
     /// Numerical values of all registered quantities in all registered
-    /// region sets.
-    RegionMap phase_values{};
+    /// region sets, in order of first registration.
+    std::vector<RegionSet> region_sets_{};
+
+    /// Position of each region set in region_sets_.
+    std::unordered_map<std::string, std::size_t> region_set_index_{};
+
+    RegionSet& regionSet(const std::string& region);
+    const RegionSet* findRegionSet(const std::string& region) const;
+    const Column& column(const std::string& region, Phase phase) const;
+
+    void rebuildRegionSetIndex();
 };
 
 } // namespace Opm
@@ -31,7 +31,6 @@
 #include <algorithm>
 #include <cstddef>
 #include <functional>
-#include <map>
 #include <set>
 #include <string>
 #include <vector>
@@ -61,12 +60,20 @@ void Opm::out::RegionCache::buildCache(const std::set<std::string>& fip_regions,
                        return std::cref(fp.get_int(fipReg));
                    });
 
+    auto caches = std::vector<std::reference_wrapper<RegionSetCache>>{};
+    std::transform(fip_regions.begin(), fip_regions.end(),
+                   std::back_inserter(caches),
+                   [this](const auto& fipReg)
+                   {
+                       return std::ref(this->region_sets[fipReg]);
+                   });
+
     for (const auto& wname : schedule.back().well_order()) {
         const auto& conns = schedule.back().wells(wname).getConnections();
         if (conns.empty()) { continue; }
 
         auto regID = regions.begin();
-        for (const auto& fipReg : fip_regions) {
+        for (auto& cache : caches) {
             auto first = true;
 
             for (const auto& conn : conns) {
@@ -75,13 +82,16 @@ void Opm::out::RegionCache::buildCache(const std::set<std::string>& fip_regions,
                 }
 
                 const auto region = regID->get()[grid.activeIndex(conn.global_index())];
-                const auto reg_pair = std::make_pair(fipReg, region);
+                if (region < 0) {
+                    continue;
+                }
 
-                this->connection_map[reg_pair]
+                cache.get().ensureRegion(region);
+                cache.get().connections[region]
                     .emplace_back(wname, conn.global_index());
 
                 if (first) {
-                    this->well_map[reg_pair].push_back(wname);
+                    cache.get().wells[region].push_back(wname);
 
                     first = false;
                 }
@@ -92,27 +102,47 @@ void Opm::out::RegionCache::buildCache(const std::set<std::string>& fip_regions,
     }
 }
 
+void Opm::out::RegionCache::RegionSetCache::ensureRegion(const std::size_t region_id)
+{
+    if (region_id >= this->connections.size()) {
+        this->connections.resize(region_id + 1);
+        this->wells.resize(region_id + 1);
+    }
+}
+
+const Opm::out::RegionCache::RegionSetCache*
+Opm::out::RegionCache::findRegionSet(const std::string& region_name,
+                                     const int          region_id) const
+{
+    auto iter = this->region_sets.find(region_name);
+    if ((iter == this->region_sets.end()) || (region_id < 0) ||
+        (static_cast<std::size_t>(region_id) >= iter->second.connections.size()))
+    {
+        return nullptr;
+    }
+
+    return &iter->second;
+}
+
 
 const std::vector<std::pair<std::string, std::size_t>>&
 Opm::out::RegionCache::connections(const std::string& region_name,
                                    const int          region_id) const
 {
-    const auto key = std::make_pair(region_name, region_id);
-    auto iter = this->connection_map.find(key);
+    const auto* cache = this->findRegionSet(region_name, region_id);
 
-    return (iter == this->connection_map.end())
+    return (cache == nullptr)
         ? this->connections_empty
-        : iter->second;
+        : cache->connections[region_id];
 }
 
 std::vector<std::string>
 Opm::out::RegionCache::wells(const std::string& region_name,
                              const int          region_id) const
 {
-    const auto key = std::make_pair(region_name, region_id);
-    auto iter = this->well_map.find(key);
+    const auto* cache = this->findRegionSet(region_name, region_id);
 
-    return (iter == this->well_map.end())
+    return (cache == nullptr)
         ? std::vector<std::string> {}
-        : iter->second;
+        : cache->wells[region_id];
 }
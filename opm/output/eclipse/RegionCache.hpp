@@ -21,9 +21,10 @@
 #define OPM_REGION_CACHE_HPP
 
 #include <cstddef>
-#include <map>
 #include <set>
 #include <string>
+#include <unordered_map>
+#include <utility>
 #include <vector>
 
 namespace Opm {
@@ -53,12 +54,21 @@ namespace Opm { namespace out {
         std::vector<std::string> wells(const std::string& region_name, int region_id) const;
 
     private:
-        using RegID = std::pair<std::string, int>;            // { Region set, region ID }
         using WellConn = std::pair<std::string, std::size_t>; // { Well name, cell ID }
 
+        // Connections and wells of a single region set, indexed by region ID.
+        struct RegionSetCache
+        {
+            std::vector<std::vector<WellConn>> connections{};
+            std::vector<std::vector<std::string>> wells{};
+
+            void ensureRegion(std::size_t region_id);
+        };
+
         std::vector<WellConn> connections_empty{};
-        std::map<RegID, std::vector<WellConn>> connection_map{};
-        std::map<RegID, std::vector<std::string>> well_map{};
+        std::unordered_map<std::string, RegionSetCache> region_sets{};
+
+        const RegionSetCache* findRegionSet(const std::string& region_name, int region_id) const;
     };
 }} // namespace Opm::out
 
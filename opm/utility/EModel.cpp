@@ -25,11 +25,36 @@
 #include <cstring>
 #include <filesystem>
 #include <iterator>
+#include <numeric>
 #include <string>
 
 using EclEntry = std::tuple<std::string, Opm::EclIO::eclArrType, long int>;
 using ParamEntry = std::tuple<std::string, Opm::EclIO::eclArrType>;
 
+namespace {
+
+    // Number of cells processed by each task when filtering.  Small
+    // enough that a chunk of the mask stays in cache while all filters
+    // are applied to it.
+    constexpr std::size_t filterChunkSize = std::size_t{1} << 14;
+
+    std::size_t numFilterChunks(const std::size_t numCells)
+    {
+        return (numCells + filterChunkSize - 1) / filterChunkSize;
+    }
+
+    template <typename T, typename Predicate>
+    void maskCells(std::uint8_t* mask, const T* values,
+                   const std::size_t begin, const std::size_t end,
+                   Predicate pred)
+    {
+#pragma omp simd
+        for (std::size_t i = begin; i < end; ++i)
+            mask[i] &= static_cast<std::uint8_t>(pred(values[i]));
+    }
+
+} // Anonymous namespace
+
 
 EModel::EModel(const std::string& filename) :
     initfile(filename)
@@ -50,7 +75,7 @@ EModel::EModel(const std::string& filename) :
         throw std::invalid_argument(msg);
     }
 
-    std::vector<int> inteh = initfile.get<int>("INTEHEAD");
+    const auto& inteh = initfile.get<int>("INTEHEAD");
 
     nI = inteh[8];
     nJ = inteh[9];
@@ -69,9 +94,9 @@ EModel::EModel(const std::string& filename) :
     J.reserve(nActive);
     K.reserve(nActive);
 
-    ActFilter.resize(nActive, true);
+    ActFilter.resize(nActive, 1);
 
-    std::vector<float> porv_all = initfile.get<float>("PORV");
+    const auto& porv_all = initfile.get<float>("PORV");
 
     int n = 0;
 
@@ -143,6 +168,9 @@ void EModel::setReportStep(int rstep)
     if (!rstfile.has_value())
         throw std::runtime_error("Not able to set report step since restart file not found");
 
+    // Filters on solution parameters refer to the current report step.
+    applyPendingFilters();
+
     initSolutionData(rstep);
 }
 
@@ -195,10 +223,13 @@ void EModel::get_cell_volumes_from_grid()
         throw std::runtime_error(message);
     }
 
-    CELLVOL.clear();
+    CELLVOL.resize(nActive);
+
+    const auto& egrid = *grid;
 
-    for (size_t n = 0;n < nActive; n++)
-        CELLVOL.push_back(grid->getCellVolume(I[n]-1, J[n]-1, K[n]-1));
+#pragma omp parallel for schedule(static)
+    for (size_t n = 0; n < nActive; n++)
+        CELLVOL[n] = egrid.getCellVolume(I[n]-1, J[n]-1, K[n]-1);
 
     celVolCalculated = true;
 }
@@ -222,7 +253,12 @@ std::vector<ParamEntry> EModel::getListOfParameters() const
 
 int EModel::getNumberOfActiveCells()
 {
-    return std::count(ActFilter.begin(), ActFilter.end(), true);
+    applyPendingFilters();
+
+    if (filterIndexValid)
+        return filterIndex.size();
+
+    return std::count(ActFilter.begin(), ActFilter.end(), std::uint8_t{1});
 }
 
 bool EModel::hasInitParameter(const std::string &name) const
@@ -255,54 +291,161 @@ bool EModel::hasReportStep(int rstep)
 void EModel::resetFilter()
 {
     activeFilter=false;
-    std::fill(ActFilter.begin(), ActFilter.end(), true);
+    pendingFilters.clear();
+    filterIndexValid = false;
+    std::fill(ActFilter.begin(), ActFilter.end(), std::uint8_t{1});
+}
+
+
+EModel::FilterOp EModel::filterOperator(const std::string& opperator, const bool twoValues)
+{
+    if (twoValues) {
+        if ((opperator == "in") || (opperator == "between"))
+            return FilterOp::Between;
+
+    } else {
+        if ((opperator == "eq") || (opperator == "=="))
+            return FilterOp::Equal;
+        else if ((opperator == "lt") || (opperator == "<"))
+            return FilterOp::Less;
+        else if ((opperator == "gt") || (opperator == ">"))
+            return FilterOp::Greater;
+    }
+
+    const std::string message =
+        fmt::format("Unknown operator {} used to set filter", opperator);
+    throw std::invalid_argument(message);
 }
 
 
 template <typename T>
-void EModel::updateActiveFilter(const std::vector<T>& paramVect, const std::string& opperator, T value)
+void EModel::updateActiveFilter(const std::string& param, const FilterOp op, T value1, T value2)
 {
-    if ((opperator == "eq") || (opperator == "==")){
-       for (size_t i = 0; i < paramVect.size(); i++)
-            if ((ActFilter[i]) && (paramVect[i] != value))
-                ActFilter[i] = false;
+    pendingFilters.emplace_back([param, op, value1, value2](EModel& model) -> FilterKernel
+    {
+        const T* values = model.get_filter_param<T>(param).data();
+
+        return [values, op, value1, value2](std::uint8_t* mask, std::size_t begin, std::size_t end)
+        {
+            // Predicates are negations of the rejection criteria, so that
+            // NaN values are treated as before.
+            switch (op) {
+            case FilterOp::Equal:
+                maskCells(mask, values, begin, end, [value1](const T v) { return !(v != value1); });
+                break;
+            case FilterOp::Less:
+                maskCells(mask, values, begin, end, [value1](const T v) { return !(v >= value1); });
+                break;
+            case FilterOp::Greater:
+                maskCells(mask, values, begin, end, [value1](const T v) { return !(v <= value1); });
+                break;
+            case FilterOp::Between:
+                maskCells(mask, values, begin, end, [value1, value2](const T v)
+                          { return !((v <= value1) || (v >= value2)); });
+                break;
+            }
+        };
+    });
 
-    } else if ((opperator=="lt") || (opperator=="<")) {
-        for (size_t i = 0; i < paramVect.size(); i++)
-            if ((ActFilter[i]) && (paramVect[i] >= value))
-                ActFilter[i] = false;
+    activeFilter = true;
+    filterIndexValid = false;
+}
 
-    } else if ((opperator == "gt") || (opperator == ">")){
-        for (size_t i = 0; i < paramVect.size(); i++)
-            if ((ActFilter[i]) && (paramVect[i] <= value))
-                ActFilter[i] = false;
 
-    } else {
-        const std::string message =
-            fmt::format("Unknown operator {} used to set filter", opperator);
-        throw std::invalid_argument(message);
+void EModel::applyPendingFilters()
+{
+    if (pendingFilters.empty())
+        return;
+
+    std::vector<FilterKernel> kernels;
+    kernels.reserve(pendingFilters.size());
+
+    for (const auto& filter : pendingFilters)
+        kernels.push_back(filter(*this));
+
+    pendingFilters.clear();
+
+    const auto numCells = ActFilter.size();
+    const auto numChunks = numFilterChunks(numCells);
+    auto* mask = ActFilter.data();
+
+#pragma omp parallel for schedule(static)
+    for (std::size_t chunk = 0; chunk < numChunks; ++chunk) {
+        const auto begin = chunk * filterChunkSize;
+        const auto end = std::min(begin + filterChunkSize, numCells);
+
+        for (const auto& kernel : kernels)
+            kernel(mask, begin, end);
     }
 
-    activeFilter = true;
+    filterIndexValid = false;
 }
 
-template <typename T>
-void EModel::updateActiveFilter(const std::vector<T>& paramVect, const std::string& opperator, T value1, T value2)
+
+const std::vector<std::size_t>& EModel::activeCells()
 {
-    if ((opperator == "in") || (opperator == "between")) {
-        for (size_t i = 0; i < paramVect.size(); i++)
-            if ((ActFilter[i]) && ((paramVect[i] <= value1) || (paramVect[i] >= value2)))
-                ActFilter[i] = false;
+    applyPendingFilters();
 
-    } else {
-        const std::string message =
-            fmt::format("Unknown operator {} used to set filter", opperator);
-        throw std::invalid_argument(message);
+    if (filterIndexValid)
+        return filterIndex;
+
+    const auto numCells = ActFilter.size();
+    const auto numChunks = numFilterChunks(numCells);
+    const auto* mask = ActFilter.data();
+
+    // Number of active cells before each chunk.
+    std::vector<std::size_t> offset(numChunks + 1, 0);
+
+#pragma omp parallel for schedule(static)
+    for (std::size_t chunk = 0; chunk < numChunks; ++chunk) {
+        const auto begin = chunk * filterChunkSize;
+        const auto end = std::min(begin + filterChunkSize, numCells);
+
+        std::size_t count = 0;
+#pragma omp simd reduction(+:count)
+        for (std::size_t i = begin; i < end; ++i)
+            count += mask[i];
+
+        offset[chunk + 1] = count;
     }
 
-    activeFilter = true;
+    std::partial_sum(offset.begin(), offset.end(), offset.begin());
+
+    filterIndex.resize(offset.back());
+
+#pragma omp parallel for schedule(static)
+    for (std::size_t chunk = 0; chunk < numChunks; ++chunk) {
+        const auto begin = chunk * filterChunkSize;
+        const auto end = std::min(begin + filterChunkSize, numCells);
+
+        auto pos = offset[chunk];
+        for (std::size_t i = begin; i < end; ++i)
+            if (mask[i])
+                filterIndex[pos++] = i;
+    }
+
+    filterIndexValid = true;
+
+    return filterIndex;
 }
 
+
+template <typename T>
+const std::vector<T>& EModel::filteredParam(const std::vector<T>& param, std::vector<T>& result)
+{
+    const auto& index = activeCells();
+    const auto numActive = index.size();
+
+    result.resize(numActive);
+
+#pragma omp parallel for simd schedule(static)
+    for (std::size_t n = 0; n < numActive; ++n)
+        result[n] = param[index[n]];
+
+    return result;
+}
+
+
 template <typename T>
 const std::vector<T>& EModel::get_filter_param(const std::string& param)
 {
@@ -347,30 +490,30 @@ const std::vector<T>& EModel::get_filter_param(const std::string& param)
 template <>
 void EModel::addFilter<int>(const std::string& param1, const std::string& opperator, int num)
 {
-    std::vector<int> paramVect = get_filter_param<int>(param1);
-    updateActiveFilter(paramVect, opperator, num);
+    get_filter_param<int>(param1);
+    updateActiveFilter(param1, filterOperator(opperator, false), num, num);
 }
 
 template <>
 void EModel::addFilter<int>(const std::string& param1, const std::string& opperator, int num1, int num2)
 {
-    std::vector<int> paramVect = get_filter_param<int>(param1);;
-    updateActiveFilter(paramVect, opperator, num1, num2);
+    get_filter_param<int>(param1);
+    updateActiveFilter(param1, filterOperator(opperator, true), num1, num2);
 }
 
 template <>
 void EModel::addFilter<float>(const std::string& param1, const std::string& opperator, float num)
 {
-    std::vector<float> paramVect = get_filter_param<float>(param1);
-    updateActiveFilter(paramVect, opperator, num);
+    get_filter_param<float>(param1);
+    updateActiveFilter(param1, filterOperator(opperator, false), num, num);
 }
 
 
 template <>
 void EModel::addFilter<float>(const std::string& param1, const std::string& opperator, float num1, float num2)
 {
-    std::vector<float> paramVect = get_filter_param<float>(param1);
-    updateActiveFilter(paramVect, opperator, num1, num2);
+    get_filter_param<float>(param1);
+    updateActiveFilter(param1, filterOperator(opperator, true), num1, num2);
 }
 
 
@@ -381,17 +524,26 @@ void EModel::addHCvolFilter()
                                  "function setDepthfwl before using "
                                  "filter HC filter");
 
-    auto eqlnum = initfile.get<int>("EQLNUM");
-    auto depth = initfile.get<float>("DEPTH");
-    activeFilter = true;
+    initfile.get<int>("EQLNUM");
+    initfile.get<float>("DEPTH");
+
+    pendingFilters.emplace_back([fwl = FreeWaterlevel](EModel& model) -> FilterKernel
+    {
+        const int* eqlnum = model.initfile.get<int>("EQLNUM").data();
+        const float* depth = model.initfile.get<float>("DEPTH").data();
 
-    for (size_t n = 0; n < eqlnum.size();n++){
-        int eql = eqlnum[n];
-        float fwl = FreeWaterlevel[eql-1];
+        return [eqlnum, depth, fwl](std::uint8_t* mask, std::size_t begin, std::size_t end)
+        {
+            const float* level = fwl.data();
 
-        if ((ActFilter[n]) && (depth[n] > fwl))
-            ActFilter[n] = false;
-    }
+#pragma omp simd
+            for (std::size_t n = begin; n < end; ++n)
+                mask[n] &= static_cast<std::uint8_t>(!(depth[n] > level[eqlnum[n] - 1]));
+        };
+    });
+
+    activeFilter = true;
+    filterIndexValid = false;
 }
 
 
@@ -399,14 +551,8 @@ template <>
 const std::vector<float>& EModel::getParam<float>(const std::string& name)
 {
     if (activeFilter) {
-        std::vector<float> param = get_filter_param<float>(name);
-        filteredFloatVect.clear();
 
-        for (size_t i = 0; i < param.size(); i++)
-            if (ActFilter[i])
-                filteredFloatVect.push_back(param[i]);
-
-        return filteredFloatVect;
+        return filteredParam(get_filter_param<float>(name), filteredFloatVect);
 
     } else {
 
@@ -419,14 +565,8 @@ template <>
 const std::vector<int>& EModel::getParam<int>(const std::string& name)
 {
     if (activeFilter) {
-        std::vector<int> param = get_filter_param<int>(name);
-        filteredIntVect.clear();
-
-        for (size_t i = 0; i < param.size(); i++)
-            if (ActFilter[i])
-                filteredIntVect.push_back(param[i]);
 
-        return filteredIntVect;
+        return filteredParam(get_filter_param<int>(name), filteredIntVect);
 
     } else {
 
@@ -465,7 +605,7 @@ void EModel::setDepthfwl(const std::vector<float>& fwl)
     nEqlnum = fwl.size();
     FreeWaterlevel = fwl;
 
-    std::vector<int> eqlnum = initfile.get<int>("EQLNUM");
+    const auto& eqlnum = initfile.get<int>("EQLNUM");
     std::vector<int>::const_iterator it = max_element(eqlnum.begin(), eqlnum.end());
     int maxEqlnum = *it;
 
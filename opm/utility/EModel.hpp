@@ -25,10 +25,15 @@
 
 #include <opm/input/eclipse/EclipseState/Grid/EclipseGrid.hpp>
 
-#include <string>
-#include <vector>
+#include <cstddef>
+#include <cstdint>
 #include <ctime>
+#include <functional>
 #include <map>
+#include <optional>
+#include <string>
+#include <tuple>
+#include <vector>
 
 
 class EModel
@@ -83,7 +88,21 @@ private:
     std::vector<float> PORV;
     std::vector<float> CELLVOL;
     std::vector<int> I, J, K;
-    std::vector<bool> ActFilter;
+
+    // One byte per active cell, non-zero if the cell passes all filters.
+    std::vector<std::uint8_t> ActFilter;
+
+    // Filters are not evaluated when added, but collected and applied in
+    // a single pass over ActFilter when the result is needed.  Each entry
+    // resolves its parameter and returns a kernel which updates the cells
+    // [begin, end) of the mask.
+    using FilterKernel = std::function<void(std::uint8_t* mask, std::size_t begin, std::size_t end)>;
+    std::vector<std::function<FilterKernel(EModel&)>> pendingFilters;
+
+    // Indices of cells passing the filter.  Rebuilt on first use after
+    // the filter changes.
+    std::vector<std::size_t> filterIndex;
+    bool filterIndexValid = false;
 
     Opm::EclIO::EclFile initfile;
     std::optional<Opm::EclipseGrid> grid;
@@ -116,11 +135,18 @@ private:
     template <typename T>
     const std::vector<T>& get_filter_param(const std::string& param1);
 
+    enum class FilterOp { Equal, Less, Greater, Between };
+
+    static FilterOp filterOperator(const std::string& opperator, bool twoValues);
+
     template <typename T>
-    void updateActiveFilter(const std::vector<T>& paramVect, const std::string& opperator, T value);
+    void updateActiveFilter(const std::string& param, FilterOp op, T value1, T value2);
+
+    void applyPendingFilters();
+    const std::vector<std::size_t>& activeCells();
 
     template <typename T>
-    void updateActiveFilter(const std::vector<T>& paramVect, const std::string& opperator, T value1, T value2);
+    const std::vector<T>& filteredParam(const std::vector<T>& param, std::vector<T>& result);
 
 };
 
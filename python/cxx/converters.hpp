@@ -2,6 +2,9 @@
 #define SUNBEAM_CONVERTERS_HPP
 
 #include <sstream>
+#include <type_traits>
+#include <utility>
+#include <vector>
 #include <pybind11/pybind11.h>
 #include <pybind11/numpy.h>
 
@@ -48,6 +51,25 @@ py::array_t<T> numpy_array(const std::vector<T>& input) {
     return output;
 }
 
+// Takes ownership of the elements of 'input' instead of copying them.
+template <class T, std::enable_if_t<!std::is_same_v<T, bool>, int> = 0>
+py::array_t<T> numpy_array(std::vector<T>&& input) {
+    auto* data = new std::vector<T>(std::move(input));
+    py::capsule owner(data, [](void* p) { delete static_cast<std::vector<T>*>(p); });
+
+    return py::array_t<T>(data->size(), data->data(), owner);
+}
+
+// Read-only view of 'input', which must be kept alive and unchanged by
+// the Python object 'owner'.  The view keeps 'owner' alive.
+template <class T>
+py::array_t<T> numpy_view(const std::vector<T>& input, py::handle owner) {
+    auto output = py::array_t<T>(input.size(), input.data(), owner);
+    output.attr("setflags")(py::arg("write") = false);
+
+    return output;
+}
+
 }
 
 #endif //SUNBEAM_CONVERTERS_HPP
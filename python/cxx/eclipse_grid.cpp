@@ -52,7 +52,7 @@ namespace {
         for (size_t n = 0; n < nCells; n++)
             cellVol.push_back(grid.getCellVolume(n));
         
-        return convert::numpy_array(cellVol);
+        return convert::numpy_array(std::move(cellVol));
     }
 
     py::array cellVolumeMask( const EclipseGrid& grid, std::vector<int>& mask)
@@ -69,7 +69,7 @@ namespace {
             if (mask[n]==1)
                 cellVol[n] = grid.getCellVolume(n);
                 
-        return convert::numpy_array(cellVol);
+        return convert::numpy_array(std::move(cellVol));
     }
     
     double cellDepth1G( const EclipseGrid& grid, size_t glob_idx) {
@@ -90,7 +90,7 @@ namespace {
         for (size_t n = 0; n < nCells; n++)
             cellDepth.push_back(grid.getCellDepth(n));
         
-        return convert::numpy_array(cellDepth);
+        return convert::numpy_array(std::move(cellDepth));
     }
 
     py::array cellDepthMask( const EclipseGrid& grid, std::vector<int>& mask)
@@ -107,7 +107,7 @@ namespace {
             if (mask[n]==1)
                 cellDepth[n] = grid.getCellDepth(n);
                 
-        return convert::numpy_array(cellDepth);
+        return convert::numpy_array(std::move(cellDepth));
     }
 }
 
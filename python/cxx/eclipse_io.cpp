@@ -70,12 +70,12 @@ public:
             return m_ext_esmry->numberOfTimeSteps();
     }
 
-    py::array get_smry_vector(const std::string& key)
+    const std::vector<float>& get_smry_vector(const std::string& key)
     {
         if (m_esmry != nullptr)
-            return convert::numpy_array( m_esmry->get(key) );
+            return m_esmry->get(key);
         else
-            return convert::numpy_array( m_ext_esmry->get(key) );
+            return m_ext_esmry->get(key);
     }
 
     py::array get_smry_vector_at_rsteps(const std::string& key)
@@ -154,6 +154,12 @@ private:
 
 
 
+py::array get_smry_vector(py::object self, const std::string& key)
+{
+    return convert::numpy_view(self.cast<ESmryBind&>().get_smry_vector(key), self);
+}
+
+
 class EclOutputBind {
 
 public:
@@ -188,18 +194,19 @@ private:
 };
 
 
-npArray get_vector_index(Opm::EclIO::EclFile * file_ptr, std::size_t array_index)
+npArray get_vector_index(py::object self, std::size_t array_index)
 {
+    auto * file_ptr = self.cast<Opm::EclIO::EclFile *>();
     auto array_type = std::get<1>(file_ptr->getList()[array_index]);
 
     if (array_type == Opm::EclIO::INTE)
-        return std::make_tuple (convert::numpy_array( file_ptr->get<int>(array_index)), array_type);
+        return std::make_tuple (convert::numpy_view( file_ptr->get<int>(array_index), self), array_type);
 
     if (array_type == Opm::EclIO::REAL)
-        return std::make_tuple (convert::numpy_array( file_ptr->get<float>(array_index)), array_type);
+        return std::make_tuple (convert::numpy_view( file_ptr->get<float>(array_index), self), array_type);
 
     if (array_type == Opm::EclIO::DOUB)
-        return std::make_tuple (convert::numpy_array( file_ptr->get<double>(array_index)), array_type);
+        return std::make_tuple (convert::numpy_view( file_ptr->get<double>(array_index), self), array_type);
 
     if (array_type == Opm::EclIO::LOGI)
         return std::make_tuple (convert::numpy_array( file_ptr->get<bool>(array_index)), array_type);
@@ -226,26 +233,30 @@ size_t get_array_index(const std::vector<EclEntry>& array_list, const std::strin
     return std::distance(array_list.begin(), it);
 }
 
-npArray get_vector_name(Opm::EclIO::EclFile * file_ptr, const std::string& array_name)
+npArray get_vector_name(py::object self, const std::string& array_name)
 {
+    auto * file_ptr = self.cast<Opm::EclIO::EclFile *>();
+
     if (file_ptr->hasKey(array_name) == false)
         throw std::logic_error("Array " + array_name + " not found in EclFile");
 
     auto array_list = file_ptr->getList();
     size_t array_index = get_array_index(array_list, array_name, 0);
 
-    return get_vector_index(file_ptr, array_index);
+    return get_vector_index(self, array_index);
 }
 
-npArray get_vector_occurrence(Opm::EclIO::EclFile * file_ptr, const std::string& array_name, size_t occurrence)
+npArray get_vector_occurrence(py::object self, const std::string& array_name, size_t occurrence)
 {
+    auto * file_ptr = self.cast<Opm::EclIO::EclFile *>();
+
     if (occurrence >= file_ptr->count(array_name) )
         throw std::logic_error("Occurrence " + std::to_string(occurrence) + " not found in EclFile");
 
     auto array_list = file_ptr->getList();
     size_t array_index = get_array_index(array_list, array_name, occurrence);
 
-    return get_vector_index(file_ptr, array_index);
+    return get_vector_index(self, array_index);
 }
 
 bool erst_contains(Opm::EclIO::ERst * file_ptr, std::tuple<std::string, int> keyword)
@@ -254,8 +265,9 @@ bool erst_contains(Opm::EclIO::ERst * file_ptr, std::tuple<std::string, int> key
     return hasKeyAtReport;
 }
 
-npArray get_erst_by_index(Opm::EclIO::ERst * file_ptr, size_t index, size_t rstep)
+npArray get_erst_by_index(py::object self, size_t index, size_t rstep)
 {
+    auto * file_ptr = self.cast<Opm::EclIO::ERst *>();
     auto arrList = file_ptr->listOfRstArrays(rstep);
 
     if (index >=arrList.size())
@@ -264,13 +276,13 @@ npArray get_erst_by_index(Opm::EclIO::ERst * file_ptr, size_t index, size_t rste
     auto array_type = std::get<1>(arrList[index]);
 
     if (array_type == Opm::EclIO::INTE)
-        return std::make_tuple (convert::numpy_array( file_ptr->getRestartData<int>(index, rstep)), array_type);
+        return std::make_tuple (convert::numpy_view( file_ptr->getRestartData<int>(index, rstep), self), array_type);
 
     if (array_type == Opm::EclIO::REAL)
-        return std::make_tuple (convert::numpy_array( file_ptr->getRestartData<float>(index, rstep)), array_type);
+        return std::make_tuple (convert::numpy_view( file_ptr->getRestartData<float>(index, rstep), self), array_type);
 
     if (array_type == Opm::EclIO::DOUB)
-        return std::make_tuple (convert::numpy_array( file_ptr->getRestartData<double>(index, rstep)), array_type);
+        return std::make_tuple (convert::numpy_view( file_ptr->getRestartData<double>(index, rstep), self), array_type);
 
     if (array_type == Opm::EclIO::LOGI)
         return std::make_tuple (convert::numpy_array( file_ptr->getRestartData<bool>(index, rstep)), array_type);
@@ -282,8 +294,10 @@ npArray get_erst_by_index(Opm::EclIO::ERst * file_ptr, size_t index, size_t rste
 }
 
 
-npArray get_erst_vector(Opm::EclIO::ERst * file_ptr, const std::string& key, size_t rstep, size_t occurrence)
+npArray get_erst_vector(py::object self, const std::string& key, size_t rstep, size_t occurrence)
 {
+    auto * file_ptr = self.cast<Opm::EclIO::ERst *>();
+
     if (occurrence >= static_cast<size_t>(file_ptr->occurrence_count(key, rstep)))
         throw std::out_of_range("file have less than " + std::to_string(occurrence + 1) + " arrays in selected report step");
 
@@ -291,7 +305,7 @@ npArray get_erst_vector(Opm::EclIO::ERst * file_ptr, const std::string& key, siz
 
     size_t array_index = get_array_index(array_list, key, occurrence);
 
-    return get_erst_by_index(file_ptr, array_index, rstep);
+    return get_erst_by_index(self, array_index, rstep);
 }
 
 std::tuple<std::array<double,8>, std::array<double,8>, std::array<double,8>>
@@ -360,7 +374,7 @@ py::array get_cellvolumes_mask(Opm::EclIO::EGrid * file_ptr, std::vector<int> ma
         }
     }
 
-    return convert::numpy_array( celvol );
+    return convert::numpy_array( std::move(celvol) );
 }
 
 py::array get_cellvolumes(Opm::EclIO::EGrid * file_ptr)
@@ -482,7 +496,7 @@ void python::common::export_IO(py::module& m) {
         .def("__contains__", &ESmryBind::hasKey, py::arg("key"), ESmry_contains_docstring)
         .def("make_esmry_file", &ESmryBind::make_esmry_file, ESmry_make_esmry_file_docstring)
         .def("__len__", &ESmryBind::numberOfTimeSteps, ESmry_len_docstring)
-        .def("__get_all", &ESmryBind::get_smry_vector, py::arg("key"), ESmry_get_all_docstring)
+        .def("__get_all", &get_smry_vector, py::arg("key"), ESmry_get_all_docstring)
         .def("__get_at_rstep", &ESmryBind::get_smry_vector_at_rsteps, py::arg("key"), ESmry_get_at_rstep_docstring)
         .def_property_readonly("start_date", &ESmryBind::smry_start_date, ESmry_start_date_docstring)
         .def("keys", (const std::vector<std::string>& (ESmryBind::*) (void) const)
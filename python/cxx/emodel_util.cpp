@@ -47,11 +47,9 @@ py::array get_param(EModel * file_ptr, std::string key)
     Opm::EclIO::eclArrType arrType = getArrayType(file_ptr, key);
 
     if (arrType == Opm::EclIO::REAL){
-        std::vector<float> vect = file_ptr->getParam<float>(key);
-        return py::array(py::dtype("f"), {vect.size()}, {}, &vect[0]);
+        return convert::numpy_array(file_ptr->getParam<float>(key));
     } else if (arrType == Opm::EclIO::INTE){
-        std::vector<int> vect = file_ptr->getParam<int>(key);
-        return py::array(py::dtype("i"), {vect.size()}, {}, &vect[0]);
+        return convert::numpy_array(file_ptr->getParam<int>(key));
     } else
         throw std::logic_error("Data type not supported");
 }
@@ -18,27 +18,32 @@ namespace {
         return false;
     }
 
-    py::array_t<double> get_double_array(const FieldPropsManager& m, const std::string& kw) {
+    // The arrays are read-only views of the manager's data, and keep the
+    // manager alive.
+    py::array_t<double> get_double_array(py::object self, const std::string& kw) {
+        const auto& m = self.cast<const FieldPropsManager&>();
         if (m.has_double(kw))
-            return convert::numpy_array( m.get_double(kw) );
+            return convert::numpy_view( m.get_double(kw), self );
         else
             throw std::invalid_argument("Keyword '" + kw + "'is not of type double.");
     }
 
-    py::array_t<int> get_int_array(const FieldPropsManager& m, const std::string& kw) {
+    py::array_t<int> get_int_array(py::object self, const std::string& kw) {
+        const auto& m = self.cast<const FieldPropsManager&>();
         if (m.has_int(kw))
-            return convert::numpy_array( m.get_int(kw) );
+            return convert::numpy_view( m.get_int(kw), self );
         else
             throw std::invalid_argument("Keyword '" + kw + "'is not of type int.");
     }
 
 
-    py::array get_array(const FieldPropsManager& m, const std::string& kw) {
+    py::array get_array(py::object self, const std::string& kw) {
+        const auto& m = self.cast<const FieldPropsManager&>();
         if (m.has_double(kw))
-            return convert::numpy_array(m.get_double(kw));
+            return convert::numpy_view(m.get_double(kw), self);
 
         if (m.has_int(kw))
-            return convert::numpy_array(m.get_int(kw));
+            return convert::numpy_view(m.get_int(kw), self);
 
         throw std::invalid_argument("No such keyword: " + kw);
     }
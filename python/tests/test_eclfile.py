@@ -61,6 +61,20 @@ class TestEclFile(unittest.TestCase):
         for val1, val2 in zip(test1, test2):
             self.assertEqual(val1, val2)
 
+    def test_get_function_view(self):
+
+        file1 = EclFile(test_path("data/SPE9.INIT"))
+        porv = file1["PORV"]
+        ref = np.array(porv)
+
+        self.assertFalse(porv.flags.writeable)
+        with self.assertRaises(ValueError):
+            porv[0] = 0.0
+
+        # The array keeps the file object alive.
+        del file1
+        self.assertTrue(np.array_equal(porv, ref))
+
     def test_get_function_float(self):
 
         file1 = EclFile(test_path("data/SPE9.INIT"))
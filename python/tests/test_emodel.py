@@ -160,6 +160,11 @@ class TestEModel(unittest.TestCase):
 
         porv = mod1.get("PORV")
         self.assertEqual(len(porv), nAct_hc_eqln1 + nAct_hc_eqln2)
+        self.assertEqual(mod1.active_cells(), nAct_hc_eqln1 + nAct_hc_eqln2)
+
+        # Repeated queries with the same filter reuse the active cell index.
+        self.assertTrue(np.array_equal(mod1.get("PORV"), porv))
+        self.assertEqual(len(mod1.get("DEPTH")), len(porv))
 
         mod1.reset_filter()
         mod1.add_filter("EQLNUM","eq", 1);
@@ -47,6 +47,11 @@ class TestFieldProps(unittest.TestCase):
         self.assertEqual(324, len(px))
         self.assertEqual(324, len(p.get_int_array('ACTNUM')))
 
+    def test_array_view(self):
+        poro = self.props.get_double_array('PORO')
+        self.assertFalse(poro.flags.writeable)
+        self.assertTrue(np.array_equal(poro, self.props['PORO']))
+
     def test_permx_values(self):
         def md2si(md):
             #millidarcy->SI
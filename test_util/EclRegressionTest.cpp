@@ -31,10 +31,13 @@
 #include <opm/output/eclipse/RestartIO.hpp>
 
 #include <opm/common/ErrorMacros.hpp>
+#include <opm/common/utility/ConcurrentTasks.hpp>
 #include <opm/common/utility/numeric/cmp.hpp>
 
 #include <algorithm>
+#include <atomic>
 #include <cmath>
+#include <cstddef>
 #include <filesystem>
 #include <fstream>
 #include <iomanip>
@@ -63,6 +66,98 @@ std::vector<T> sorted(std::vector<T> v) {
     return v;
 }
 
+template <typename T>
+std::size_t arrayBytes(const std::vector<T>& v) {
+    return v.size() * sizeof(T);
+}
+
+std::size_t arrayBytes(const std::vector<std::string>& v) {
+    std::size_t bytes = 0;
+    for (const auto& s : v) {
+        bytes += s.size();
+    }
+    return bytes;
+}
+
+// Number of values in each chunk when scanning floating point arrays.
+constexpr std::size_t deviationChunkSize = std::size_t{1} << 16;
+
+struct DeviationTolerance {
+    double abs;
+    double rel;
+    bool allowNegatives;
+};
+
+// Whether or not two values fail the checks of deviationsForCell(),
+// without side effects.  Written without branches such that the chunk
+// scan below is vectorised.
+inline bool exceedsTolerance(double val1, double val2, const DeviationTolerance& tol)
+{
+    const bool neg1 = !tol.allowNegatives & (val1 < 0);
+    const bool neg2 = !tol.allowNegatives & (val2 < 0);
+    const bool negFail = (neg1 & (std::abs(val1) > tol.abs)) |
+                         (neg2 & (std::abs(val2) > tol.abs));
+
+    val1 = neg1 ? 0.0 : val1;
+    val2 = neg2 ? 0.0 : val2;
+
+    // Same as calculateDeviations(), with -1 denoting no deviation.
+    const bool anyNonZero = (val1 != 0) | (val2 != 0);
+    const bool bothNonZero = (val1 != 0) & (val2 != 0);
+    const double devAbs = anyNonZero ? std::abs(val1 - val2) : -1.0;
+    const double devRel = bothNonZero ? devAbs / std::max(std::abs(val1), std::abs(val2)) : -1.0;
+
+    return negFail | ((devAbs > tol.abs) & ((devRel > tol.rel) | (devRel == -1.0)));
+}
+
+// Chunks, in increasing order, which contain at least one pair of values
+// failing the tolerance checks.  Chunks are scanned in parallel.  If
+// 'firstOnly' is set, chunks after the first failing chunk may be skipped.
+template <typename T>
+std::vector<std::size_t> failingChunks(const std::vector<T>& t1, const std::vector<T>& t2,
+                                       const DeviationTolerance& tol, bool firstOnly)
+{
+    const std::size_t size = std::min(t1.size(), t2.size());
+    const std::size_t numChunks = (size + deviationChunkSize - 1) / deviationChunkSize;
+
+    std::vector<char> failed(numChunks, 0);
+    std::atomic<std::size_t> firstFailed{numChunks};
+
+#pragma omp parallel for schedule(dynamic)
+    for (std::size_t chunk = 0; chunk < numChunks; ++chunk) {
+        if (firstOnly && (chunk > firstFailed.load(std::memory_order_relaxed))) {
+            continue;
+        }
+
+        const std::size_t begin = chunk * deviationChunkSize;
+        const std::size_t end = std::min(begin + deviationChunkSize, size);
+
+        int fail = 0;
+#pragma omp simd reduction(|:fail)
+        for (std::size_t i = begin; i < end; ++i) {
+            fail |= exceedsTolerance(static_cast<double>(t1[i]), static_cast<double>(t2[i]), tol);
+        }
+
+        if (fail) {
+            failed[chunk] = 1;
+
+            auto first = firstFailed.load(std::memory_order_relaxed);
+            while ((chunk < first) &&
+                   !firstFailed.compare_exchange_weak(first, chunk, std::memory_order_relaxed))
+            {}
+        }
+    }
+
+    std::vector<std::size_t> chunks;
+    for (std::size_t chunk = 0; chunk < numChunks; ++chunk) {
+        if (failed[chunk]) {
+            chunks.push_back(chunk);
+        }
+    }
+
+    return chunks;
+}
+
 }
 
 using namespace Opm::EclIO;
@@ -124,11 +219,42 @@ void ECLRegressionTest::compareFloatingPointVectors(const std::vector<T>& t1, co
     it = std::find(keywordsStrictTol.begin(), keywordsStrictTol.end(), keyword);
     bool strictTol = it != keywordsStrictTol.end() ? true : false;
 
-    for (size_t i = 0; i < t1.size(); i++) {
-        deviationsForCell(static_cast<double>(t1[i]),
-                          static_cast<double>(t2[i]),
-                          keyword, reference, t1.size(),
-                          i, allowNegatives, strictTol);
+    numBytesCompared += arrayBytes(t1) + arrayBytes(t2);
+
+    // Same tolerances as in deviationsForCell().
+    const DeviationTolerance tol {
+        strictTol ? strictAbsTol : getAbsTolerance(),
+        strictTol ? strictAbsTol : getRelTolerance(),
+        allowNegatives
+    };
+
+    // Scan the arrays in parallel and only hand the chunks which contain
+    // deviations to deviationsForCell(), in order, for reporting.  Unless
+    // all deviations are to be analysed, reporting stops at the first
+    // deviation when it throws, or when asked to.
+    const bool firstOnly = !analysis && (throwOnError || stopAtFirstDeviation);
+    const std::size_t size = std::min(t1.size(), t2.size());
+
+    for (const auto& chunk : failingChunks(t1, t2, tol, firstOnly)) {
+        const std::size_t begin = chunk * deviationChunkSize;
+        const std::size_t end = std::min(begin + deviationChunkSize, size);
+
+        for (size_t i = begin; i < end; i++) {
+            if (firstOnly && !exceedsTolerance(static_cast<double>(t1[i]),
+                                               static_cast<double>(t2[i]), tol)) {
+                continue;
+            }
+
+            deviationsForCell(static_cast<double>(t1[i]),
+                              static_cast<double>(t2[i]),
+                              keyword, reference, t1.size(),
+                              i, allowNegatives, strictTol);
+
+            if (firstOnly) {
+                std::cout << "Remaining values of keyword " << keyword << " not compared." << std::endl;
+                return;
+            }
+        }
     }
 }
 
@@ -152,6 +278,8 @@ void ECLRegressionTest::compareVectors(const std::vector<T>& t1, const std::vect
                      "with floating point vectors");
     }
 
+    numBytesCompared += arrayBytes(t1) + arrayBytes(t2);
+
     bool result = t1 == t2 ? true : false ;
 
     if (!result) {
@@ -221,14 +349,6 @@ void ECLRegressionTest::deviationsForCell(double val1, double val2, const std::s
                                      dev.rel, relToleranceLoc));
         }
     }
-
-    if (dev.abs != -1) {
-        absDeviation.push_back(dev.abs);
-    }
-
-    if (dev.rel != -1) {
-        relDeviation.push_back(dev.rel);
-    }
 }
 
 
@@ -607,8 +727,10 @@ void ECLRegressionTest::results_init()
 
         deviations.clear();
 
-        init1.loadData();
-        init2.loadData();
+        Opm::runConcurrently({
+            [&init1]() { init1.loadData(); },
+            [&init2]() { init2.loadData(); },
+        });
 
         auto arrayList1 = init1.getList();
         auto arrayList2 = init2.getList();
@@ -684,24 +806,24 @@ void ECLRegressionTest::results_init()
                     std::cout << "Comparing " << keywords1[i] << " ... ";
 
                     if (arrayType1[i] == INTE) {
-                        auto vect1 = init1.get<int>(keywords1[i]);
-                        auto vect2 = init2.get<int>(keywords2[ind2]);
+                        const auto& vect1 = init1.get<int>(keywords1[i]);
+                        const auto& vect2 = init2.get<int>(keywords2[ind2]);
                         compareVectors(vect1, vect2, keywords1[i],reference);
                     } else if (arrayType1[i] == REAL) {
-                        auto vect1 = init1.get<float>(keywords1[i]);
-                        auto vect2 = init2.get<float>(keywords2[ind2]);
+                        const auto& vect1 = init1.get<float>(keywords1[i]);
+                        const auto& vect2 = init2.get<float>(keywords2[ind2]);
                         compareFloatingPointVectors(vect1, vect2, keywords1[i], reference);
                     } else if (arrayType1[i] == DOUB) {
-                        auto vect1 = init1.get<double>(keywords1[i]);
-                        auto vect2 = init2.get<double>(keywords2[ind2]);
+                        const auto& vect1 = init1.get<double>(keywords1[i]);
+                        const auto& vect2 = init2.get<double>(keywords2[ind2]);
                         compareFloatingPointVectors(vect1, vect2, keywords1[i], reference);
                     } else if (arrayType1[i] == LOGI) {
-                        auto vect1 = init1.get<bool>(keywords1[i]);
-                        auto vect2 = init2.get<bool>(keywords2[ind2]);
+                        const auto& vect1 = init1.get<bool>(keywords1[i]);
+                        const auto& vect2 = init2.get<bool>(keywords2[ind2]);
                         compareVectors(vect1, vect2, keywords1[i], reference);
                     } else if (arrayType1[i] == CHAR) {
-                        auto vect1 = init1.get<std::string>(keywords1[i]);
-                        auto vect2 = init2.get<std::string>(keywords2[ind2]);
+                        const auto& vect1 = init1.get<std::string>(keywords1[i]);
+                        const auto& vect2 = init2.get<std::string>(keywords2[ind2]);
                         compareVectors(vect1, vect2, keywords1[i], reference);
                     } else if (arrayType1[i] == MESS) {
                         // shold not be any associated data
@@ -808,8 +930,10 @@ void ECLRegressionTest::results_rst()
 
             std::string reference = "Restart, sequence "+std::to_string(seqn);
 
-            rst1->loadReportStepNumber(seqn);
-            rst2->loadReportStepNumber(seqn);
+            Opm::runConcurrently({
+                [&rst1, seqn]() { rst1->loadReportStepNumber(seqn); },
+                [&rst2, seqn]() { rst2->loadReportStepNumber(seqn); },
+            });
 
             auto arrays1 = rst1->listOfRstArrays(seqn);
             auto arrays2 = rst2->listOfRstArrays(seqn);
@@ -889,15 +1013,15 @@ void ECLRegressionTest::results_rst()
                         std::cout << "Comparing " << keywords1[i] << " ... ";
 
                         if (arrayType1[i] == INTE) {
-                            auto vect1 = rst1->getRestartData<int>(keywords1[i], seqn, 0);
-                            auto vect2 = rst2->getRestartData<int>(keywords2[ind2], seqn, 0);
+                            const auto& vect1 = rst1->getRestartData<int>(keywords1[i], seqn, 0);
+                            const auto& vect2 = rst2->getRestartData<int>(keywords2[ind2], seqn, 0);
                             compareVectors(vect1, vect2, keywords1[i], reference);
                         } else if (arrayType1[i] == REAL) {
-                            auto vect1 = rst1->getRestartData<float>(keywords1[i], seqn, 0);
-                            auto vect2 = rst2->getRestartData<float>(keywords2[ind2], seqn, 0);
+                            const auto& vect1 = rst1->getRestartData<float>(keywords1[i], seqn, 0);
+                            const auto& vect2 = rst2->getRestartData<float>(keywords2[ind2], seqn, 0);
                             compareFloatingPointVectors(vect1, vect2, keywords1[i], reference);
                         } else if (arrayType1[i] == DOUB) {
-                            auto vect1 = rst1->getRestartData<double>(keywords1[i], seqn, 0);
+                            const auto& vect1 = rst1->getRestartData<double>(keywords1[i], seqn, 0);
                             auto vect2 = rst2->getRestartData<double>(keywords2[ind2], seqn, 0);
 
                             // hack in order to not test doubhead[1], dependent on simulation results
@@ -907,12 +1031,12 @@ void ECLRegressionTest::results_rst()
                             }
                             compareFloatingPointVectors(vect1, vect2, keywords1[i], reference);
                         } else if (arrayType1[i] == LOGI) {
-                            auto vect1 = rst1->getRestartData<bool>(keywords1[i], seqn, 0);
-                            auto vect2 = rst2->getRestartData<bool>(keywords2[ind2], seqn, 0);
+                            const auto& vect1 = rst1->getRestartData<bool>(keywords1[i], seqn, 0);
+                            const auto& vect2 = rst2->getRestartData<bool>(keywords2[ind2], seqn, 0);
                             compareVectors(vect1, vect2, keywords1[i], reference);
                         } else if (arrayType1[i] == CHAR) {
-                            auto vect1 = rst1->getRestartData<std::string>(keywords1[i], seqn, 0);
-                            auto vect2 = rst2->getRestartData<std::string>(keywords2[ind2], seqn, 0);
+                            const auto& vect1 = rst1->getRestartData<std::string>(keywords1[i], seqn, 0);
+                            const auto& vect2 = rst2->getRestartData<std::string>(keywords2[ind2], seqn, 0);
                             compareVectors(vect1, vect2, keywords1[i], reference);
                         } else if (arrayType1[i] == MESS) {
                             // shold not be any associated data
@@ -925,6 +1049,11 @@ void ECLRegressionTest::results_rst()
                     }
                 }
             }
+
+            // Release this report step's arrays before loading the next
+            // one, such that only a single step is held in memory.
+            rst1->clearData();
+            rst2->clearData();
         }
 
         if (!deviations.empty()) {
@@ -951,11 +1080,14 @@ void ECLRegressionTest::results_smry()
 
     if (foundSmspec1 && foundSmspec2) {
         ESmry smry1(fileName1, loadBaseRunData);
-        smry1.loadData();
-        std::cout << "\nLoading summary file " << fileName1 << "  .... done" << std::endl;
-
         ESmry smry2(fileName2, loadBaseRunData);
-        smry2.loadData();
+
+        Opm::runConcurrently({
+            [&smry1]() { smry1.loadData(); },
+            [&smry2]() { smry2.loadData(); },
+        });
+
+        std::cout << "\nLoading summary file " << fileName1 << "  .... done" << std::endl;
         std::cout << "Loading summary file " << fileName2 << "  .... done" << std::endl;
 
         deviations.clear();
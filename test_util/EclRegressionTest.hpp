@@ -24,6 +24,8 @@
 
 #include <opm/io/eclipse/EclIOdata.hpp>
 
+#include <cstddef>
+
 namespace Opm { namespace EclIO {
     class EGrid;
 }}
@@ -95,6 +97,17 @@ public:
         this->loadBaseRunData = loadArg;
     }
 
+    // Stop comparing a floating point array at its first deviation
+    // exceeding the tolerances, also when not throwing on errors.
+    void setStopAtFirstDeviation(bool stopArg) {
+        this->stopAtFirstDeviation = stopArg;
+    }
+
+    //! \brief Number of bytes of array data compared so far, counting both cases.
+    std::size_t bytesCompared() const {
+        return numBytesCompared;
+    }
+
     void loadGrids();
     void printDeviationReport();
 
@@ -143,7 +156,8 @@ private:
     // deviationsForCell throws an exception if both the absolute deviation AND the relative deviation
     // are larger than absTolerance and relTolerance, respectively. In addition,
     // if allowNegativeValues is passed as false, an exception will be thrown when the absolute value
-    // of a negative value exceeds absTolerance. If no exceptions are thrown, the absolute and relative deviations are added to absDeviation and relDeviation.
+    // of a negative value exceeds absTolerance. In analysis mode the deviations exceeding the tolerances are
+    // recorded in 'deviations' for printDeviationReport() instead of throwing.
     // void deviationsForCell(double val1, double val2, const std::string& keyword, const std::string reference, size_t kw_size, size_t cell, bool allowNegativeValues = true);
 
     void deviationsForCell(double val1, double val2, const std::string& keyword,
@@ -155,9 +169,6 @@ private:
                                         const std::string& reference,
                                         size_t kw_size, size_t cell);
 
-    // These vectors store absolute and relative deviations, respecively. Note that they are whiped clean for every new keyword comparison.
-    std::vector<double> absDeviation, relDeviation;
-
     // Keywords which should not contain negative values, i.e. uses allowNegativeValues = false in deviationsForCell():
     const std::vector<std::string> keywordDisallowNegatives = {"SGAS", "SWAT", "PRESSURE"};
 
@@ -183,6 +194,10 @@ private:
 
     bool loadBaseRunData = false;
 
+    bool stopAtFirstDeviation = false;
+
+    std::size_t numBytesCompared = 0;
+
     // specific keyword to be compared
     std::string specificKeyword;
 
@@ -21,6 +21,7 @@
 #include <opm/common/ErrorMacros.hpp>
 
 #include <algorithm>
+#include <chrono>
 #include <filesystem>
 #include <getopt.h>
 #include <iostream>
@@ -38,6 +39,7 @@ static void printHelp() {
               << "-a Run a full analysis of errors.\n"
               << "-h Print help and exit.\n"
               << "-d Use report steps only when comparing results from summary files.\n"
+              << "-e Stop comparing a keyword at its first deviation exceeding the tolerances. Only relevant with option -n.\n"
               << "-i Execute integration test (regression test is default).\n"
               << "   The integration test compares SGAS, SWAT and PRESSURE in unified restart files, and WOPR, WGPR, WWPR and WBHP (all wells) in summary file. \n"
               << "-k Specify specific keyword to compare (capitalized), for examples -k PRESSURE or -k WOPR:A-1H \n"
@@ -93,12 +95,13 @@ int main(int argc, char** argv) {
     bool acceptExtraKeywords       = false;
     bool acceptExtraKeywordsBoth   = false;
     bool analysis                  = false;
+    bool stopAtFirstDeviation      = false;
     char* keyword                  = nullptr;
     int c                          = 0;
     int reportStepNumber           = -1;
     std::string fileTypeString;
 
-    while ((c = getopt(argc, argv, "hik:alnpt:Rr:xdy")) != -1) {
+    while ((c = getopt(argc, argv, "hik:alnpt:Rr:xdey")) != -1) {
         switch (c) {
         case 'a':
             analysis = true;
@@ -110,6 +113,9 @@ int main(int argc, char** argv) {
         case 'd':
             reportStepOnly = true;
             break;
+        case 'e':
+            stopAtFirstDeviation = true;
+            break;
         case 'i':
             integrationTest = true;
             break;
@@ -188,6 +194,7 @@ int main(int argc, char** argv) {
         comparator.doAnalysis(analysis);
         comparator.setAcceptExtraKeywords(acceptExtraKeywords);
         comparator.setAcceptExtraKeywordsBoth(acceptExtraKeywordsBoth);
+        comparator.setStopAtFirstDeviation(stopAtFirstDeviation);
 
         if (integrationTest) {
             comparator.setIntegrationTest(true);
@@ -217,6 +224,8 @@ int main(int argc, char** argv) {
             comparator.setLoadBaseRunData(true);
         }
 
+        const auto start = std::chrono::steady_clock::now();
+
         comparator.loadGrids();
 
         if (integrationTest && specificFileType) {
@@ -256,6 +265,13 @@ int main(int argc, char** argv) {
             comparator.results_rft();
         }
 
+        const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+        const double megabytes = comparator.bytesCompared() / (1024.0 * 1024.0);
+        std::cout << "\nCompared " << megabytes << " MiB of array data in "
+                  << elapsed.count() << " seconds ("
+                  << (elapsed.count() > 0 ? megabytes / elapsed.count() : 0.0)
+                  << " MiB/s)" << std::endl;
+
         if (comparator.getNoErrors() > 0) {
             std::ostringstream str;
             str << comparator.getNoErrors()
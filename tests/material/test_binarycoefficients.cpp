@@ -43,6 +43,11 @@
 #include <opm/material/components/CO2.hpp>
 #include <opm/material/components/CO2Tables.hpp>
 #include <opm/material/fluidsystems/blackoilpvt/BrineCo2Pvt.hpp>
+#include <opm/material/fluidsystems/blackoilpvt/Co2GasPvt.hpp>
+
+#include <cmath>
+#include <utility>
+#include <vector>
 
 template<class Scalar>
 bool close_at_tolerance(Scalar n1, Scalar n2, Scalar tolerance)
@@ -257,3 +262,156 @@ BOOST_AUTO_TEST_CASE_TEMPLATE(BrineDensityWithCO2, Scalar, Types)
         }
     }
 }
+
+BOOST_AUTO_TEST_CASE(TabulatedSolubility)
+{
+    using Evaluation = Opm::DenseAd::Evaluation<double, 2>;
+
+    // The table is only used where it matches the solubility model at the
+    // cell centres, so it should be close to the model everywhere.
+    const double tol = 1e-2;
+
+    for (const int activityModel : {1, 2, 3}) {
+        for (const double salinity : {0.0, 0.1}) {
+            const std::vector<double> salinities = {salinity};
+
+            Opm::BrineCo2Pvt<double> brineExact(salinities, activityModel);
+            Opm::BrineCo2Pvt<double> brineTabulated(salinities, activityModel);
+            brineTabulated.setTabulatedSolubility(true);
+            BOOST_CHECK(brineTabulated.tabulatedSolubility());
+
+            Opm::Co2GasPvt<double> gasExact(salinities, activityModel);
+            Opm::Co2GasPvt<double> gasTabulated(salinities, activityModel);
+            gasTabulated.setTabulatedSolubility(true);
+
+            for (double T = 290.0; T < 420.0; T += 7.3) {
+                for (double p = 15.0e5; p < 480.0e5; p += 11.7e5) {
+                    const Evaluation temperature(T, 0);
+                    const Evaluation pressure(p, 1);
+
+                    const auto rs = brineExact.rsSat(0, temperature, pressure, Evaluation(salinity));
+                    const auto rsTab = brineTabulated.rsSat(0, temperature, pressure, Evaluation(salinity));
+                    BOOST_CHECK_MESSAGE(close_at_tolerance(rsTab.value(), rs.value(), tol),
+                                        "Tabulated Rs {" << rsTab.value() << "} differs from {" << rs.value()
+                                        << "} at (T, p, S) = (" << T << ", " << p << ", " << salinity << ")");
+                    if (rs.derivative(1) > 0.0) {
+                        BOOST_CHECK(rsTab.derivative(1) > 0.0);
+                    }
+
+                    const auto rvw = gasExact.saturatedWaterVaporizationFactor(0, temperature, pressure);
+                    const auto rvwTab = gasTabulated.saturatedWaterVaporizationFactor(0, temperature, pressure);
+                    BOOST_CHECK_MESSAGE(close_at_tolerance(rvwTab.value(), rvw.value(), tol),
+                                        "Tabulated Rvw {" << rvwTab.value() << "} differs from {" << rvw.value()
+                                        << "} at (T, p, S) = (" << T << ", " << p << ", " << salinity << ")");
+                }
+            }
+
+            // Outside of the table the solubility model is used.
+            const Evaluation T(450.0, 0);
+            const Evaluation p(100.0e5, 1);
+            BOOST_CHECK_EQUAL(brineTabulated.rsSat(0, T, p, Evaluation(salinity)).value(),
+                              brineExact.rsSat(0, T, p, Evaluation(salinity)).value());
+            BOOST_CHECK_EQUAL(brineTabulated.rsSat(0, T, p, Evaluation(0.2)).value(),
+                              brineExact.rsSat(0, T, p, Evaluation(0.2)).value());
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(TabulatedSolubilityActivityModel)
+{
+    using Evaluation = Opm::DenseAd::Evaluation<double, 2>;
+
+    // Changing the activity model rebuilds the table for the new model.
+    const std::vector<double> salinities = {0.1};
+    Opm::BrineCo2Pvt<double> brineTabulated(salinities, 1);
+    brineTabulated.setTabulatedSolubility(true);
+    brineTabulated.setActivityModelSalt(3);
+    const Opm::BrineCo2Pvt<double> brineExact(salinities, 3);
+    const Opm::BrineCo2Pvt<double> brineOld(salinities, 1);
+
+    Opm::Co2GasPvt<double> gasTabulated(salinities, 1);
+    gasTabulated.setTabulatedSolubility(true);
+    gasTabulated.setActivityModelSalt(3);
+    const Opm::Co2GasPvt<double> gasExact(salinities, 3);
+
+    const Evaluation T(350.0, 0);
+    const Evaluation p(100.0e5, 1);
+    const Evaluation S(salinities[0]);
+    const auto rs = brineExact.rsSat(0, T, p, S).value();
+    const auto rsTab = brineTabulated.rsSat(0, T, p, S).value();
+    const auto rsOld = brineOld.rsSat(0, T, p, S).value();
+    BOOST_CHECK(std::abs(rsTab - rs) < std::abs(rsTab - rsOld));
+    BOOST_CHECK(close_at_tolerance(rsTab, rs, 1e-2));
+    BOOST_CHECK(close_at_tolerance(gasTabulated.saturatedWaterVaporizationFactor(0, T, p).value(),
+                                   gasExact.saturatedWaterVaporizationFactor(0, T, p).value(), 1e-2));
+}
+
+BOOST_AUTO_TEST_CASE(SharedSolubilityTable)
+{
+    using Table = Opm::BinaryCoeff::Brine_CO2SolubilityTable<double>;
+    using BinaryCoeff = Opm::BrineCo2Pvt<double>::BinaryCoeffBrineCO2;
+
+    const Opm::CO2Tables<double, std::vector<double>> co2Tables;
+    Table::Range range;
+    range.numTemperatures = 5;
+    range.numPressures = 5;
+    range.salinityMin = range.salinityMax = 0.1;
+    range.numSalinities = 1;
+
+    const auto table = Table::shared<BinaryCoeff>(co2Tables, 3, range);
+    BOOST_CHECK(!table->empty());
+    BOOST_CHECK_EQUAL(Table::shared<BinaryCoeff>(co2Tables, 3, range), table);
+    BOOST_CHECK(Table::shared<BinaryCoeff>(co2Tables, 1, range) != table);
+
+    range.numPressures = 7;
+    BOOST_CHECK(Table::shared<BinaryCoeff>(co2Tables, 3, range) != table);
+}
+
+BOOST_AUTO_TEST_CASE(TabulatedWater)
+{
+    using Evaluation = Opm::DenseAd::Evaluation<double, 2>;
+    using Range = Opm::BrineCo2Pvt<double>::WaterTableRange;
+
+    const std::vector<double> salinities = {0.1};
+    const Evaluation salinity(salinities[0]);
+    const Opm::BrineCo2Pvt<double> brineExact(salinities);
+
+    const auto density = [&salinity](const Opm::BrineCo2Pvt<double>& brine, double T, double p)
+    { return brine.density(0, Evaluation(T, 0), Evaluation(p, 1), Evaluation(0.0), salinity).value(); };
+    const auto energy = [](const Opm::BrineCo2Pvt<double>& brine, double T, double p)
+    { return brine.internalEnergy(0, Evaluation(T, 0), Evaluation(p, 1), Evaluation(0.0)).value(); };
+
+    // The reported bounds hold for the tabulated water, and so for the brine.
+    const Range range{};
+    Opm::BrineCo2Pvt<double> brineTabulated(salinities);
+    brineTabulated.setTabulatedWater(true, range);
+    BOOST_CHECK(brineTabulated.tabulatedWater());
+    const auto& bounds = brineTabulated.tabulatedWaterErrorBounds();
+    BOOST_CHECK(bounds.coverage > 0.9);
+    BOOST_CHECK(bounds.density > 0.0 && bounds.density <= range.tolerance);
+    for (const auto& [T, p] : {std::pair{300.0, 50.0e5}, {350.0, 200.0e5}, {400.0, 400.0e5}}) {
+        BOOST_CHECK(close_at_tolerance(density(brineTabulated, T, p), density(brineExact, T, p), 2*bounds.density));
+        BOOST_CHECK(close_at_tolerance(energy(brineTabulated, T, p), energy(brineExact, T, p), 2*bounds.enthalpy));
+    }
+
+    // Outside of the table the water model is used.
+    BOOST_CHECK_EQUAL(density(brineTabulated, range.temperatureMax + 5.0, 100.0e5),
+                      density(brineExact, range.temperatureMax + 5.0, 100.0e5));
+    BOOST_CHECK_EQUAL(energy(brineTabulated, 350.0, range.pressureMax + 10.0e5),
+                      energy(brineExact, 350.0, range.pressureMax + 10.0e5));
+
+    // So it is in the cells where the table is not accurate, here all of them.
+    Range exact = range;
+    exact.numTemperatures = 3;
+    exact.numPressures = 3;
+    exact.tolerance = 0.0;
+    Opm::BrineCo2Pvt<double> brineUncovered(salinities);
+    brineUncovered.setTabulatedWater(true, exact);
+    BOOST_CHECK_EQUAL(brineUncovered.tabulatedWaterErrorBounds().coverage, 0.0);
+    BOOST_CHECK_EQUAL(density(brineUncovered, 350.0, 200.0e5), density(brineExact, 350.0, 200.0e5));
+    BOOST_CHECK_EQUAL(energy(brineUncovered, 350.0, 200.0e5), energy(brineExact, 350.0, 200.0e5));
+
+    brineTabulated.setTabulatedWater(false);
+    BOOST_CHECK(!brineTabulated.tabulatedWater());
+    BOOST_CHECK_EQUAL(density(brineTabulated, 350.0, 100.0e5), density(brineExact, 350.0, 100.0e5));
+}
@@ -56,6 +56,7 @@
 #include <opm/material/components/iapws/Common.hpp>
 #include <opm/material/components/iapws/Region4.hpp>
 #include <opm/material/components/H2O.hpp>
+#include <opm/material/components/H2OTable.hpp>
 #include <opm/material/components/SimpleHuDuanH2O.hpp>
 #include <opm/material/components/CO2.hpp>
 #include <opm/material/components/CO2Tables.hpp>
@@ -775,3 +776,70 @@ BOOST_AUTO_TEST_CASE_TEMPLATE(H2Class, Scalar, Types)
         }
     }
 }
+
+template <class RawH2O>
+void checkH2OTable()
+{
+    using Evaluation = Opm::DenseAd::Evaluation<double, 2>;
+    using Table = Opm::H2OTable<double>;
+
+    const typename Table::Range range{};
+    Table table;
+    BOOST_CHECK(table.empty());
+    BOOST_CHECK(!table.applies(300.0, 1.0e7));
+
+    table.template init<RawH2O>(range);
+    BOOST_CHECK(!table.empty());
+
+    const auto& bounds = table.errorBounds();
+    BOOST_CHECK(bounds.coverage > 0.9);
+    BOOST_CHECK(bounds.density <= range.tolerance);
+    BOOST_CHECK(bounds.enthalpy <= range.tolerance);
+    BOOST_CHECK(bounds.viscosity <= range.tolerance);
+
+    // The cell centres are where bilinear interpolation deviates the most, so
+    // the tolerance holds at any state the table applies to.
+    for (double T = 280.0; T < 470.0; T += 3.7) {
+        for (double p = 2.0e5; p < 990.0e5; p += 13.3e5) {
+            const Evaluation temperature(T, 0);
+            const Evaluation pressure(p, 1);
+            if (!table.applies(temperature, pressure)) {
+                continue;
+            }
+
+            const auto rho = RawH2O::liquidDensity(temperature, pressure, false);
+            const auto rhoTab = table.liquidDensity(temperature, pressure);
+            BOOST_CHECK_MESSAGE(close_at_tolerance(rhoTab.value(), rho.value(), range.tolerance),
+                                "Tabulated density {" << rhoTab.value() << "} differs from {" << rho.value()
+                                << "} at (T, p) = (" << T << ", " << p << ")");
+            BOOST_CHECK(rhoTab.derivative(1) > 0.0);
+
+            const auto mu = RawH2O::liquidViscosity(temperature, pressure, false);
+            const auto muTab = table.liquidViscosity(temperature, pressure);
+            BOOST_CHECK_MESSAGE(close_at_tolerance(muTab.value(), mu.value(), range.tolerance),
+                                "Tabulated viscosity {" << muTab.value() << "} differs from {" << mu.value()
+                                << "} at (T, p) = (" << T << ", " << p << ")");
+
+            const auto h = RawH2O::liquidEnthalpy(temperature, pressure);
+            const auto hTab = table.liquidEnthalpy(temperature, pressure);
+            BOOST_CHECK_MESSAGE(std::abs(hTab.value() - h.value()) <= range.tolerance*std::max(std::abs(h.value()), 4.2e3),
+                                "Tabulated enthalpy {" << hTab.value() << "} differs from {" << h.value()
+                                << "} at (T, p) = (" << T << ", " << p << ")");
+            BOOST_CHECK(hTab.derivative(0) > 0.0);
+        }
+    }
+
+    // The table does not extend beyond its range.
+    BOOST_CHECK(!table.applies(range.temperatureMax + 1.0, 1.0e7));
+    BOOST_CHECK(!table.applies(300.0, range.pressureMax + 1.0e5));
+
+    table.clear();
+    BOOST_CHECK(table.empty());
+    BOOST_CHECK(!table.applies(300.0, 1.0e7));
+}
+
+BOOST_AUTO_TEST_CASE(TabulatedWater)
+{
+    checkH2OTable<Opm::H2O<double>>();
+    checkH2OTable<Opm::SimpleHuDuanH2O<double>>();
+}
@@ -43,6 +43,9 @@
 #include <opm/material/fluidmatrixinteractions/EclMaterialLawManager.hpp>
 #include <opm/material/fluidstates/SimpleModularFluidState.hpp>
 
+#include <opm/common/utility/MemPacker.hpp>
+#include <opm/common/utility/Serializer.hpp>
+
 #include <opm/input/eclipse/Parser/Parser.hpp>
 #include <opm/input/eclipse/Deck/Deck.hpp>
 #include <opm/input/eclipse/EclipseState/EclipseState.hpp>
@@ -964,3 +967,100 @@ BOOST_AUTO_TEST_CASE_TEMPLATE(Let, Scalar, Types)
         }
     }
 }
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(CompactStorage, Scalar, Types)
+{
+    using MaterialLaw = typename Fixture<Scalar>::MaterialLaw;
+    using MaterialLawManager = typename Fixture<Scalar>::MaterialLawManager;
+    constexpr int numPhases = Fixture<Scalar>::numPhases;
+
+    Opm::Parser parser;
+    const auto deck = parser.parseString(fam1DeckString);
+    const Opm::EclipseState eclState(deck);
+
+    const auto& eclGrid = eclState.getInputGrid();
+    const size_t n = eclGrid.getCartesianSize();
+
+    MaterialLawManager regularManager;
+    regularManager.initFromState(eclState);
+    regularManager.initParamsForElements(eclState, n, doOldLookup, doNothing);
+
+    MaterialLawManager compactManager;
+    compactManager.setCompactParamStorage(true);
+    compactManager.initFromState(eclState);
+    compactManager.initParamsForElements(eclState, n, doOldLookup, doNothing);
+
+    BOOST_CHECK(!regularManager.compactParamStorage());
+    BOOST_CHECK(compactManager.compactParamStorage());
+    BOOST_CHECK_EQUAL(regularManager.numMaterialLawParamObjects(), n);
+    BOOST_CHECK_LT(compactManager.numMaterialLawParamObjects(), n);
+
+    for (unsigned elemIdx = 0; elemIdx < n; ++elemIdx) {
+        BOOST_CHECK(regularManager.oilWaterScaledEpsInfoDrainage(elemIdx) ==
+                    compactManager.oilWaterScaledEpsInfoDrainage(elemIdx));
+
+        for (int i = 0; i < 100; ++ i) {
+            Scalar Sw = Scalar(0.2);
+            Scalar So = Scalar(i) / 125;
+            Scalar Sg = 1 - Sw - So;
+            typename Fixture<Scalar>::FluidState fs;
+            fs.setSaturation(Fixture<Scalar>::waterPhaseIdx, Sw);
+            fs.setSaturation(Fixture<Scalar>::oilPhaseIdx, So);
+            fs.setSaturation(Fixture<Scalar>::gasPhaseIdx, Sg);
+
+            std::array<Scalar,numPhases> pcRegular{};
+            std::array<Scalar,numPhases> pcCompact{};
+            MaterialLaw::capillaryPressures(pcRegular, regularManager.materialLawParams(elemIdx), fs);
+            MaterialLaw::capillaryPressures(pcCompact, compactManager.materialLawParams(elemIdx), fs);
+
+            std::array<Scalar,numPhases> krRegular{};
+            std::array<Scalar,numPhases> krCompact{};
+            MaterialLaw::relativePermeabilities(krRegular, regularManager.materialLawParams(elemIdx), fs);
+            MaterialLaw::relativePermeabilities(krCompact, compactManager.materialLawParams(elemIdx), fs);
+
+            for (unsigned phaseIdx = 0; phaseIdx < numPhases; ++phaseIdx) {
+                BOOST_CHECK_EQUAL(pcRegular[phaseIdx], pcCompact[phaseIdx]);
+                BOOST_CHECK_EQUAL(krRegular[phaseIdx], krCompact[phaseIdx]);
+            }
+        }
+    }
+
+    // Modifying one element's end points must not affect the others.
+    const auto numObjects = compactManager.numMaterialLawParamObjects();
+    const auto maxPcow = compactManager.oilWaterScaledEpsInfoDrainage(1).maxPcow;
+    compactManager.applyRestartSwatInit(0, Scalar{12345});
+
+    BOOST_CHECK_EQUAL(compactManager.numMaterialLawParamObjects(), numObjects + 1);
+    BOOST_CHECK_EQUAL(compactManager.oilWaterScaledEpsInfoDrainage(0).maxPcow, Scalar{12345});
+    BOOST_CHECK_EQUAL(compactManager.oilWaterScaledEpsInfoDrainage(1).maxPcow, maxPcow);
+
+    // A restarted run recreates the detached entry from the serialized state.
+    MaterialLawManager restartManager;
+    restartManager.setCompactParamStorage(true);
+    restartManager.initFromState(eclState);
+    restartManager.initParamsForElements(eclState, n, doOldLookup, doNothing);
+
+    Opm::Serialization::MemPacker packer;
+    Opm::Serializer ser(packer);
+    ser.pack(compactManager);
+    ser.unpack(restartManager);
+
+    BOOST_CHECK_EQUAL(restartManager.numMaterialLawParamObjects(), numObjects + 1);
+    for (unsigned elemIdx = 0; elemIdx < n; ++elemIdx) {
+        BOOST_CHECK(restartManager.oilWaterScaledEpsInfoDrainage(elemIdx) ==
+                    compactManager.oilWaterScaledEpsInfoDrainage(elemIdx));
+
+        typename Fixture<Scalar>::FluidState fs;
+        fs.setSaturation(Fixture<Scalar>::waterPhaseIdx, Scalar(0.3));
+        fs.setSaturation(Fixture<Scalar>::oilPhaseIdx, Scalar(0.7));
+        fs.setSaturation(Fixture<Scalar>::gasPhaseIdx, Scalar(0.0));
+
+        std::array<Scalar,numPhases> pcCompact{};
+        std::array<Scalar,numPhases> pcRestart{};
+        MaterialLaw::capillaryPressures(pcCompact, compactManager.materialLawParams(elemIdx), fs);
+        MaterialLaw::capillaryPressures(pcRestart, restartManager.materialLawParams(elemIdx), fs);
+        for (unsigned phaseIdx = 0; phaseIdx < numPhases; ++phaseIdx) {
+            BOOST_CHECK_EQUAL(pcCompact[phaseIdx], pcRestart[phaseIdx]);
+        }
+    }
+}
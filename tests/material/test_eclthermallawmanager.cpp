@@ -0,0 +1,215 @@
+// -*- mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-
+// vi: set et ts=4 sw=4 sts=4:
+/*
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 2 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+
+  Consult the COPYING file in the top-level source directory of this
+  module for the precise wording of the license and the list of
+  copyright holders.
+*/
+/*!
+ * \file
+ *
+ * \brief This is the unit test for the batched evaluation of the thermal laws
+ *        of the EclThermalLawManager.
+ */
+#include "config.h"
+
+#if !HAVE_ECL_INPUT
+#error "The test for EclThermalLawManager requires eclipse input support in opm-common"
+#endif
+
+#define BOOST_TEST_MODULE EclThermalLawManager
+#include <boost/test/unit_test.hpp>
+
+#include <opm/material/thermal/EclThermalLawManager.hpp>
+#include <opm/material/fluidstates/SimpleModularFluidState.hpp>
+#include <opm/material/fluidsystems/BlackOilDefaultIndexTraits.hpp>
+#include <opm/material/fluidsystems/BlackOilFluidSystem.hpp>
+#include <opm/material/densead/Evaluation.hpp>
+
+#include <opm/input/eclipse/Deck/Deck.hpp>
+#include <opm/input/eclipse/EclipseState/EclipseState.hpp>
+#include <opm/input/eclipse/EclipseState/Grid/FieldPropsManager.hpp>
+#include <opm/input/eclipse/Parser/Parser.hpp>
+
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace {
+
+using FluidSystem = Opm::BlackOilFluidSystem<double, Opm::BlackOilDefaultIndexTraits>;
+using Evaluation = Opm::DenseAd::Evaluation<double, 2>;
+using ThermalLawManager = Opm::EclThermalLawManager<double, FluidSystem>;
+using FluidState = Opm::SimpleModularFluidState<Evaluation,
+                                                FluidSystem::numPhases,
+                                                FluidSystem::numComponents,
+                                                FluidSystem,
+                                                /*storePressure=*/false,
+                                                /*storeTemperature=*/true,
+                                                /*storeComposition=*/false,
+                                                /*storeFugacity=*/false,
+                                                /*storeSaturation=*/true,
+                                                /*storeDensity=*/false,
+                                                /*storeViscosity=*/false,
+                                                /*storeEnthalpy=*/false>;
+
+const std::string gridSection = R"(
+RUNSPEC
+DIMENS
+3 2 1 /
+OIL
+WATER
+GAS
+THERMAL
+TABDIMS
+2 /
+METRIC
+GRID
+DX
+6*10 /
+DY
+6*10 /
+DZ
+6*1 /
+TOPS
+6*100 /
+PORO
+0.1 0.15 0.2 0.25 0.3 0.35 /
+)";
+
+const std::string heatcrThconrDeck = gridSection + R"(
+HEATCR
+2000 2100 2200 2300 2400 2500 /
+HEATCRT
+1.0 1.5 2.0 2.5 3.0 3.5 /
+THCONR
+100 150 200 250 300 350 /
+THCONSF
+0.1 0.2 0.3 0.4 0.5 0.6 /
+PROPS
+REGIONS
+SATNUM
+1 2 1 2 1 2 /
+)";
+
+const std::string specrockThcDeck = gridSection + R"(
+THCROCK
+100 150 200 250 300 350 /
+THCOIL
+6*10 /
+THCGAS
+6*1 /
+THCWATER
+6*50 /
+PROPS
+SPECROCK
+10  2000
+100 2200 /
+10  2500
+50  2600
+200 3000 /
+REGIONS
+SATNUM
+1 2 1 2 1 2 /
+)";
+
+ThermalLawManager makeManager(const Opm::EclipseState& eclState)
+{
+    const auto doubleLookup = [](const Opm::FieldPropsManager& fp, const std::string& name)
+    {
+        return fp.get_double(name);
+    };
+
+    const auto intLookup = [](const Opm::FieldPropsManager& fp, const std::string& name, bool needsTranslation)
+    {
+        std::vector<unsigned int> dest;
+        for (const auto value : fp.get_int(name)) {
+            dest.push_back(value - needsTranslation);
+        }
+        return dest;
+    };
+
+    ThermalLawManager manager;
+    manager.initParamsForElements(eclState, eclState.getInputGrid().getCartesianSize(),
+                                  doubleLookup, intLookup);
+    return manager;
+}
+
+// Compare the batched evaluation of a range of elements with the multiplexer
+// laws applied to each element.
+void checkBatchedLaws(const std::string& deckString)
+{
+    const auto deck = Opm::Parser{}.parseString(deckString);
+    const Opm::EclipseState eclState(deck);
+
+    FluidSystem::initBegin(/*numPvtRegions=*/1);
+
+    const auto manager = makeManager(eclState);
+
+    const unsigned firstElemIdx = 1;
+    const std::size_t n = 4;
+
+    std::vector<Evaluation> temperature;
+    std::vector<Evaluation> gasSaturation;
+    std::vector<FluidState> fluidStates(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        temperature.emplace_back(273.15 + 20.0 + 40.0*i, 0);
+        gasSaturation.emplace_back(0.1 + 0.2*i, 1);
+
+        for (unsigned phaseIdx = 0; phaseIdx < FluidSystem::numPhases; ++phaseIdx) {
+            fluidStates[i].setTemperature(phaseIdx, temperature[i]);
+            fluidStates[i].setSaturation(phaseIdx, 0.0);
+        }
+        fluidStates[i].setSaturation(FluidSystem::gasPhaseIdx, gasSaturation[i]);
+    }
+
+    std::vector<Evaluation> energy(n);
+    manager.solidInternalEnergies(firstElemIdx, n, temperature.data(), energy.data());
+
+    std::vector<Evaluation> conductivity(n);
+    manager.thermalConductivities(firstElemIdx, n, gasSaturation.data(), conductivity.data());
+
+    for (std::size_t i = 0; i < n; ++i) {
+        const unsigned elemIdx = firstElemIdx + i;
+
+        const auto expectedEnergy = ThermalLawManager::SolidEnergyLaw::solidInternalEnergy(
+            manager.solidEnergyLawParams(elemIdx), fluidStates[i]);
+        BOOST_CHECK_CLOSE(energy[i].value(), expectedEnergy.value(), 1.0e-12);
+        BOOST_CHECK_CLOSE(energy[i].derivative(0), expectedEnergy.derivative(0), 1.0e-12);
+        BOOST_CHECK(energy[i].value() != 0.0);
+
+        const auto expectedConductivity = ThermalLawManager::ThermalConductionLaw::thermalConductivity(
+            manager.thermalConductionLawParams(elemIdx), fluidStates[i]);
+        BOOST_CHECK_CLOSE(conductivity[i].value(), expectedConductivity.value(), 1.0e-12);
+        BOOST_CHECK_EQUAL(conductivity[i].derivative(1), expectedConductivity.derivative(1));
+        BOOST_CHECK(conductivity[i].value() != 0.0);
+    }
+}
+
+} // Anonymous namespace
+
+BOOST_AUTO_TEST_CASE(HeatcrThconr)
+{
+    checkBatchedLaws(heatcrThconrDeck);
+}
+
+BOOST_AUTO_TEST_CASE(SpecrockThc)
+{
+    checkBatchedLaws(specrockThcDeck);
+}
@@ -42,9 +42,14 @@ gnuplot> plot "spline.csv" using 1:2 w l ti "Curve", \
 #include <boost/test/unit_test.hpp>
 
 #include <opm/material/common/Spline.hpp>
+#include <opm/material/densead/Evaluation.hpp>
+#include <opm/material/densead/Math.hpp>
 
+#include <algorithm>
 #include <array>
+#include <cmath>
 #include <iostream>
+#include <vector>
 
 template <class Spline, class Array>
 void testCommon(const Spline& sp,
@@ -357,3 +362,61 @@ BOOST_AUTO_TEST_CASE(Monotonic)
                          1000, std::cout);
     std::cout << "\n";
 }
+
+BOOST_AUTO_TEST_CASE(ArrayEvaluation)
+{
+    std::vector<double> x(40);
+    std::vector<double> y(40);
+    for (std::size_t i = 0; i < x.size(); ++i) {
+        x[i] = 0.1*i*i;
+        y[i] = std::sin(0.1*i*i);
+    }
+    const Opm::Spline<double> sp(x, y, /*type=*/Opm::Spline<double>::Monotonic);
+
+    // unsorted positions including the sampling points, and sorted ones
+    std::vector<double> xUnsorted;
+    for (std::size_t i = 0; i < 500; ++i) {
+        xUnsorted.push_back((i % 7 == 0) ? x[(13*i) % x.size()] : x.back()*((37*i) % 500)/499.0);
+    }
+    std::vector<double> xSorted = xUnsorted;
+    std::sort(xSorted.begin(), xSorted.end());
+
+    for (const auto& xs : {xUnsorted, xSorted}) {
+        std::vector<double> values(xs.size());
+        std::vector<double> derivatives(xs.size());
+        sp.evalWithDerivativeArray(xs.size(), xs, values, derivatives);
+        for (std::size_t i = 0; i < xs.size(); ++i) {
+            BOOST_CHECK_EQUAL(values[i], sp.eval(xs[i]));
+            BOOST_CHECK_EQUAL(derivatives[i], sp.evalDerivative(xs[i]));
+        }
+
+        sp.evalArray(xs.size(), xs.data(), values.data());
+        sp.evalDerivativeArray(xs.size(), xs.data(), derivatives.data());
+        for (std::size_t i = 0; i < xs.size(); ++i) {
+            BOOST_CHECK_EQUAL(values[i], sp.eval(xs[i]));
+            BOOST_CHECK_EQUAL(derivatives[i], sp.evalDerivative(xs[i]));
+        }
+    }
+
+    // extrapolation
+    const std::vector<double> xOutside{-1.0, x.back() + 1.0, x[3], -2.0};
+    std::vector<double> values(xOutside.size());
+    BOOST_CHECK_THROW(sp.evalArray(xOutside.size(), xOutside, values), Opm::NumericalProblem);
+    sp.evalArray(xOutside.size(), xOutside, values, /*extrapolate=*/true);
+    for (std::size_t i = 0; i < xOutside.size(); ++i) {
+        BOOST_CHECK_EQUAL(values[i], sp.eval(xOutside[i], /*extrapolate=*/true));
+    }
+
+    // derivatives with respect to the primary variables
+    using Evaluation = Opm::DenseAd::Evaluation<double, 1>;
+    std::vector<Evaluation> xEval;
+    for (const double xs : xUnsorted) {
+        xEval.push_back(Evaluation::createVariable(xs, 0));
+    }
+    std::vector<Evaluation> yEval(xEval.size());
+    sp.evalArray(xEval.size(), xEval, yEval);
+    for (std::size_t i = 0; i < xEval.size(); ++i) {
+        BOOST_CHECK(yEval[i] == sp.eval(xEval[i]));
+        BOOST_CHECK_EQUAL(yEval[i].derivative(0), sp.eval(xEval[i]).derivative(0));
+    }
+}
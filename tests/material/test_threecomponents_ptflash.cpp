@@ -189,3 +189,85 @@ for (const auto& sample : test_methods) {
 }
 #endif
 }
+
+BOOST_AUTO_TEST_CASE(PtFlashBatch)
+{
+    using Flash = Opm::PTFlash<double, FluidSystem>;
+
+    const double flash_tolerance = 1.e-8;
+    const Scalar temp = 300.0;
+    const std::vector<double> pressures {10e5, 30e5, 60e5, 100e5, 200e5};
+    const std::vector<std::array<double, 2>> compositions {{0.5, 0.3}, {0.1, 0.8}, {0.2, 0.1}, {0.05, 0.05}};
+
+    std::vector<FluidState> cells;
+    for (const auto& p : pressures) {
+        for (const auto& zc : compositions) {
+            Evaluation p_init = Evaluation::createVariable(p, 0);
+            ComponentVector comp;
+            comp[0] = Evaluation::createVariable(zc[0], 1);
+            comp[1] = Evaluation::createVariable(zc[1], 2);
+            comp[2] = 1. - comp[0] - comp[1];
+
+            FluidState fluid_state;
+            fluid_state.setPressure(FluidSystem::oilPhaseIdx, p_init);
+            fluid_state.setPressure(FluidSystem::gasPhaseIdx, p_init);
+            for (unsigned compIdx = 0; compIdx < numComponents; ++compIdx) {
+                fluid_state.setMoleFraction(compIdx, comp[compIdx]);
+            }
+            fluid_state.setTemperature(temp);
+
+            for (unsigned compIdx = 0; compIdx < numComponents; ++compIdx) {
+                fluid_state.setKvalue(compIdx, fluid_state.wilsonK_(compIdx));
+            }
+            fluid_state.setLvalue(1.);
+            cells.push_back(fluid_state);
+        }
+    }
+
+    auto checkSame = [](const FluidState& batch, const FluidState& single, std::size_t cell) {
+        BOOST_CHECK_MESSAGE(Opm::MathToolbox<Evaluation>::isSame(batch.L(), single.L(), 1e-10),
+                            "Cell " << cell << ": L does not match");
+        for (unsigned comp_idx = 0; comp_idx < numComponents; ++comp_idx) {
+            BOOST_CHECK_MESSAGE(Opm::MathToolbox<Evaluation>::isSame(batch.moleFraction(FluidSystem::oilPhaseIdx, comp_idx),
+                                                                     single.moleFraction(FluidSystem::oilPhaseIdx, comp_idx), 1e-10),
+                                "Cell " << cell << ": component " << comp_idx << " of x does not match");
+            BOOST_CHECK_MESSAGE(Opm::MathToolbox<Evaluation>::isSame(batch.moleFraction(FluidSystem::gasPhaseIdx, comp_idx),
+                                                                     single.moleFraction(FluidSystem::gasPhaseIdx, comp_idx), 1e-10),
+                                "Cell " << cell << ": component " << comp_idx << " of y does not match");
+        }
+    };
+
+    for (const auto& method : test_methods) {
+        auto single = cells;
+        for (auto& fluid_state : single) {
+            Flash::solve(fluid_state, method, flash_tolerance, EOSType::PR);
+        }
+
+        auto batch = cells;
+        std::vector<Flash::StabilityHistory> history;
+        Flash::solveBatch(batch, history, method, flash_tolerance, EOSType::PR);
+        BOOST_REQUIRE_EQUAL(history.size(), cells.size());
+
+        for (std::size_t cell = 0; cell < cells.size(); ++cell) {
+            checkSame(batch[cell], single[cell], cell);
+
+            // Only cells found stable have a margin.
+            const auto L = batch[cell].L().value();
+            if (history[cell].margin > 0) {
+                BOOST_CHECK(L == 0. || L == 1.);
+            }
+        }
+
+        // Flashing the solution again warm starts from it.  Single-phase
+        // cells with a margin skip the stability test, but the solution
+        // does not change.
+        auto rerun = batch;
+        Flash::solveBatch(rerun, history, method, flash_tolerance, EOSType::PR);
+        for (std::size_t cell = 0; cell < cells.size(); ++cell) {
+            const auto L = batch[cell].L().value();
+            if (L == 0. || L == 1.) {
+                checkSame(rerun[cell], batch[cell], cell);
+            }
+        }
+    }
+}
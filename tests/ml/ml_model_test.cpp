@@ -31,7 +31,16 @@
 #include <tests/ml/ml_tools/include/test_relu_10.hpp>
 #include <tests/ml/ml_tools/include/test_scalingdense_10x1.hpp>
 
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
 #include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
 
 #include <fmt/format.h>
 
@@ -173,6 +182,171 @@ bool tensor_test()
     return true;
 }
 
+template <class Evaluation>
+bool batch_test(const std::string& model_name, const int num_inputs)
+{
+    std::printf("TEST batch_%s\n", model_name.c_str());
+
+    NNModel<Evaluation> model;
+    OPM_ERROR_IF(!model.loadModel(std::filesystem::current_path() / "ml/ml_tools/models" / (model_name + ".model")),
+                 "Failed to load model");
+
+    // Inputs with derivatives, and a rectified input of zero
+    const int batch_size = 37;
+    Tensor<Evaluation> in(batch_size, num_inputs);
+    for (int n = 0; n < batch_size; n++) {
+        for (int i = 0; i < num_inputs; i++) {
+            Evaluation x = std::sin(0.37 * n + 1.3 * i);
+            if (n == 3) {
+                x = 0.0;
+            }
+            for (int d = 0; d < Evaluation::numVars; d++) {
+                x.setDerivative(d, std::cos(0.11 * n + 0.7 * i + d));
+            }
+            in(n, i) = x;
+        }
+    }
+
+    Tensor<Evaluation> out;
+    OPM_ERROR_IF(!model.applyBatch(in, out), "Failed to apply batch");
+    // Buffers are reused by a second application
+    OPM_ERROR_IF(!model.applyBatch(in, out), "Failed to apply batch");
+    OPM_ERROR_IF(out.dims_.size() != 2 || out.dims_[0] != batch_size, "Invalid batch output shape");
+
+    for (int n = 0; n < batch_size; n++) {
+        Tensor<Evaluation> sample_in(num_inputs);
+        std::copy_n(in.data_.begin() + n * num_inputs, num_inputs, sample_in.data_.begin());
+        Tensor<Evaluation> sample_out(out.dims_[1]);
+        OPM_ERROR_IF(!model.apply(sample_in, sample_out), "Failed to apply");
+
+        for (int j = 0; j < out.dims_[1]; j++) {
+            const Evaluation& expected = sample_out(j);
+            const Evaluation& actual = out(n, j);
+            OPM_ERROR_IF(fabs(actual.value() - expected.value()) > 1e-6,
+                         fmt::format(" Expected {} got {}", expected.value(), actual.value()));
+            for (int d = 0; d < Evaluation::numVars; d++) {
+                OPM_ERROR_IF(fabs(actual.derivative(d) - expected.derivative(d)) > 1e-6,
+                             fmt::format(" Expected derivative {} got {}",
+                                         expected.derivative(d), actual.derivative(d)));
+            }
+        }
+    }
+
+    return true;
+}
+
+template <class Evaluation>
+bool binary_test(const std::string& model_name, const int num_inputs)
+{
+    std::printf("TEST binary_%s\n", model_name.c_str());
+
+    NNModel<Evaluation> model;
+    OPM_ERROR_IF(!model.loadModel(std::filesystem::current_path() / "ml/ml_tools/models" / (model_name + ".model")),
+                 "Failed to load model");
+
+    // Convert to the binary format, and write the mapped model once more
+    const auto tmp_dir = std::filesystem::temp_directory_path();
+    const auto binary_name = tmp_dir / (model_name + "_binary.model");
+    const auto mapped_name = tmp_dir / (model_name + "_mapped.model");
+    OPM_ERROR_IF(!model.saveModel(binary_name), "Failed to save binary model");
+    {
+        NNModel<Evaluation> binary_model;
+        OPM_ERROR_IF(!binary_model.loadModel(binary_name), "Failed to load binary model");
+        OPM_ERROR_IF(!binary_model.saveModel(mapped_name), "Failed to save mapped model");
+    }
+    NNModel<Evaluation> mapped_model;
+    OPM_ERROR_IF(!mapped_model.loadModel(mapped_name), "Failed to load mapped model");
+    std::filesystem::remove(binary_name);
+    std::filesystem::remove(mapped_name);
+
+    const int batch_size = 5;
+    Tensor<Evaluation> in(batch_size, num_inputs);
+    for (int n = 0; n < batch_size; n++) {
+        for (int i = 0; i < num_inputs; i++) {
+            in(n, i) = std::sin(0.37 * n + 1.3 * i);
+        }
+    }
+
+    Tensor<Evaluation> expected;
+    Tensor<Evaluation> actual;
+    OPM_ERROR_IF(!model.applyBatch(in, expected), "Failed to apply batch");
+    OPM_ERROR_IF(!mapped_model.applyBatch(in, actual), "Failed to apply batch of binary model");
+    OPM_ERROR_IF(actual.data_.size() != expected.data_.size(), "Invalid binary model output shape");
+    for (std::size_t i = 0; i < expected.data_.size(); i++) {
+        OPM_ERROR_IF(actual.data_[i] != expected.data_[i],
+                     fmt::format(" Expected {} got {}", getValue(expected.data_[i]), getValue(actual.data_[i])));
+    }
+
+    return true;
+}
+
+// A dense layer whose biases do not match its weights is rejected.
+template <class Evaluation>
+bool invalid_dense_test()
+{
+    std::printf("TEST invalid_dense_test\n");
+
+    const auto write_kerasify = [](const std::filesystem::path& name, unsigned int num_biases)
+    {
+        std::ofstream file(name, std::ios::binary);
+        const unsigned int header[] = {1, 3, 2, 3, num_biases};
+        file.write(reinterpret_cast<const char*>(header), sizeof(header));
+        const std::vector<float> values(6 + num_biases, 0.5f);
+        file.write(reinterpret_cast<const char*>(values.data()), values.size() * sizeof(float));
+        const unsigned int activation = 1;
+        file.write(reinterpret_cast<const char*>(&activation), sizeof(activation));
+    };
+
+    const auto throws = [](const std::filesystem::path& name)
+    {
+        try {
+            NNModel<Evaluation> model;
+            model.loadModel(name);
+        }
+        catch (...) {
+            return true;
+        }
+        return false;
+    };
+
+    const auto tmp_dir = std::filesystem::temp_directory_path();
+    const auto kerasify_name = tmp_dir / "invalid_dense.model";
+    const auto binary_name = tmp_dir / "invalid_dense_binary.model";
+
+    write_kerasify(kerasify_name, 2);
+    OPM_ERROR_IF(!throws(kerasify_name), "Accepted biases of the wrong shape");
+
+    // Write a valid binary model, then change the shape of its biases
+    write_kerasify(kerasify_name, 3);
+    {
+        NNModel<Evaluation> model;
+        OPM_ERROR_IF(!model.loadModel(kerasify_name), "Failed to load model");
+        OPM_ERROR_IF(!model.saveModel(binary_name), "Failed to save binary model");
+    }
+    std::vector<char> bytes;
+    {
+        std::ifstream file(binary_name, std::ios::binary);
+        bytes.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    }
+    const std::uint32_t shape[] = {2, 3, 3};
+    const auto pos = std::search(bytes.begin(), bytes.end(),
+                                 reinterpret_cast<const char*>(shape),
+                                 reinterpret_cast<const char*>(shape) + sizeof(shape));
+    OPM_ERROR_IF(pos == bytes.end(), "Dense layer shape not found in binary model");
+    const std::uint32_t num_biases = 2;
+    std::memcpy(&*pos + 2 * sizeof(std::uint32_t), &num_biases, sizeof(num_biases));
+    {
+        std::ofstream file(binary_name, std::ios::binary);
+        file.write(bytes.data(), bytes.size());
+    }
+    OPM_ERROR_IF(!throws(binary_name), "Accepted binary biases of the wrong shape");
+
+    std::filesystem::remove(kerasify_name);
+    std::filesystem::remove(binary_name);
+
+    return true;
+}
+
 } // namespace Opm
 
 int main()
@@ -193,6 +367,17 @@ int main()
         test_dense_relu_10<Evaluation>(&load_time, &apply_time);
         test_dense_tanh_10<Evaluation>(&load_time, &apply_time);
         test_scalingdense_10x1<Evaluation>(&load_time, &apply_time);
+
+        using Evaluation3 = Opm::DenseAd::Evaluation<double, 3>;
+        batch_test<Evaluation3>("test_dense_10x10x10", 10);
+        batch_test<Evaluation3>("test_dense_relu_10", 10);
+        batch_test<Evaluation3>("test_dense_tanh_10", 10);
+        batch_test<Evaluation3>("test_scalingdense_10x1", 10);
+        batch_test<Evaluation>("test_dense_2x2", 2);
+
+        binary_test<Evaluation>("test_dense_10x10x10", 10);
+        binary_test<Evaluation>("test_scalingdense_10x1", 10);
+        invalid_dense_test<Evaluation>();
     }
     catch(...) {
         return 1;
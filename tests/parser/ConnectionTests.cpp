@@ -251,6 +251,59 @@ BOOST_AUTO_TEST_CASE(ActiveCompletions)
     BOOST_CHECK_EQUAL( completion3, active_completions.get(1));
 }
 
+BOOST_AUTO_TEST_CASE(ConnectionLookupAfterReorder)
+{
+    const auto dir = Opm::Connection::Direction::Z;
+    const auto kind = Opm::Connection::CTFKind::DeckValue;
+
+    auto ctf_props = Opm::Connection::CTFProperties{};
+    ctf_props.CF = 99.88;
+
+    Opm::EclipseGrid grid { 10, 20, 20 };
+
+    Opm::WellConnections completions(Opm::Connection::Order::DEPTH, 0, 0);
+    for (const int k : { 3, 0, 2, 1 }) {
+        completions.add(Opm::Connection {
+            0, 0, k, grid.getGlobalIndex(0, 0, k), k + 1,
+            Opm::Connection::State::OPEN, dir, kind, 0,
+            static_cast<double>(k), ctf_props, 0, true
+        });
+    }
+
+    completions.order();
+
+    for (int k = 0; k < 4; ++k) {
+        const auto global_index = grid.getGlobalIndex(0, 0, k);
+
+        BOOST_CHECK_EQUAL(completions.get(k).getK(), k);
+        BOOST_CHECK_EQUAL(completions.getFromIJK(0, 0, k).getK(), k);
+        BOOST_CHECK_EQUAL(completions.getFromGlobalIndex(global_index).getK(), k);
+        BOOST_CHECK_MESSAGE(completions.maybeGetFromGlobalIndex(global_index) == &completions.getFromIJK(0, 0, k),
+                            "Global index and IJK lookup must agree after reordering");
+    }
+
+    BOOST_CHECK_THROW(completions.getFromIJK(0, 0, 4), std::runtime_error);
+    BOOST_CHECK_THROW(completions.getFromGlobalIndex(grid.getGlobalIndex(1, 0, 0)), std::logic_error);
+    BOOST_CHECK_MESSAGE(completions.maybeGetFromGlobalIndex(grid.getGlobalIndex(0, 0, 4)) == nullptr,
+                        "Connection must not exist in cell (1,1,5)");
+
+    std::vector<int> actnum(grid.getCartesianSize(), 1);
+    actnum[grid.getGlobalIndex(0, 0, 1)] = 0;
+    grid.resetACTNUM(actnum);
+
+    auto filtered = completions;
+    filtered.filter(Opm::ActiveGridCells { grid.getNXYZ(), grid.getActiveMap().data(), grid.getNumActive() });
+
+    BOOST_CHECK_EQUAL(filtered.size(), 3U);
+    BOOST_CHECK(! filtered.hasGlobalIndex(grid.getGlobalIndex(0, 0, 1)));
+    BOOST_CHECK_EQUAL(filtered.getFromGlobalIndex(grid.getGlobalIndex(0, 0, 3)).getK(), 3);
+    BOOST_CHECK_EQUAL(filtered.getFromIJK(0, 0, 2).getK(), 2);
+
+    // Original is unaffected by changes to the copy.
+    BOOST_CHECK(completions.hasGlobalIndex(grid.getGlobalIndex(0, 0, 1)));
+    BOOST_CHECK_EQUAL(completions.getFromIJK(0, 0, 3).getK(), 3);
+}
+
 BOOST_AUTO_TEST_CASE(loadCOMPDATTEST)
 {
     const Opm::UnitSystem units(Opm::UnitSystem::UnitType::UNIT_TYPE_METRIC); // Unit system used in deck FIRST_SIM.DATA.
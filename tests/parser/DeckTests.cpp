@@ -28,8 +28,10 @@
 #include <opm/input/eclipse/Deck/Deck.hpp>
 #include <opm/input/eclipse/Deck/DeckKeyword.hpp>
 #include <opm/input/eclipse/Deck/DeckOutput.hpp>
+#include <opm/input/eclipse/Deck/DeckSection.hpp>
 #include <opm/input/eclipse/Deck/DeckTree.hpp>
 #include <opm/input/eclipse/Deck/DeckView.hpp>
+#include <opm/input/eclipse/Deck/ValueStatusRuns.hpp>
 
 #include <opm/input/eclipse/Parser/ErrorGuard.hpp>
 #include <opm/input/eclipse/Parser/ParseContext.hpp>
@@ -48,6 +50,7 @@
 #include <sstream>
 #include <stdexcept>
 #include <string>
+#include <thread>
 #include <utility>
 #include <vector>
 
@@ -677,6 +680,162 @@ BOOST_AUTO_TEST_CASE(DeckItemEqual) {
 }
 
 
+BOOST_AUTO_TEST_CASE(DeckItemValueStatusRuns) {
+    DeckItem item("TEST", int());
+    item.push_back( 1, 50 );
+    item.push_back( 2 );
+    item.push_backDefault( 3, 25 );
+    item.push_backDummyDefault<int>( 5 );
+
+    const auto& status = item.getValueStatus();
+    BOOST_CHECK_EQUAL( status.size(), 81U );
+    BOOST_CHECK_EQUAL( status.numRuns(), 3U );
+
+    BOOST_CHECK( status[0] == value::status::deck_value );
+    BOOST_CHECK( status[50] == value::status::deck_value );
+    BOOST_CHECK( status[51] == value::status::valid_default );
+    BOOST_CHECK( status[75] == value::status::valid_default );
+    BOOST_CHECK( status[76] == value::status::empty_default );
+    BOOST_CHECK( status[80] == value::status::empty_default );
+    BOOST_CHECK_THROW( status.at(81), std::out_of_range );
+
+    BOOST_CHECK( !item.defaultApplied( 50 ) );
+    BOOST_CHECK( item.defaultApplied( 51 ) );
+    BOOST_CHECK( item.hasValue( 75 ) );
+    BOOST_CHECK( !item.hasValue( 76 ) );
+    BOOST_CHECK( !item.hasValue( 81 ) );
+
+    const auto expanded = status.expand();
+    BOOST_CHECK_EQUAL( expanded.size(), status.size() );
+    BOOST_CHECK( std::equal( status.begin(), status.end(), expanded.begin(), expanded.end() ) );
+    BOOST_CHECK_EQUAL( std::count( expanded.begin(), expanded.end(), value::status::valid_default ), 25 );
+
+    BOOST_CHECK( !status.all_of( &value::defaulted ) );
+    BOOST_CHECK( status.all_of( [](const value::status st) { return st != value::status::uninitialized; } ) );
+}
+
+
+BOOST_AUTO_TEST_CASE(DeckItemValueStatusFlat) {
+    DeckItem item("TEST", int());
+    item.push_back( 1, 100 );
+    for (int i = 0; i < 50; ++i) {
+        item.push_back( 2 );
+        item.push_backDefault( 3, 1 );
+    }
+
+    // Alternating flags are stored one per value rather than as runs.
+    const auto& status = item.getValueStatus();
+    BOOST_CHECK( status.isFlat() );
+    BOOST_CHECK_EQUAL( status.size(), 200U );
+    BOOST_CHECK( status[99] == value::status::deck_value );
+    BOOST_CHECK( status[100] == value::status::deck_value );
+    BOOST_CHECK( status[101] == value::status::valid_default );
+    BOOST_CHECK( status[199] == value::status::valid_default );
+
+    const auto expanded = status.expand();
+    BOOST_CHECK( std::equal( status.begin(), status.end(), expanded.begin(), expanded.end() ) );
+    BOOST_CHECK_EQUAL( std::count( expanded.begin(), expanded.end(), value::status::valid_default ), 50 );
+
+    ValueStatusRuns runs;
+    runs.push_back( value::status::deck_value, 101 );
+    for (int i = 0; i < 49; ++i) {
+        runs.push_back( value::status::valid_default );
+        runs.push_back( value::status::deck_value );
+    }
+    runs.push_back( value::status::valid_default );
+    BOOST_CHECK( runs.isFlat() );
+    BOOST_CHECK( runs == status );
+}
+
+
+BOOST_AUTO_TEST_CASE(DeckItemEmptyStructuralCopy) {
+    auto dims = make_dims();
+    DeckItem item("TEST", double(), dims.first, dims.second);
+    item.push_back( 1.0, 10 );
+    item.push_backDefault( 2.0, 10 );
+    BOOST_CHECK_EQUAL( item.data_size(), 20U );
+
+    auto copy = item.emptyStructuralCopy();
+    BOOST_CHECK_EQUAL( copy.data_size(), 0U );
+    BOOST_CHECK( copy.getData<double>().empty() );
+    BOOST_CHECK( copy.getValueStatus().empty() );
+    BOOST_CHECK( copy.getType() == type_tag::fdouble );
+    BOOST_CHECK_EQUAL( copy.name(), "TEST" );
+    BOOST_CHECK_EQUAL( item.data_size(), 20U );
+
+    copy.push_back( 3.0 );
+    BOOST_CHECK_EQUAL( copy.data_size(), 1U );
+    BOOST_CHECK_EQUAL( copy.get<double>( 0 ), 3.0 );
+    BOOST_CHECK_THROW( copy.getData<int>(), std::invalid_argument );
+}
+
+
+BOOST_AUTO_TEST_CASE(DeckItemSIDataIsCached) {
+    UnitSystem field(UnitSystem::UnitType::UNIT_TYPE_FIELD);
+    const std::vector<Dimension> active { field.getDimension("Length") };
+    const std::vector<Dimension> deflt  { field.getDimension("Length") };
+
+    DeckItem item("TEST", double(), active, deflt);
+    item.push_back( 1.0, 1000 );
+    item.push_backDefault( 2.0, 24 );
+
+    std::vector<const std::vector<double>*> si_data(8, nullptr);
+    {
+        std::vector<std::thread> readers;
+        for (std::size_t i = 0; i < si_data.size(); ++i) {
+            readers.emplace_back([&item, &si_data, i]() { si_data[i] = &item.getSIDoubleData(); });
+        }
+
+        for (auto& reader : readers) {
+            reader.join();
+        }
+    }
+
+    // All readers observe the same, single conversion.
+    for (const auto* data : si_data) {
+        BOOST_CHECK_EQUAL( data, si_data.front() );
+    }
+
+    const auto& si = item.getSIDoubleData();
+    BOOST_CHECK_EQUAL( &si, si_data.front() );
+    BOOST_CHECK( &si != &item.getData<double>() );
+    BOOST_CHECK_CLOSE( si[0], 0.3048, 1.0e-8 );
+    BOOST_CHECK_CLOSE( si[1000], 2*0.3048, 1.0e-8 );
+
+    // Copies compute their own conversion, modification discards it.
+    auto copy = item;
+    BOOST_CHECK( &copy.getSIDoubleData() != &si );
+    BOOST_CHECK( copy.getSIDoubleData() == si );
+
+    copy.push_back( 3.0 );
+    BOOST_CHECK_EQUAL( copy.getSIDoubleData().size(), 1025U );
+    BOOST_CHECK_CLOSE( copy.getSIDoubleData().back(), 3*0.3048, 1.0e-8 );
+    BOOST_CHECK_EQUAL( item.getSIDoubleData().size(), 1024U );
+}
+
+
+BOOST_AUTO_TEST_CASE(DeckItemRawDataUnchangedBySIData) {
+    UnitSystem field(UnitSystem::UnitType::UNIT_TYPE_FIELD);
+    const std::vector<Dimension> active { field.getDimension("Pressure") };
+    const std::vector<Dimension> deflt  { field.getDimension("Pressure") };
+
+    // Values which do not all survive a round trip through SI units.
+    DeckItem item("TEST", double(), active, deflt);
+    for (int i = 1; i <= 100; ++i)
+        item.push_back( 0.1*i + 1.0/3 );
+
+    const auto reference = item;
+    const auto raw = item.getData<double>();
+    item.getSIDoubleData();
+
+    BOOST_CHECK( item.getData<double>() == raw );
+    for (std::size_t i = 0; i < raw.size(); ++i)
+        BOOST_CHECK_EQUAL( item.get<double>(i), raw[i] );
+
+    BOOST_CHECK( item.equal( reference, true, false ) );
+}
+
+
 BOOST_AUTO_TEST_CASE(STRING_TO_BOOL) {
     BOOST_CHECK( DeckItem::to_bool("TRUE") );
     BOOST_CHECK( DeckItem::to_bool("T") );
@@ -858,3 +1017,116 @@ DATES
     auto count = std::count_if(dw.begin(), dw.end(), is_vfpprod);
     BOOST_CHECK_EQUAL(count, 2);
 }
+
+namespace {
+
+Deck makeIndexedDeck(const std::vector<std::string>& names)
+{
+    Deck deck;
+    for (const auto& name : names) {
+        deck.addKeyword(DeckKeyword(KeywordLocation{name, "file.DATA", 1}, name));
+    }
+
+    return deck;
+}
+
+std::vector<std::string> keywordNames(const DeckView& view)
+{
+    std::vector<std::string> names;
+    std::transform(view.begin(), view.end(), std::back_inserter(names),
+                   [](const auto& kw) { return kw.name(); });
+    return names;
+}
+
+} // Anonymous namespace
+
+BOOST_AUTO_TEST_CASE(DeckViewSlices) {
+    const auto deck = makeIndexedDeck({"RUNSPEC", "DIMENS", "GRID", "PORO", "PERMX", "PORO",
+                                       "PROPS", "SCHEDULE", "DATES", "WCONPROD", "DATES"});
+
+    const auto global = deck.global_view();
+    BOOST_CHECK_EQUAL(global.size(), deck.size());
+    BOOST_CHECK_EQUAL(global.count("PORO"), 2);
+
+    const auto grid = global.slice(2, 6);
+    BOOST_CHECK_EQUAL(grid.size(), 4);
+    BOOST_CHECK_EQUAL(grid.front().name(), "GRID");
+    BOOST_CHECK_EQUAL(grid.back().name(), "PORO");
+    BOOST_CHECK(!grid.has_keyword("DATES"));
+    BOOST_CHECK_EQUAL(grid.count("PORO"), 2);
+
+    const auto poro_index = std::vector<std::size_t>{1, 3};
+    BOOST_CHECK(grid.index("PORO") == poro_index);
+    BOOST_CHECK_THROW(grid[4], std::out_of_range);
+    BOOST_CHECK_THROW(global.slice(5, 12), std::out_of_range);
+
+    BOOST_CHECK_EQUAL(grid.find("PORO").value(), 1);
+    BOOST_CHECK_EQUAL(grid.find("PORO", 2).value(), 3);
+    BOOST_CHECK(!grid.find("PORO", 4).has_value());
+    BOOST_CHECK(!grid.find("DATES").has_value());
+
+    const auto poro = grid["PORO"];
+    BOOST_CHECK_EQUAL(poro.size(), 2);
+    BOOST_CHECK(&poro[0] == &deck[3]);
+    BOOST_CHECK(&poro.back() == &deck[5]);
+    BOOST_CHECK(poro.has_keyword("PORO"));
+    BOOST_CHECK(!poro.has_keyword("PERMX"));
+    BOOST_CHECK(poro["PERMX"].empty());
+    BOOST_CHECK_EQUAL(poro["PORO"].size(), 2);
+
+    const auto all_poro = std::vector<std::size_t>{0, 1};
+    BOOST_CHECK(poro.index("PORO") == all_poro);
+
+    const auto last_poro = poro.slice(1, 2);
+    BOOST_CHECK(&last_poro.front() == &deck[5]);
+
+    const auto schedule = DeckSection(deck, "SCHEDULE");
+    const auto sched_names = std::vector<std::string>{"SCHEDULE", "DATES", "WCONPROD", "DATES"};
+    BOOST_CHECK(keywordNames(schedule) == sched_names);
+    BOOST_CHECK_EQUAL(schedule.count("DATES"), 2);
+
+    const auto grid_section = GRIDSection(deck);
+    BOOST_CHECK_EQUAL(grid_section.size(), 4);
+    BOOST_CHECK(!grid_section.hasKeyword("PROPS"));
+
+    BOOST_CHECK(DeckSection(deck, "SOLUTION").empty());
+}
+
+BOOST_AUTO_TEST_CASE(DeckIndexMaintained) {
+    auto deck = makeIndexedDeck({"GRID", "PORO"});
+
+    // Views remain valid while the deck grows, and do not observe
+    // keywords added after they were created.
+    const auto before = deck["PORO"];
+    for (int i = 0; i < 100; ++i) {
+        deck.addKeyword(DeckKeyword(KeywordLocation{}, "PORO"));
+    }
+
+    BOOST_CHECK_EQUAL(before.size(), 1);
+    BOOST_CHECK(&before.front() == &deck[1]);
+    BOOST_CHECK_EQUAL(deck.count("PORO"), 101);
+    BOOST_CHECK_EQUAL(deck.getKeywordList("PORO").back(), &deck[101]);
+
+    deck.remove_keywords(1, 100);
+    BOOST_CHECK_EQUAL(deck.size(), 3);
+    BOOST_CHECK_EQUAL(deck.count("PORO"), 2);
+    BOOST_CHECK(deck.index("PORO") == (std::vector<std::size_t>{1, 2}));
+
+    auto copy = deck;
+    deck.addKeyword(DeckKeyword(KeywordLocation{}, "PERMX"));
+    BOOST_CHECK(!copy.hasKeyword("PERMX"));
+    BOOST_CHECK(deck.hasKeyword("PERMX"));
+    BOOST_CHECK(&copy["GRID"].front() == &copy[0]);
+
+    auto moved = std::move(copy);
+    BOOST_CHECK_EQUAL(moved.count("PORO"), 2);
+    BOOST_CHECK(&moved["PORO"].back() == &moved[2]);
+
+    // Adding to a view of a deck does not modify the deck.
+    auto view = deck["PORO"];
+    view.add_keyword(deck[0]);
+    BOOST_CHECK_EQUAL(view.size(), 3);
+    BOOST_CHECK(view.has_keyword("GRID"));
+    BOOST_CHECK_EQUAL(deck.count("GRID"), 1);
+    BOOST_CHECK_EQUAL(deck.size(), 4);
+}
@@ -17,6 +17,7 @@ You should have received a copy of the GNU General Public License
 along with OPM.  If not, see <http://www.gnu.org/licenses/>.
 */
 
+#include <algorithm>
 #include <stdexcept>
 
 #define BOOST_TEST_MODULE EclipseStateTests
@@ -319,6 +320,21 @@ BOOST_AUTO_TEST_CASE(GetFaults) {
     BOOST_CHECK_EQUAL( transMult.getMultiplier( 4, 3, 0, FaceDir::ZPlus ), 1.00 );
 }
 
+BOOST_AUTO_TEST_CASE(ConstructionTimings) {
+    auto deck = createDeck();
+    EclipseState state( deck );
+
+    const auto& timings = state.constructionTimings();
+    for (const auto* stage : { "tables", "grid", "faults", "properties" }) {
+        const auto pos = std::find_if(timings.begin(), timings.end(),
+                                      [stage](const auto& timing) { return timing.first == stage; });
+        BOOST_REQUIRE_MESSAGE(pos != timings.end(), "Missing timing for stage " << stage);
+        BOOST_CHECK(pos->second >= 0.0);
+    }
+
+    BOOST_CHECK_EQUAL(state.getFaults().size(), 2U);
+    BOOST_CHECK(EclipseState().constructionTimings().empty());
+}
 
 BOOST_AUTO_TEST_CASE(FaceTransMults) {
     auto deck = createDeckNoFaults();
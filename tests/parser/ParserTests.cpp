@@ -40,6 +40,7 @@
 #include <opm/input/eclipse/Parser/Parser.hpp>
 #include <opm/input/eclipse/Parser/ParserKeyword.hpp>
 #include <opm/input/eclipse/Parser/ParserKeywords/A.hpp>
+#include <opm/input/eclipse/Parser/ParserKeywords/E.hpp>
 #include <opm/input/eclipse/Parser/ParserKeywords/Builtin.hpp>
 #include <opm/input/eclipse/Parser/ParserKeywords/R.hpp>
 #include <opm/input/eclipse/Parser/ParserKeywords/S.hpp>
@@ -49,6 +50,7 @@
 #include "../../opm/input/eclipse/Parser/raw/RawKeyword.hpp"
 #include "../../opm/input/eclipse/Parser/raw/RawRecord.hpp"
 
+#include <algorithm>
 #include <cstddef>
 #include <filesystem>
 #include <iostream>
@@ -56,6 +58,7 @@
 #include <sstream>
 #include <stdexcept>
 #include <string>
+#include <thread>
 #include <tuple>
 #include <utility>
 #include <vector>
@@ -324,6 +327,88 @@ BOOST_AUTO_TEST_CASE(WildCardTest) {
 }
 
 
+BOOST_AUTO_TEST_CASE(BuiltinKeywordTable) {
+    const auto& table = ParserKeywords::builtinKeywordTable();
+    BOOST_CHECK( table.numKeywords > 0 );
+
+    const auto* entry = table.find("EQLDIMS");
+    BOOST_REQUIRE( entry != nullptr );
+    BOOST_CHECK_EQUAL( entry->deckName, "EQLDIMS" );
+    BOOST_CHECK_EQUAL( table.factories[entry->keyword]().getName(), "EQLDIMS" );
+
+    BOOST_CHECK( table.find("EQLDIMSX") == nullptr );
+    BOOST_CHECK( table.find("eqldims") == nullptr );
+    BOOST_CHECK( table.find("") == nullptr );
+
+    const auto names = std::vector<std::string> { "A", "B", "AB", "BA", "ABC", "CBA", "WCONPROD", "WCONINJE" };
+    const auto layout = ParserKeywords::buildPerfectHash(names);
+    BOOST_CHECK( layout.slots.size() >= names.size() );
+
+    auto slots = std::vector<std::size_t>(names.size(), ParserKeywords::PerfectHashLayout::npos);
+    for (std::size_t slot = 0; slot < layout.slots.size(); ++slot) {
+        if (layout.slots[slot] != ParserKeywords::PerfectHashLayout::npos) {
+            slots[layout.slots[slot]] = slot;
+        }
+    }
+
+    for (std::size_t name = 0; name < names.size(); ++name) {
+        const auto bucket = ParserKeywords::keywordNameHash(names[name], 0) % layout.seeds.size();
+        const auto slot = ParserKeywords::keywordNameHash(names[name], layout.seeds[bucket]) % layout.slots.size();
+        BOOST_CHECK_EQUAL( slot, slots[name] );
+    }
+}
+
+BOOST_AUTO_TEST_CASE(BuiltinKeywordsLazy) {
+    const Parser parser;
+    BOOST_CHECK( parser.isRecognizedKeyword("EQLDIMS") );
+    BOOST_CHECK( parser.isBaseRecognizedKeyword("EQLDIMS") );
+    BOOST_CHECK( parser.hasKeyword("EQLDIMS") );
+    BOOST_CHECK( !parser.hasKeyword("EQLDIMSX") );
+
+    // Repeated lookups return the same cached object.
+    const auto& eqldims = parser.getParserKeywordFromDeckName("EQLDIMS");
+    BOOST_CHECK_EQUAL( &eqldims, &parser.getParserKeywordFromDeckName("EQLDIMS") );
+    BOOST_CHECK_EQUAL( eqldims, ParserKeywords::EQLDIMS{} );
+
+    // Copies construct their own keywords.
+    const Parser copy = parser;
+    BOOST_CHECK( &copy.getParserKeywordFromDeckName("EQLDIMS") != &eqldims );
+    BOOST_CHECK_EQUAL( copy.getParserKeywordFromDeckName("EQLDIMS"), eqldims );
+
+    // Every deck name is reported once.
+    auto names = parser.getAllDeckNames();
+    std::sort(names.begin(), names.end());
+    BOOST_CHECK( std::adjacent_find(names.begin(), names.end()) == names.end() );
+    BOOST_CHECK( parser.size() <= names.size() );
+}
+
+BOOST_AUTO_TEST_CASE(BuiltinKeywordsConcurrentLookup) {
+    const Parser parser;
+    const auto deck_names = std::vector<std::string> { "EQLDIMS", "TABDIMS", "WELLDIMS", "RUNSPEC", "DIMENS", "ACTDIMS" };
+
+    auto found = std::vector<std::vector<const ParserKeyword*>>(8);
+    {
+        auto threads = std::vector<std::thread>{};
+        for (auto& kws : found) {
+            threads.emplace_back([&parser, &deck_names, &kws]()
+            {
+                for (const auto& name : deck_names) {
+                    kws.push_back(&parser.getParserKeywordFromDeckName(name));
+                }
+            });
+        }
+
+        for (auto& thread : threads) {
+            thread.join();
+        }
+    }
+
+    for (const auto& kws : found) {
+        BOOST_CHECK( kws == found.front() );
+    }
+}
+
+
 BOOST_AUTO_TEST_CASE( quoted_comments ) {
     BOOST_CHECK_EQUAL( Parser::stripComments( "ABC" ) , "ABC");
     BOOST_CHECK_EQUAL( Parser::stripComments( "--ABC") , "");
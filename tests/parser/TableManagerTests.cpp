@@ -311,6 +311,41 @@ END
     BOOST_CHECK_EQUAL(swof2Table.getSwColumn().back(), 17.0);
 }
 
+BOOST_AUTO_TEST_CASE(SwofTable_Shared_Regions) {
+    auto deck = Opm::Parser{}.parseString(R"(RUNSPEC
+OIL
+WATER
+
+TABDIMS
+4 /
+
+PROPS
+
+SWOF
+  0.1 0.0 1.0 0.0
+  1.0 1.0 0.0 0.0 /
+  0.2 0.0 1.0 0.0
+  1.0 1.0 0.0 0.0 /
+  0.1 0.0 1.0 0.0
+  1.0 1.0 0.0 0.0 /
+/
+
+END
+)");
+
+    const auto tables = Opm::TableManager { deck };
+    const auto& swof = tables.getSwofTables();
+
+    // Region 3 repeats region 1's data, region 4 is defaulted from region 3.
+    BOOST_CHECK( &swof.getTable(0) != &swof.getTable(1) );
+    BOOST_CHECK( &swof.getTable(0) == &swof.getTable(2) );
+    BOOST_CHECK( &swof.getTable(2) == &swof.getTable(3) );
+
+    BOOST_CHECK_EQUAL(swof.getTable<Opm::SwofTable>(0).getSwColumn().front(), 0.1);
+    BOOST_CHECK_EQUAL(swof.getTable<Opm::SwofTable>(1).getSwColumn().front(), 0.2);
+    BOOST_CHECK_EQUAL(swof.getTable<Opm::SwofTable>(3).getSwColumn().front(), 0.1);
+}
+
 BOOST_AUTO_TEST_CASE(PbvdTable_Tests) {
     const char *deckData =
         "EQLDIMS\n"
@@ -66,6 +66,57 @@ BOOST_AUTO_TEST_CASE(TESTInplace)
     }
 }
 
+BOOST_AUTO_TEST_CASE(InplaceVectorOperations)
+{
+    Inplace oip;
+
+    oip.add_vector("FIPNUM", Inplace::Phase::OIL, { 1.0, 2.0, 3.0, 4.0 });
+    oip.add("FIPNUM", Inplace::Phase::OIL, 6, 10.0);
+    oip.add("FIPNUM", Inplace::Phase::GAS, 2, 5.0);
+    oip.add("FIPABC", Inplace::Phase::OIL, 1, 7.0);
+    oip.add(Inplace::Phase::OIL, 20.0);
+
+    BOOST_CHECK_EQUAL(oip.get("FIPNUM", Inplace::Phase::OIL, 3), 3.0);
+    BOOST_CHECK(! oip.has("FIPNUM", Inplace::Phase::OIL, 5));
+    BOOST_CHECK(! oip.has("FIPNUM", Inplace::Phase::GAS, 1));
+    BOOST_CHECK_EQUAL(oip.max_region("FIPNUM"), 6);
+    BOOST_CHECK_EQUAL(oip.max_region("FIPABC"), 1);
+    BOOST_CHECK_EQUAL(oip.max_region(), 6);
+
+    {
+        const auto v = oip.get_vector("FIPNUM", Inplace::Phase::GAS);
+        const std::vector<double> e = {0, 5, 0, 0, 0, 0};
+        BOOST_CHECK_MESSAGE(v == e, "In-place gas content must match expected");
+    }
+
+    BOOST_CHECK_EQUAL(oip.sum("FIPNUM", Inplace::Phase::OIL), 20.0);
+    BOOST_CHECK_EQUAL(oip.sum("FIPABC", Inplace::Phase::OIL), 7.0);
+    BOOST_CHECK_THROW(oip.sum("FIPNUM", Inplace::Phase::WATER), std::exception);
+    BOOST_CHECK_THROW(oip.sum("FIPX", Inplace::Phase::OIL), std::exception);
+
+    {
+        const auto totals = oip.sum("FIPNUM", { Inplace::Phase::OIL,
+                                                Inplace::Phase::WATER,
+                                                Inplace::Phase::GAS });
+        const std::vector<double> e = {20, 0, 5};
+        BOOST_CHECK_MESSAGE(totals == e, "In-place totals must match expected");
+    }
+
+    // Equality does not depend on order of assignment.
+    Inplace other;
+    other.add(Inplace::Phase::OIL, 20.0);
+    other.add("FIPABC", Inplace::Phase::OIL, 1, 7.0);
+    other.add("FIPNUM", Inplace::Phase::GAS, 2, 5.0);
+    other.add("FIPNUM", Inplace::Phase::OIL, 6, 10.0);
+    for (std::size_t region = 1; region <= 4; ++region) {
+        other.add("FIPNUM", Inplace::Phase::OIL, region, static_cast<double>(region));
+    }
+    BOOST_CHECK(oip == other);
+
+    other.add("FIPNUM", Inplace::Phase::OIL, 5, 0.0);
+    BOOST_CHECK(! (oip == other));
+}
+
 BOOST_AUTO_TEST_CASE(InPlace_Phases)
 {
     const auto& phases = Inplace::phases();
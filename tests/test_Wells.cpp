@@ -24,9 +24,12 @@
 
 #include <stdexcept>
 
+#include <opm/output/data/FlatWells.hpp>
 #include <opm/output/data/Wells.hpp>
 #include <opm/json/JsonObject.hpp>
 
+#include "tests/MessageBuffer.cpp"
+
 using namespace Opm;
 using rt = data::Rates::opt;
 
@@ -156,3 +159,84 @@ BOOST_AUTO_TEST_CASE(get_connections) {
     BOOST_CHECK(json.has_item("OP_1"));
     BOOST_CHECK(json.has_item("OP_2"));
 }
+
+namespace {
+
+data::Wells flatWellsTestObject()
+{
+    auto wells = data::Wells::serializationTestObject();
+
+    auto w2 = data::Well::serializationTestObject();
+    w2.rates.set(rt::tracer, 2.5, "T2");
+    w2.connections.push_back(data::Connection::serializationTestObject());
+    w2.connections.back().index = 17;
+    w2.connections.back().rates.set(rt::tracer, 0.25, "test_tracer");
+    w2.segments.emplace(7, data::Segment::serializationTestObject());
+    w2.segments[7].rates.set(rt::tracer, 1.75, "T2");
+    wells.emplace("PROD", w2);
+
+    wells.emplace("EMPTY", data::Well{});
+
+    return wells;
+}
+
+} // Anonymous namespace
+
+BOOST_AUTO_TEST_CASE(flat_wells_round_trip) {
+    const auto wells = flatWellsTestObject();
+    const auto flat = data::FlatWells { wells };
+
+    BOOST_CHECK_EQUAL(flat.numWells(), std::size_t{3});
+    BOOST_CHECK_EQUAL(flat.connections().size(), std::size_t{3});
+    BOOST_CHECK_EQUAL(flat.segments().size(), std::size_t{3});
+
+    BOOST_CHECK(! flat.wellSlot("NO_SUCH_WELL").has_value());
+
+    const auto slot = flat.wellSlot("PROD");
+    BOOST_REQUIRE(slot.has_value());
+    BOOST_CHECK_EQUAL(flat.wellName(*slot), "PROD");
+
+    const auto& prod = flat.well(*slot);
+    BOOST_CHECK_EQUAL(prod.numConnections, std::size_t{2});
+    BOOST_CHECK_EQUAL(flat.connections()[prod.firstConnection + 1].index, std::size_t{17});
+    BOOST_CHECK_EQUAL(prod.numSegments, std::size_t{2});
+    BOOST_CHECK_EQUAL(flat.segments()[prod.firstSegment].key, std::size_t{0});
+    BOOST_CHECK_EQUAL(flat.segments()[prod.firstSegment + 1].key, std::size_t{7});
+
+    BOOST_CHECK_EQUAL(flat.get("PROD", rt::gas), 3.0);
+    BOOST_CHECK_EQUAL(flat.get("EMPTY", rt::gas), 0.0);
+    BOOST_CHECK_EQUAL(flat.get("NO_SUCH_WELL", rt::gas), 0.0);
+    BOOST_CHECK_EQUAL(prod.rates.get(rt::wat, -1.0), wells.get("PROD", rt::wat));
+
+    BOOST_CHECK_EQUAL(flat.tracerRates().size(), std::size_t{10});
+
+    const auto copy = flat.toWells();
+    BOOST_CHECK(copy == wells);
+    BOOST_CHECK_EQUAL(copy.get("PROD", rt::tracer, "T2"), 2.5);
+    BOOST_CHECK_EQUAL(copy.at("PROD").segments.at(7).rates.get(rt::tracer, 0.0, "T2"), 1.75);
+}
+
+BOOST_AUTO_TEST_CASE(flat_wells_pack_unpack) {
+    const auto wells = flatWellsTestObject();
+    const auto flat = data::FlatWells { wells };
+
+    const auto bytes = flat.pack();
+
+    auto unpacked = data::FlatWells{};
+    unpacked.unpack(bytes.data(), bytes.size());
+    BOOST_CHECK(unpacked.toWells() == wells);
+    BOOST_CHECK_EQUAL(unpacked.wellSlot("test_well").value(), flat.wellSlot("test_well").value());
+
+    BOOST_CHECK_THROW(unpacked.unpack(bytes.data(), bytes.size() - 1), std::invalid_argument);
+
+    auto buffer = MessageBuffer{};
+    flat.write(buffer);
+
+    auto received = data::FlatWells{};
+    received.read(buffer);
+    BOOST_CHECK(received.toWells() == wells);
+
+    received.clear();
+    BOOST_CHECK_EQUAL(received.numWells(), std::size_t{0});
+    BOOST_CHECK(received.toWells().empty());
+}
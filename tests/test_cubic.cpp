@@ -43,6 +43,11 @@
 
 /* --- our own headers --- */
 #include <opm/common/utility/numeric/MonotCubicInterpolator.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
 using namespace Opm;
 
 BOOST_AUTO_TEST_SUITE (Cubic)
@@ -64,4 +69,63 @@ BOOST_AUTO_TEST_CASE (cubic)
     BOOST_REQUIRE_CLOSE (interp.evaluate(4.0), 2., 0.00001);
 }
 
+BOOST_AUTO_TEST_CASE (cubic_batch)
+{
+    std::vector<double> x;
+    std::vector<double> f;
+    for (int i = 0; i < 50; ++i) {
+        x.push_back(0.05*i*i);
+        f.push_back(1.0 - std::exp(-0.05*i*i) + 0.01*(i % 3));
+    }
+    MonotCubicInterpolator interp(x, f);
+
+    // unsorted values including the data points and values outside
+    std::vector<double> xval;
+    for (int i = 0; i < 400; ++i) {
+        xval.push_back((i % 9 == 0) ? x[(7*i) % x.size()] : -1.0 + (x.back() + 2.0)*((31*i) % 400)/399.0);
+    }
+    std::vector<double> xsorted = xval;
+    std::sort(xsorted.begin(), xsorted.end());
+
+    for (const auto& xs : {xval, xsorted}) {
+        std::vector<double> fval;
+        std::vector<double> dfdx;
+        interp.evaluate(xs, fval);
+        BOOST_REQUIRE_EQUAL(fval.size(), xs.size());
+        for (std::size_t i = 0; i < xs.size(); ++i) {
+            BOOST_CHECK_EQUAL(fval[i], interp.evaluate(xs[i]));
+        }
+
+        interp.evaluate(xs, fval, dfdx);
+        BOOST_REQUIRE_EQUAL(dfdx.size(), xs.size());
+        for (std::size_t i = 0; i < xs.size(); ++i) {
+            BOOST_CHECK_EQUAL(fval[i], interp.evaluate(xs[i]));
+            if (xs[i] < x.front() || xs[i] > x.back()) {
+                BOOST_CHECK_EQUAL(dfdx[i], 0.0);
+            }
+            else if (xs[i] > x.front() + 1.0e-4 && xs[i] < x.back() - 1.0e-4) {
+                const double h = 1.0e-6;
+                const double dfdxFD = (interp.evaluate(xs[i] + h) - interp.evaluate(xs[i] - h)) / (2*h);
+                BOOST_CHECK_CLOSE(dfdx[i], dfdxFD, 1.0e-2);
+            }
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE (cubic_batch_single_point)
+{
+    MonotCubicInterpolator interp;
+    interp.addPair(1.0, 3.0);
+
+    const std::vector<double> xs = {0.0, 1.0, 2.0};
+    std::vector<double> fval;
+    std::vector<double> dfdx;
+    interp.evaluate(xs, fval, dfdx);
+    BOOST_REQUIRE_EQUAL(fval.size(), xs.size());
+    for (std::size_t i = 0; i < xs.size(); ++i) {
+        BOOST_CHECK_EQUAL(fval[i], interp.evaluate(xs[i]));
+        BOOST_CHECK_EQUAL(dfdx[i], 0.0);
+    }
+}
+
 BOOST_AUTO_TEST_SUITE_END()